@@ -56,6 +56,8 @@ typedef enum e_sf_event
     UART_EVENT_ERR_OVERFLOW  = (1UL << 5), ///< FIFO Overflow error event
     UART_EVENT_BREAK_DETECT  = (1UL << 6), ///< Break detect error event
     UART_EVENT_TX_DATA_EMPTY = (1UL << 7), ///< Last byte is transmitting, ready for more data
+    UART_EVENT_RX_IDLE       = (1UL << 8), ///< Receive FIFO drained after the line went idle below the trigger level
+    UART_EVENT_RX_BLOCK      = (1UL << 9), ///< Block of characters received, replaces UART_EVENT_RX_CHAR when enabled
 } uart_event_t;
 #endif
 #ifndef BSP_OVERRIDE_UART_DATA_BITS_T
@@ -115,6 +117,11 @@ typedef struct st_uart_callback_arg
      * UART_EVENT_ERR_FRAMING, or UART_EVENT_ERR_OVERFLOW.  Otherwise unused. */
     uint32_t     data;
     void const * p_context;            ///< Context provided to user during callback
+
+    /** Received characters for UART_EVENT_RX_BLOCK, valid until the callback returns.  Otherwise unused. */
+    uint8_t const * p_data;
+    uint32_t        length;            ///< Number of characters at p_data for UART_EVENT_RX_BLOCK
+    bool            delimiter_found;   ///< The block holds the delimiter set by the driver, UART_EVENT_RX_BLOCK only
 } uart_callback_args_t;
 
 /** UART Configuration */
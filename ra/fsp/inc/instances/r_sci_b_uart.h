@@ -18,6 +18,7 @@
 #include "bsp_api.h"
 #include "r_uart_api.h"
 #include "r_sci_b_uart_cfg.h"
+#include "sci_b_uart_ext_cfg.h"            /* Project extensions, not generated */
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -26,6 +27,9 @@ FSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 
+/** Delimiter for R_SCI_B_UART_RxBlockSet() that matches no character. */
+#define SCI_B_UART_RX_BLOCK_NO_DELIMITER    (0x100U)
+
 /**********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -83,6 +87,24 @@ typedef struct st_sci_b_uart_instance_ctrl
 
     /* Pointer to context to be passed into callback function */
     void const * p_context;
+
+#if SCI_B_UART_CFG_RX_BLOCK_ENABLE
+
+    /* Receive FIFO contents handed to the callback with UART_EVENT_RX_BLOCK. */
+    uint8_t  rx_block[BSP_FEATURE_SCI_UART_FIFO_DEPTH];
+    bool     rx_block_enable;          // Report received data with UART_EVENT_RX_BLOCK instead of UART_EVENT_RX_CHAR
+    uint32_t rx_block_delimiter;       // Character that sets uart_callback_args_t::delimiter_found
+#endif
+
+#if SCI_B_UART_CFG_ISR_STATS_ENABLE
+
+    /* Interrupt statistics, free running. */
+    uint32_t rxi_count;                // Number of RXI interrupts taken
+    uint32_t rx_byte_count;            // Number of data bytes read by the RXI interrupt
+    uint32_t rx_idle_count;            // Number of RXI interrupts raised by the receive timeout
+    uint32_t txi_count;                // Number of TXI interrupts taken
+    uint32_t rxi_cycles;               // CPU cycles spent in the RXI interrupt, DWT cycle counter must be running
+#endif
 } sci_b_uart_instance_ctrl_t;
 
 /** Receive FIFO trigger configuration. */
@@ -206,6 +228,7 @@ fsp_err_t R_SCI_B_UART_CallbackSet(uart_ctrl_t * const          p_api_ctrl,
                                    void const * const           p_context,
                                    uart_callback_args_t * const p_callback_memory);
 fsp_err_t R_SCI_B_UART_ReadStop(uart_ctrl_t * const p_api_ctrl, uint32_t * remaining_bytes);
+fsp_err_t R_SCI_B_UART_RxBlockSet(uart_ctrl_t * const p_api_ctrl, bool enable, uint32_t delimiter);
 
 /*******************************************************************************************************************//**
  * @} (end addtogroup SCI_B_UART)
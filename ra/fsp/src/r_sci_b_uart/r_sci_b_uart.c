@@ -171,6 +171,18 @@ static void r_sci_b_uart_transfer_close(sci_b_uart_instance_ctrl_t * p_ctrl);
 
 static void r_sci_b_uart_call_callback(sci_b_uart_instance_ctrl_t * p_ctrl, uint32_t data, uart_event_t event);
 
+#if (SCI_B_UART_CFG_RX_ENABLE) && (SCI_B_UART_CFG_FIFO_SUPPORT) && (SCI_B_UART_CFG_RX_BLOCK_ENABLE)
+static void r_sci_b_uart_rx_block_drain(sci_b_uart_instance_ctrl_t * const p_ctrl);
+
+#endif
+
+#if (SCI_B_UART_CFG_RX_ENABLE) && (SCI_B_UART_CFG_RXI_FAST_PATH)
+static fsp_vector_t r_sci_b_uart_rxi_handler_select(sci_b_uart_instance_ctrl_t const * const p_ctrl);
+
+static void r_sci_b_uart_rxi_handler_install(IRQn_Type const irq, fsp_vector_t const handler);
+
+#endif
+
 #if SCI_B_UART_CFG_FIFO_SUPPORT
 static void r_sci_b_uart_fifo_cfg(sci_b_uart_instance_ctrl_t * const p_ctrl);
 
@@ -185,6 +197,14 @@ void sci_b_uart_rxi_isr(void);
 
 void sci_b_uart_eri_isr(void);
 
+ #if (SCI_B_UART_CFG_RXI_FAST_PATH)
+void sci_b_uart_rxi_8bit_isr(void);
+
+  #if SCI_B_UART_CFG_FIFO_SUPPORT
+void sci_b_uart_rxi_8bit_fifo_isr(void);
+
+  #endif
+ #endif
 #endif
 
 #if (SCI_B_UART_CFG_TX_ENABLE)
@@ -197,6 +217,12 @@ void sci_b_uart_tei_isr(void);
  * Private global variables
  **********************************************************************************************************************/
 
+#if (SCI_B_UART_CFG_RX_ENABLE) && (SCI_B_UART_CFG_RXI_FAST_PATH)
+
+/* Interrupt part of the vector table as generated, used to tell whether the active table can be patched. */
+extern const fsp_vector_t g_vector_table[BSP_ICU_VECTOR_MAX_ENTRIES];
+#endif
+
 /* Name of module used by error logger macro */
 #if BSP_CFG_ERROR_LOG != 0
 static const char g_module_name[] = "sci_b_uart";
@@ -359,6 +385,19 @@ fsp_err_t R_SCI_B_UART_Open (uart_ctrl_t * const p_api_ctrl, uart_cfg_t const *
     p_ctrl->p_rx_dest     = NULL;
     p_ctrl->rx_dest_bytes = 0;
 
+#if SCI_B_UART_CFG_ISR_STATS_ENABLE
+    p_ctrl->rxi_count     = 0U;
+    p_ctrl->rx_byte_count = 0U;
+    p_ctrl->rx_idle_count = 0U;
+    p_ctrl->txi_count     = 0U;
+    p_ctrl->rxi_cycles    = 0U;
+#endif
+
+#if SCI_B_UART_CFG_RX_BLOCK_ENABLE
+    p_ctrl->rx_block_enable    = false;
+    p_ctrl->rx_block_delimiter = SCI_B_UART_RX_BLOCK_NO_DELIMITER;
+#endif
+
     /* Set flow control pins. */
     p_ctrl->flow_pin = p_extend->flow_control_pin;
 
@@ -382,6 +421,11 @@ fsp_err_t R_SCI_B_UART_Open (uart_ctrl_t * const p_api_ctrl, uart_cfg_t const *
 
     /* If reception is enabled at build time, enable reception. */
     ccr0 |= R_SCI_B0_CCR0_RE_Msk;
+ #if (SCI_B_UART_CFG_RXI_FAST_PATH)
+
+    /* Replace the generic RXI handler with one specialised for this channel's configuration. */
+    r_sci_b_uart_rxi_handler_install(p_ctrl->p_cfg->rxi_irq, r_sci_b_uart_rxi_handler_select(p_ctrl));
+ #endif
     R_BSP_IrqEnable(p_ctrl->p_cfg->rxi_irq);
     R_BSP_IrqEnable(p_ctrl->p_cfg->eri_irq);
 
@@ -459,6 +503,11 @@ fsp_err_t R_SCI_B_UART_Close (uart_ctrl_t * const p_api_ctrl)
     /* If reception is enabled at build time, disable reception irqs. */
     R_BSP_IrqDisable(p_ctrl->p_cfg->rxi_irq);
     R_BSP_IrqDisable(p_ctrl->p_cfg->eri_irq);
+ #if (SCI_B_UART_CFG_RXI_FAST_PATH)
+
+    /* The next open may use a different configuration, restore the generic handler. */
+    r_sci_b_uart_rxi_handler_install(p_ctrl->p_cfg->rxi_irq, sci_b_uart_rxi_isr);
+ #endif
 #endif
 
 #if SCI_B_UART_CFG_DTC_SUPPORTED
@@ -912,6 +961,47 @@ fsp_err_t R_SCI_B_UART_ReadStop (uart_ctrl_t * const p_api_ctrl, uint32_t * rema
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Switches asynchronous reception between one UART_EVENT_RX_CHAR callback per character and one UART_EVENT_RX_BLOCK
+ * callback per receive FIFO drain. The block event points at the drained characters and flags whether the delimiter
+ * is among them, so a line parser only has to scan blocks that complete a line. Reads started with
+ * R_SCI_B_UART_Read() are not affected.
+ *
+ * @param[in]  p_api_ctrl   Pointer to the UART control block.
+ * @param[in]  enable       true for UART_EVENT_RX_BLOCK, false for UART_EVENT_RX_CHAR.
+ * @param[in]  delimiter    Character reported through delimiter_found, SCI_B_UART_RX_BLOCK_NO_DELIMITER for none.
+ *
+ * @retval  FSP_SUCCESS                  Reception mode changed.
+ * @retval  FSP_ERR_ASSERTION            Pointer to UART control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN             The control block has not been opened.
+ * @retval  FSP_ERR_UNSUPPORTED          Block reception is disabled at build time, or the channel has no receive FIFO
+ *                                       or uses 9-bit data.
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_B_UART_RxBlockSet (uart_ctrl_t * const p_api_ctrl, bool enable, uint32_t delimiter)
+{
+#if (SCI_B_UART_CFG_RX_ENABLE) && (SCI_B_UART_CFG_FIFO_SUPPORT) && (SCI_B_UART_CFG_RX_BLOCK_ENABLE)
+    sci_b_uart_instance_ctrl_t * p_ctrl = (sci_b_uart_instance_ctrl_t *) p_api_ctrl;
+
+ #if (SCI_B_UART_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_ctrl);
+ #endif
+    FSP_ERROR_RETURN(SCI_B_UART_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN((p_ctrl->fifo_depth > 0U) && (1U == p_ctrl->data_bytes), FSP_ERR_UNSUPPORTED);
+
+    /* The RXI handler reads the delimiter before the enable flag. */
+    p_ctrl->rx_block_delimiter = delimiter;
+    p_ctrl->rx_block_enable    = enable;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(enable);
+    FSP_PARAMETER_NOT_USED(delimiter);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /*******************************************************************************************************************//**
  * Calculates baud rate register settings. Evaluates and determines the best possible settings set to the baud rate
  * related registers.
@@ -1446,6 +1536,17 @@ static void r_sci_b_uart_call_callback (sci_b_uart_instance_ctrl_t * p_ctrl, uin
     p_args->event     = event;
     p_args->p_context = p_ctrl->p_context;
 
+#if SCI_B_UART_CFG_RX_BLOCK_ENABLE
+    if (UART_EVENT_RX_BLOCK == event)
+    {
+        /* For block events data carries the number of characters in the receive block. */
+        p_args->p_data          = p_ctrl->rx_block;
+        p_args->length          = data;
+        p_args->delimiter_found = (SCI_B_UART_RX_BLOCK_NO_DELIMITER != p_ctrl->rx_block_delimiter) &&
+                                  (NULL != memchr(p_ctrl->rx_block, (int) p_ctrl->rx_block_delimiter, data));
+    }
+#endif
+
 #if BSP_TZ_SECURE_BUILD
 
     /* p_callback can point to a secure function or a non-secure function. */
@@ -1473,6 +1574,99 @@ static void r_sci_b_uart_call_callback (sci_b_uart_instance_ctrl_t * p_ctrl, uin
     }
 }
 
+#if (SCI_B_UART_CFG_RX_ENABLE) && (SCI_B_UART_CFG_FIFO_SUPPORT) && (SCI_B_UART_CFG_RX_BLOCK_ENABLE)
+
+/*******************************************************************************************************************//**
+ * Empties the receive FIFO into the block buffer and reports each buffer load with UART_EVENT_RX_BLOCK. Characters
+ * arriving while the callback runs are picked up by the next pass.
+ *
+ * @param[in] p_ctrl  Pointer to UART instance control
+ **********************************************************************************************************************/
+static void r_sci_b_uart_rx_block_drain (sci_b_uart_instance_ctrl_t * const p_ctrl)
+{
+    R_SCI_B0_Type * p_reg = p_ctrl->p_reg;
+    uint32_t        count = p_reg->FRSR_b.R;
+
+    while (count > 0U)
+    {
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            p_ctrl->rx_block[i] = p_reg->RDR_BY;
+        }
+
+ #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+        p_ctrl->rx_byte_count += count;
+ #endif
+
+        if (NULL != p_ctrl->p_callback)
+        {
+            r_sci_b_uart_call_callback(p_ctrl, count, UART_EVENT_RX_BLOCK);
+        }
+
+        count = p_reg->FRSR_b.R;
+    }
+}
+
+#endif
+
+#if (SCI_B_UART_CFG_RX_ENABLE) && (SCI_B_UART_CFG_RXI_FAST_PATH)
+
+/*******************************************************************************************************************//**
+ * Picks the RXI handler for the channel configuration. The specialised handlers only cover 8-bit data without flow
+ * control pin, callback memory or TrustZone callback switching. Everything else keeps the generic handler.
+ *
+ * @param[in] p_ctrl  Pointer to UART instance control
+ *
+ * @return    Handler to install
+ **********************************************************************************************************************/
+static fsp_vector_t r_sci_b_uart_rxi_handler_select (sci_b_uart_instance_ctrl_t const * const p_ctrl)
+{
+ #if BSP_TZ_SECURE_BUILD
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+
+    return sci_b_uart_rxi_isr;
+ #else
+    if ((1U != p_ctrl->data_bytes) || (SCI_B_UART_INVALID_16BIT_PARAM != p_ctrl->flow_pin) ||
+        (NULL != p_ctrl->p_callback_memory) || (NULL == p_ctrl->p_callback))
+    {
+        return sci_b_uart_rxi_isr;
+    }
+
+  #if SCI_B_UART_CFG_FIFO_SUPPORT
+    if (p_ctrl->fifo_depth > 0U)
+    {
+        return sci_b_uart_rxi_8bit_fifo_isr;
+    }
+  #endif
+
+    return sci_b_uart_rxi_8bit_isr;
+ #endif
+}
+
+/*******************************************************************************************************************//**
+ * Writes an interrupt handler into the active vector table. The generated table is in flash, so this only takes
+ * effect once the application has copied the table to RAM and pointed VTOR at the copy. Otherwise the generated
+ * entry stays in use.
+ *
+ * @param[in] irq      Interrupt to redirect
+ * @param[in] handler  Handler to install
+ **********************************************************************************************************************/
+static void r_sci_b_uart_rxi_handler_install (IRQn_Type const irq, fsp_vector_t const handler)
+{
+    fsp_vector_t * p_table = (fsp_vector_t *) SCB->VTOR + BSP_CORTEX_VECTOR_TABLE_ENTRIES;
+
+    if ((irq >= 0) && (p_table != g_vector_table) && (p_table[irq] != handler))
+    {
+        p_table[irq] = handler;
+
+        /* Make sure the new entry is used by the next exception entry. */
+        __DSB();
+        __ISB();
+    }
+}
+
+#endif
+
 #if (SCI_B_UART_CFG_TX_ENABLE)
 
 /*******************************************************************************************************************//**
@@ -1494,6 +1688,10 @@ void sci_b_uart_txi_isr (void)
     /* Recover ISR context saved in open. */
     sci_b_uart_instance_ctrl_t * p_ctrl = (sci_b_uart_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
 
+ #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+    p_ctrl->txi_count++;
+ #endif
+
     if ((NULL == p_ctrl->p_cfg->p_transfer_tx) && (0U != p_ctrl->tx_src_bytes))
     {
         /* Fill the FIFO if its used.  Otherwise write data to the TDR. */
@@ -1571,6 +1769,8 @@ void sci_b_uart_txi_isr (void)
  *  - UART_EVENT_RX_COMPLETE: The number of data which has been read reaches to the number specified in R_SCI_B_UART_Read()
  *    if a transfer instance is used for reception.
  *  - UART_EVENT_RX_CHAR: Data is received asynchronously (read has not been called)
+ *  - UART_EVENT_RX_IDLE: The FIFO was drained because the receive timeout expired below the trigger level (FIFO
+ *    channels only). Reported after the UART_EVENT_RX_CHAR events for the drained data.
  *
  * This interrupt also calls the callback function for RTS pin control if it is registered in R_SCI_B_UART_Open(). This is
  * special functionality to expand SCI hardware capability and make RTS/CTS hardware flow control possible. If macro
@@ -1591,6 +1791,11 @@ void sci_b_uart_rxi_isr (void)
     /* Recover ISR context saved in open. */
     sci_b_uart_instance_ctrl_t * p_ctrl = (sci_b_uart_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
 
+ #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+    uint32_t cycles = DWT->CYCCNT;
+    p_ctrl->rxi_count++;
+ #endif
+
  #if SCI_B_UART_CFG_DTC_SUPPORTED
     if ((p_ctrl->p_cfg->p_transfer_rx == NULL) || (0 == p_ctrl->rx_dest_bytes))
  #endif
@@ -1607,6 +1812,19 @@ void sci_b_uart_rxi_isr (void)
 
         uint32_t data;
  #if SCI_B_UART_CFG_FIFO_SUPPORT
+
+        /* The receive data ready flag is set when the FIFO holds fewer bytes than the trigger level and no data has
+         * arrived for 15 ETUs. Sample it before draining so the idle event can be reported afterwards. */
+        uint32_t rx_idle = (p_ctrl->fifo_depth > 0U) ? p_ctrl->p_reg->FRSR_b.DR : 0U;
+
+  #if SCI_B_UART_CFG_RX_BLOCK_ENABLE
+        if (p_ctrl->rx_block_enable && (0U == p_ctrl->rx_dest_bytes))
+        {
+            /* One callback per FIFO drain instead of one per character. */
+            r_sci_b_uart_rx_block_drain(p_ctrl);
+        }
+        else
+  #endif
         do
         {
             if ((p_ctrl->fifo_depth > 0U))
@@ -1640,6 +1858,10 @@ void sci_b_uart_rxi_isr (void)
                 data = p_ctrl->p_reg->RDR_BY;
             }
 
+ #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+            p_ctrl->rx_byte_count += p_ctrl->data_bytes;
+ #endif
+
             if (0 == p_ctrl->rx_dest_bytes)
             {
                 /* If a callback was provided, call it with the argument */
@@ -1673,6 +1895,22 @@ void sci_b_uart_rxi_isr (void)
             p_ctrl->p_reg->CFCLR |= SCI_B_UART_CFCLR_RDRFC_MASK;
         }
 
+        if (rx_idle)
+        {
+            /* Clear the receive data ready flag. */
+            p_ctrl->p_reg->FFCLR = R_SCI_B0_FFCLR_DRC_Msk;
+
+  #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+            p_ctrl->rx_idle_count++;
+  #endif
+
+            /* Tell the application the line went quiet so partially received data can be processed. */
+            if (NULL != p_ctrl->p_callback)
+            {
+                r_sci_b_uart_call_callback(p_ctrl, 0U, UART_EVENT_RX_IDLE);
+            }
+        }
+
  #else
         }
  #endif
@@ -1702,10 +1940,162 @@ void sci_b_uart_rxi_isr (void)
     }
  #endif
 
+ #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+    p_ctrl->rxi_cycles += DWT->CYCCNT - cycles;
+ #endif
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
 
+ #if (SCI_B_UART_CFG_RXI_FAST_PATH)
+
+/*******************************************************************************************************************//**
+ * RXI interrupt processing for 8-bit channels without a receive FIFO, flow control pin or callback memory. Installed
+ * by R_SCI_B_UART_Open() in place of sci_b_uart_rxi_isr(). Reads one byte and reports it with UART_EVENT_RX_CHAR
+ * without the per-byte configuration checks of the generic handler. A read in progress or a changed callback is
+ * handed to the generic handler.
+ * @retval    none
+ **********************************************************************************************************************/
+void sci_b_uart_rxi_8bit_isr (void)
+{
+    /* Save context if RTOS is used */
+    FSP_CONTEXT_SAVE
+
+    IRQn_Type irq = R_FSP_CurrentIrqGet();
+
+    /* Recover ISR context saved in open. */
+    sci_b_uart_instance_ctrl_t * p_ctrl = (sci_b_uart_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
+
+    if ((0U != p_ctrl->rx_dest_bytes) || (NULL != p_ctrl->p_callback_memory) || (NULL == p_ctrl->p_callback))
+    {
+        sci_b_uart_rxi_isr();
+    }
+    else
+    {
+  #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+        uint32_t cycles = DWT->CYCCNT;
+        p_ctrl->rxi_count++;
+        p_ctrl->rx_byte_count++;
+  #endif
+
+        /* Clear pending IRQ to make sure it doesn't fire again after exiting */
+        R_BSP_IrqStatusClear(irq);
+
+        uart_callback_args_t args;
+        args.channel   = p_ctrl->p_cfg->channel;
+        args.p_context = p_ctrl->p_context;
+        args.event     = UART_EVENT_RX_CHAR;
+        args.data      = p_ctrl->p_reg->RDR_BY;
+        p_ctrl->p_callback(&args);
+
+  #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+        p_ctrl->rxi_cycles += DWT->CYCCNT - cycles;
+  #endif
+    }
+
+    /* Restore context if RTOS is used */
+    FSP_CONTEXT_RESTORE
+}
+
+  #if SCI_B_UART_CFG_FIFO_SUPPORT
+
+/*******************************************************************************************************************//**
+ * RXI interrupt processing for 8-bit FIFO channels without flow control pin or callback memory. Installed by
+ * R_SCI_B_UART_Open() in place of sci_b_uart_rxi_isr(). Drains the FIFO in a loop that only reads the data register
+ * and calls the callback, then reports UART_EVENT_RX_IDLE like the generic handler. A read in progress or a changed
+ * callback is handed to the generic handler.
+ * @retval    none
+ **********************************************************************************************************************/
+void sci_b_uart_rxi_8bit_fifo_isr (void)
+{
+    /* Save context if RTOS is used */
+    FSP_CONTEXT_SAVE
+
+    IRQn_Type irq = R_FSP_CurrentIrqGet();
+
+    /* Recover ISR context saved in open. */
+    sci_b_uart_instance_ctrl_t * p_ctrl = (sci_b_uart_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
+
+    if ((0U != p_ctrl->rx_dest_bytes) || (NULL != p_ctrl->p_callback_memory) || (NULL == p_ctrl->p_callback))
+    {
+        sci_b_uart_rxi_isr();
+    }
+    else
+    {
+  #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+        uint32_t cycles = DWT->CYCCNT;
+        p_ctrl->rxi_count++;
+  #endif
+
+        /* Clear pending IRQ to make sure it doesn't fire again after exiting */
+        R_BSP_IrqStatusClear(irq);
+
+        R_SCI_B0_Type * p_reg = p_ctrl->p_reg;
+
+        /* Sample the receive data ready flag before draining, see sci_b_uart_rxi_isr(). */
+        uint32_t rx_idle = p_reg->FRSR_b.DR;
+
+        uart_callback_args_t args;
+        args.channel   = p_ctrl->p_cfg->channel;
+        args.p_context = p_ctrl->p_context;
+
+   #if SCI_B_UART_CFG_RX_BLOCK_ENABLE
+        if (p_ctrl->rx_block_enable)
+        {
+            /* One callback per FIFO drain instead of one per character. */
+            r_sci_b_uart_rx_block_drain(p_ctrl);
+        }
+        else
+   #endif
+        {
+            /* Read the fill level once per pass instead of once per byte. */
+            uint32_t count = p_reg->FRSR_b.R;
+            while (count > 0U)
+            {
+   #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+                p_ctrl->rx_byte_count += count;
+   #endif
+                do
+                {
+                    args.event = UART_EVENT_RX_CHAR;
+                    args.data  = p_reg->RDR_BY;
+                    p_ctrl->p_callback(&args);
+                } while (--count > 0U);
+
+                count = p_reg->FRSR_b.R;
+            }
+        }
+
+        p_reg->CFCLR |= SCI_B_UART_CFCLR_RDRFC_MASK;
+
+        if (rx_idle)
+        {
+            /* Clear the receive data ready flag. */
+            p_reg->FFCLR = R_SCI_B0_FFCLR_DRC_Msk;
+
+   #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+            p_ctrl->rx_idle_count++;
+   #endif
+
+            /* Tell the application the line went quiet so partially received data can be processed. */
+            args.event = UART_EVENT_RX_IDLE;
+            args.data  = 0U;
+            p_ctrl->p_callback(&args);
+        }
+
+  #if SCI_B_UART_CFG_ISR_STATS_ENABLE
+        p_ctrl->rxi_cycles += DWT->CYCCNT - cycles;
+  #endif
+    }
+
+    /* Restore context if RTOS is used */
+    FSP_CONTEXT_RESTORE
+}
+
+  #endif
+ #endif
+
 #endif
 
 #if (SCI_B_UART_CFG_TX_ENABLE)
@@ -0,0 +1,13 @@
+/* generated configuration header file - do not edit */
+#ifndef R_DMAC_CFG_H_
+#define R_DMAC_CFG_H_
+#ifdef __cplusplus
+            extern "C" {
+            #endif
+
+#define DMAC_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+
+#ifdef __cplusplus
+            }
+            #endif
+#endif /* R_DMAC_CFG_H_ */
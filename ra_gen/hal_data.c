@@ -1,6 +1,86 @@
 /* generated HAL source file - do not edit */
 #include "hal_data.h"
 
+dtc_instance_ctrl_t g_transfer_uart2_tx_ctrl;
+
+#if (1 == 1)
+transfer_info_t g_transfer_uart2_tx_info DTC_TRANSFER_INFO_ALIGNMENT =
+{ .transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+  .transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,
+  .transfer_settings_word_b.irq = TRANSFER_IRQ_END,
+  .transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,
+  .transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,
+  .transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,
+  .transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,
+  .p_dest = (void*) NULL,
+  .p_src = (void const*) NULL,
+  .num_blocks = 0,
+  .length = 0, };
+
+#elif (1 > 1)
+/* User is responsible to initialize the array. */
+transfer_info_t g_transfer_uart2_tx_info[1] DTC_TRANSFER_INFO_ALIGNMENT;
+#else
+/* User must call api::reconfigure to enable DTC transfer. */
+#endif
+
+const dtc_extended_cfg_t g_transfer_uart2_tx_cfg_extend =
+{ .activation_source = VECTOR_NUMBER_SCI2_TXI, };
+
+const transfer_cfg_t g_transfer_uart2_tx_cfg =
+{
+#if (1 == 1)
+  .p_info = &g_transfer_uart2_tx_info,
+#elif (1 > 1)
+  .p_info = g_transfer_uart2_tx_info,
+#else
+  .p_info = NULL,
+#endif
+  .p_extend = &g_transfer_uart2_tx_cfg_extend, };
+
+/* Instance structure to use this module. */
+const transfer_instance_t g_transfer_uart2_tx =
+{ .p_ctrl = &g_transfer_uart2_tx_ctrl, .p_cfg = &g_transfer_uart2_tx_cfg, .p_api = &g_transfer_on_dtc };
+dtc_instance_ctrl_t g_transfer_uart2_rx_ctrl;
+
+#if (1 == 1)
+transfer_info_t g_transfer_uart2_rx_info DTC_TRANSFER_INFO_ALIGNMENT =
+{ .transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,
+  .transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_DESTINATION,
+  .transfer_settings_word_b.irq = TRANSFER_IRQ_END,
+  .transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,
+  .transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+  .transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,
+  .transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,
+  .p_dest = (void*) NULL,
+  .p_src = (void const*) NULL,
+  .num_blocks = 0,
+  .length = 0, };
+
+#elif (1 > 1)
+/* User is responsible to initialize the array. */
+transfer_info_t g_transfer_uart2_rx_info[1] DTC_TRANSFER_INFO_ALIGNMENT;
+#else
+/* User must call api::reconfigure to enable DTC transfer. */
+#endif
+
+const dtc_extended_cfg_t g_transfer_uart2_rx_cfg_extend =
+{ .activation_source = VECTOR_NUMBER_SCI2_RXI, };
+
+const transfer_cfg_t g_transfer_uart2_rx_cfg =
+{
+#if (1 == 1)
+  .p_info = &g_transfer_uart2_rx_info,
+#elif (1 > 1)
+  .p_info = g_transfer_uart2_rx_info,
+#else
+  .p_info = NULL,
+#endif
+  .p_extend = &g_transfer_uart2_rx_cfg_extend, };
+
+/* Instance structure to use this module. */
+const transfer_instance_t g_transfer_uart2_rx =
+{ .p_ctrl = &g_transfer_uart2_rx_ctrl, .p_cfg = &g_transfer_uart2_rx_cfg, .p_api = &g_transfer_on_dtc };
 sci_b_uart_instance_ctrl_t g_uart2_ctrl;
 
 sci_b_baud_setting_t g_uart2_baud_setting =
@@ -33,15 +113,15 @@ const uart_cfg_t g_uart2_cfg =
           uart_pc_callback,
   .p_context = NULL, .p_extend = &g_uart2_cfg_extend,
 #define RA_NOT_DEFINED (1)
-#if (RA_NOT_DEFINED == RA_NOT_DEFINED)
-  .p_transfer_tx = NULL,
+#if (RA_NOT_DEFINED == g_transfer_uart2_tx)
+                .p_transfer_tx       = NULL,
 #else
-                .p_transfer_tx       = &RA_NOT_DEFINED,
+  .p_transfer_tx = &g_transfer_uart2_tx,
 #endif
-#if (RA_NOT_DEFINED == RA_NOT_DEFINED)
-  .p_transfer_rx = NULL,
+#if (RA_NOT_DEFINED == g_transfer_uart2_rx)
+                .p_transfer_rx       = NULL,
 #else
-                .p_transfer_rx       = &RA_NOT_DEFINED,
+  .p_transfer_rx = &g_transfer_uart2_rx,
 #endif
 #undef RA_NOT_DEFINED
   .rxi_ipl = (12),
@@ -71,6 +151,86 @@ const uart_cfg_t g_uart2_cfg =
 /* Instance structure to use this module. */
 const uart_instance_t g_uart2 =
 { .p_ctrl = &g_uart2_ctrl, .p_cfg = &g_uart2_cfg, .p_api = &g_uart_on_sci_b };
+dtc_instance_ctrl_t g_transfer_uart1_tx_ctrl;
+
+#if (1 == 1)
+transfer_info_t g_transfer_uart1_tx_info DTC_TRANSFER_INFO_ALIGNMENT =
+{ .transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+  .transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,
+  .transfer_settings_word_b.irq = TRANSFER_IRQ_END,
+  .transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,
+  .transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,
+  .transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,
+  .transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,
+  .p_dest = (void*) NULL,
+  .p_src = (void const*) NULL,
+  .num_blocks = 0,
+  .length = 0, };
+
+#elif (1 > 1)
+/* User is responsible to initialize the array. */
+transfer_info_t g_transfer_uart1_tx_info[1] DTC_TRANSFER_INFO_ALIGNMENT;
+#else
+/* User must call api::reconfigure to enable DTC transfer. */
+#endif
+
+const dtc_extended_cfg_t g_transfer_uart1_tx_cfg_extend =
+{ .activation_source = VECTOR_NUMBER_SCI1_TXI, };
+
+const transfer_cfg_t g_transfer_uart1_tx_cfg =
+{
+#if (1 == 1)
+  .p_info = &g_transfer_uart1_tx_info,
+#elif (1 > 1)
+  .p_info = g_transfer_uart1_tx_info,
+#else
+  .p_info = NULL,
+#endif
+  .p_extend = &g_transfer_uart1_tx_cfg_extend, };
+
+/* Instance structure to use this module. */
+const transfer_instance_t g_transfer_uart1_tx =
+{ .p_ctrl = &g_transfer_uart1_tx_ctrl, .p_cfg = &g_transfer_uart1_tx_cfg, .p_api = &g_transfer_on_dtc };
+dtc_instance_ctrl_t g_transfer_uart1_rx_ctrl;
+
+#if (1 == 1)
+transfer_info_t g_transfer_uart1_rx_info DTC_TRANSFER_INFO_ALIGNMENT =
+{ .transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,
+  .transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_DESTINATION,
+  .transfer_settings_word_b.irq = TRANSFER_IRQ_END,
+  .transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,
+  .transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+  .transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,
+  .transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,
+  .p_dest = (void*) NULL,
+  .p_src = (void const*) NULL,
+  .num_blocks = 0,
+  .length = 0, };
+
+#elif (1 > 1)
+/* User is responsible to initialize the array. */
+transfer_info_t g_transfer_uart1_rx_info[1] DTC_TRANSFER_INFO_ALIGNMENT;
+#else
+/* User must call api::reconfigure to enable DTC transfer. */
+#endif
+
+const dtc_extended_cfg_t g_transfer_uart1_rx_cfg_extend =
+{ .activation_source = VECTOR_NUMBER_SCI1_RXI, };
+
+const transfer_cfg_t g_transfer_uart1_rx_cfg =
+{
+#if (1 == 1)
+  .p_info = &g_transfer_uart1_rx_info,
+#elif (1 > 1)
+  .p_info = g_transfer_uart1_rx_info,
+#else
+  .p_info = NULL,
+#endif
+  .p_extend = &g_transfer_uart1_rx_cfg_extend, };
+
+/* Instance structure to use this module. */
+const transfer_instance_t g_transfer_uart1_rx =
+{ .p_ctrl = &g_transfer_uart1_rx_ctrl, .p_cfg = &g_transfer_uart1_rx_cfg, .p_api = &g_transfer_on_dtc };
 sci_b_uart_instance_ctrl_t g_uart1_ctrl;
 
 sci_b_baud_setting_t g_uart1_baud_setting =
@@ -103,15 +263,15 @@ const uart_cfg_t g_uart1_cfg =
           uart_pc_callback,
   .p_context = NULL, .p_extend = &g_uart1_cfg_extend,
 #define RA_NOT_DEFINED (1)
-#if (RA_NOT_DEFINED == RA_NOT_DEFINED)
-  .p_transfer_tx = NULL,
+#if (RA_NOT_DEFINED == g_transfer_uart1_tx)
+                .p_transfer_tx       = NULL,
 #else
-                .p_transfer_tx       = &RA_NOT_DEFINED,
+  .p_transfer_tx = &g_transfer_uart1_tx,
 #endif
-#if (RA_NOT_DEFINED == RA_NOT_DEFINED)
-  .p_transfer_rx = NULL,
+#if (RA_NOT_DEFINED == g_transfer_uart1_rx)
+                .p_transfer_rx       = NULL,
 #else
-                .p_transfer_rx       = &RA_NOT_DEFINED,
+  .p_transfer_rx = &g_transfer_uart1_rx,
 #endif
 #undef RA_NOT_DEFINED
   .rxi_ipl = (12),
@@ -141,6 +301,86 @@ const uart_cfg_t g_uart1_cfg =
 /* Instance structure to use this module. */
 const uart_instance_t g_uart1 =
 { .p_ctrl = &g_uart1_ctrl, .p_cfg = &g_uart1_cfg, .p_api = &g_uart_on_sci_b };
+dtc_instance_ctrl_t g_transfer_uart0_tx_ctrl;
+
+#if (1 == 1)
+transfer_info_t g_transfer_uart0_tx_info DTC_TRANSFER_INFO_ALIGNMENT =
+{ .transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+  .transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,
+  .transfer_settings_word_b.irq = TRANSFER_IRQ_END,
+  .transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,
+  .transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,
+  .transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,
+  .transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,
+  .p_dest = (void*) NULL,
+  .p_src = (void const*) NULL,
+  .num_blocks = 0,
+  .length = 0, };
+
+#elif (1 > 1)
+/* User is responsible to initialize the array. */
+transfer_info_t g_transfer_uart0_tx_info[1] DTC_TRANSFER_INFO_ALIGNMENT;
+#else
+/* User must call api::reconfigure to enable DTC transfer. */
+#endif
+
+const dtc_extended_cfg_t g_transfer_uart0_tx_cfg_extend =
+{ .activation_source = VECTOR_NUMBER_SCI0_TXI, };
+
+const transfer_cfg_t g_transfer_uart0_tx_cfg =
+{
+#if (1 == 1)
+  .p_info = &g_transfer_uart0_tx_info,
+#elif (1 > 1)
+  .p_info = g_transfer_uart0_tx_info,
+#else
+  .p_info = NULL,
+#endif
+  .p_extend = &g_transfer_uart0_tx_cfg_extend, };
+
+/* Instance structure to use this module. */
+const transfer_instance_t g_transfer_uart0_tx =
+{ .p_ctrl = &g_transfer_uart0_tx_ctrl, .p_cfg = &g_transfer_uart0_tx_cfg, .p_api = &g_transfer_on_dtc };
+dtc_instance_ctrl_t g_transfer_uart0_rx_ctrl;
+
+#if (1 == 1)
+transfer_info_t g_transfer_uart0_rx_info DTC_TRANSFER_INFO_ALIGNMENT =
+{ .transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,
+  .transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_DESTINATION,
+  .transfer_settings_word_b.irq = TRANSFER_IRQ_END,
+  .transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,
+  .transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+  .transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,
+  .transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,
+  .p_dest = (void*) NULL,
+  .p_src = (void const*) NULL,
+  .num_blocks = 0,
+  .length = 0, };
+
+#elif (1 > 1)
+/* User is responsible to initialize the array. */
+transfer_info_t g_transfer_uart0_rx_info[1] DTC_TRANSFER_INFO_ALIGNMENT;
+#else
+/* User must call api::reconfigure to enable DTC transfer. */
+#endif
+
+const dtc_extended_cfg_t g_transfer_uart0_rx_cfg_extend =
+{ .activation_source = VECTOR_NUMBER_SCI0_RXI, };
+
+const transfer_cfg_t g_transfer_uart0_rx_cfg =
+{
+#if (1 == 1)
+  .p_info = &g_transfer_uart0_rx_info,
+#elif (1 > 1)
+  .p_info = g_transfer_uart0_rx_info,
+#else
+  .p_info = NULL,
+#endif
+  .p_extend = &g_transfer_uart0_rx_cfg_extend, };
+
+/* Instance structure to use this module. */
+const transfer_instance_t g_transfer_uart0_rx =
+{ .p_ctrl = &g_transfer_uart0_rx_ctrl, .p_cfg = &g_transfer_uart0_rx_cfg, .p_api = &g_transfer_on_dtc };
 sci_b_uart_instance_ctrl_t g_uart0_ctrl;
 
 sci_b_baud_setting_t g_uart0_baud_setting =
@@ -173,15 +413,15 @@ const uart_cfg_t g_uart0_cfg =
           user_uart_callback,
   .p_context = NULL, .p_extend = &g_uart0_cfg_extend,
 #define RA_NOT_DEFINED (1)
-#if (RA_NOT_DEFINED == RA_NOT_DEFINED)
-  .p_transfer_tx = NULL,
+#if (RA_NOT_DEFINED == g_transfer_uart0_tx)
+                .p_transfer_tx       = NULL,
 #else
-                .p_transfer_tx       = &RA_NOT_DEFINED,
+  .p_transfer_tx = &g_transfer_uart0_tx,
 #endif
-#if (RA_NOT_DEFINED == RA_NOT_DEFINED)
-  .p_transfer_rx = NULL,
+#if (RA_NOT_DEFINED == g_transfer_uart0_rx)
+                .p_transfer_rx       = NULL,
 #else
-                .p_transfer_rx       = &RA_NOT_DEFINED,
+  .p_transfer_rx = &g_transfer_uart0_rx,
 #endif
 #undef RA_NOT_DEFINED
   .rxi_ipl = (12),
@@ -306,6 +546,250 @@ const timer_cfg_t g_timer_cfg =
 /* Instance structure to use this module. */
 const timer_instance_t g_timer =
 { .p_ctrl = &g_timer_ctrl, .p_cfg = &g_timer_cfg, .p_api = &g_timer_on_gpt };
+gpt_instance_ctrl_t g_timer_audio_ctrl;
+#if 0
+const gpt_extended_pwm_cfg_t g_timer_audio_pwm_extend =
+{
+    .trough_ipl          = (BSP_IRQ_DISABLED),
+#if defined(VECTOR_NUMBER_GPT1_COUNTER_UNDERFLOW)
+    .trough_irq          = VECTOR_NUMBER_GPT1_COUNTER_UNDERFLOW,
+#else
+    .trough_irq          = FSP_INVALID_VECTOR,
+#endif
+    .poeg_link           = GPT_POEG_LINK_POEG0,
+    .output_disable      = (gpt_output_disable_t) ( GPT_OUTPUT_DISABLE_NONE),
+    .adc_trigger         = (gpt_adc_trigger_t) ( GPT_ADC_TRIGGER_NONE),
+    .dead_time_count_up  = 0,
+    .dead_time_count_down = 0,
+    .adc_a_compare_match = 0,
+    .adc_b_compare_match = 0,
+    .interrupt_skip_source = GPT_INTERRUPT_SKIP_SOURCE_NONE,
+    .interrupt_skip_count  = GPT_INTERRUPT_SKIP_COUNT_0,
+    .interrupt_skip_adc    = GPT_INTERRUPT_SKIP_ADC_NONE,
+    .gtioca_disable_setting = GPT_GTIOC_DISABLE_PROHIBITED,
+    .gtiocb_disable_setting = GPT_GTIOC_DISABLE_PROHIBITED,
+};
+#endif
+const gpt_extended_cfg_t g_timer_audio_extend =
+        { .gtioca =
+        { .output_enabled = true, .stop_level = GPT_PIN_LEVEL_LOW },
+          .gtiocb =
+          { .output_enabled = false, .stop_level = GPT_PIN_LEVEL_LOW },
+          .start_source = (gpt_source_t) (GPT_SOURCE_NONE), .stop_source = (gpt_source_t) (GPT_SOURCE_NONE), .clear_source =
+                  (gpt_source_t) (GPT_SOURCE_NONE),
+          .count_up_source = (gpt_source_t) (GPT_SOURCE_NONE), .count_down_source = (gpt_source_t) (GPT_SOURCE_NONE), .capture_a_source =
+                  (gpt_source_t) (GPT_SOURCE_NONE),
+          .capture_b_source = (gpt_source_t) (GPT_SOURCE_NONE), .capture_a_ipl = (BSP_IRQ_DISABLED), .capture_b_ipl =
+                  (BSP_IRQ_DISABLED),
+#if defined(VECTOR_NUMBER_GPT1_CAPTURE_COMPARE_A)
+    .capture_a_irq       = VECTOR_NUMBER_GPT1_CAPTURE_COMPARE_A,
+#else
+          .capture_a_irq = FSP_INVALID_VECTOR,
+#endif
+#if defined(VECTOR_NUMBER_GPT1_CAPTURE_COMPARE_B)
+    .capture_b_irq       = VECTOR_NUMBER_GPT1_CAPTURE_COMPARE_B,
+#else
+          .capture_b_irq = FSP_INVALID_VECTOR,
+#endif
+          .compare_match_value =
+          { /* CMP_A */0x0, /* CMP_B */0x0 },
+          .compare_match_status = (0U << 1U) | 0U, .capture_filter_gtioca = GPT_CAPTURE_FILTER_NONE, .capture_filter_gtiocb =
+                  GPT_CAPTURE_FILTER_NONE,
+#if 0
+    .p_pwm_cfg                   = &g_timer_audio_pwm_extend,
+#else
+          .p_pwm_cfg = NULL,
+#endif
+#if 0
+    .gtior_setting.gtior_b.gtioa  = (0U << 4U) | (0U << 2U) | (0U << 0U),
+    .gtior_setting.gtior_b.oadflt = (uint32_t) GPT_PIN_LEVEL_LOW,
+    .gtior_setting.gtior_b.oahld  = 0U,
+    .gtior_setting.gtior_b.oae    = (uint32_t) true,
+    .gtior_setting.gtior_b.oadf   = (uint32_t) GPT_GTIOC_DISABLE_PROHIBITED,
+    .gtior_setting.gtior_b.nfaen  = ((uint32_t) GPT_CAPTURE_FILTER_NONE & 1U),
+    .gtior_setting.gtior_b.nfcsa  = ((uint32_t) GPT_CAPTURE_FILTER_NONE >> 1U),
+    .gtior_setting.gtior_b.gtiob  = (0U << 4U) | (0U << 2U) | (0U << 0U),
+    .gtior_setting.gtior_b.obdflt = (uint32_t) GPT_PIN_LEVEL_LOW,
+    .gtior_setting.gtior_b.obhld  = 0U,
+    .gtior_setting.gtior_b.obe    = (uint32_t) false,
+    .gtior_setting.gtior_b.obdf   = (uint32_t) GPT_GTIOC_DISABLE_PROHIBITED,
+    .gtior_setting.gtior_b.nfben  = ((uint32_t) GPT_CAPTURE_FILTER_NONE & 1U),
+    .gtior_setting.gtior_b.nfcsb  = ((uint32_t) GPT_CAPTURE_FILTER_NONE >> 1U),
+#else
+          .gtior_setting.gtior = 0U,
+#endif
+        };
+
+const timer_cfg_t g_timer_audio_cfg =
+{ .mode = TIMER_MODE_PWM,
+/* Actual period: 0.0000625 seconds. Actual duty: 50%. */.period_counts = (uint32_t) 0x1d4c,
+  .duty_cycle_counts = 0xea6, .source_div = (timer_source_div_t) 0, .channel = 1, .p_callback = NULL,
+  /** If NULL then do not add & */
+#if defined(NULL)
+    .p_context           = NULL,
+#else
+  .p_context = &NULL,
+#endif
+  .p_extend = &g_timer_audio_extend,
+  .cycle_end_ipl = (BSP_IRQ_DISABLED),
+#if defined(VECTOR_NUMBER_GPT1_COUNTER_OVERFLOW)
+    .cycle_end_irq       = VECTOR_NUMBER_GPT1_COUNTER_OVERFLOW,
+#else
+  .cycle_end_irq = FSP_INVALID_VECTOR,
+#endif
+        };
+/* Instance structure to use this module. */
+const timer_instance_t g_timer_audio =
+{ .p_ctrl = &g_timer_audio_ctrl, .p_cfg = &g_timer_audio_cfg, .p_api = &g_timer_on_gpt };
+gpt_instance_ctrl_t g_timer_autobaud_ctrl;
+#if 0
+const gpt_extended_pwm_cfg_t g_timer_autobaud_pwm_extend =
+{
+    .trough_ipl          = (BSP_IRQ_DISABLED),
+#if defined(VECTOR_NUMBER_GPT4_COUNTER_UNDERFLOW)
+    .trough_irq          = VECTOR_NUMBER_GPT4_COUNTER_UNDERFLOW,
+#else
+    .trough_irq          = FSP_INVALID_VECTOR,
+#endif
+    .poeg_link           = GPT_POEG_LINK_POEG0,
+    .output_disable      = (gpt_output_disable_t) ( GPT_OUTPUT_DISABLE_NONE),
+    .adc_trigger         = (gpt_adc_trigger_t) ( GPT_ADC_TRIGGER_NONE),
+    .dead_time_count_up  = 0,
+    .dead_time_count_down = 0,
+    .adc_a_compare_match = 0,
+    .adc_b_compare_match = 0,
+    .interrupt_skip_source = GPT_INTERRUPT_SKIP_SOURCE_NONE,
+    .interrupt_skip_count  = GPT_INTERRUPT_SKIP_COUNT_0,
+    .interrupt_skip_adc    = GPT_INTERRUPT_SKIP_ADC_NONE,
+    .gtioca_disable_setting = GPT_GTIOC_DISABLE_PROHIBITED,
+    .gtiocb_disable_setting = GPT_GTIOC_DISABLE_PROHIBITED,
+};
+#endif
+const gpt_extended_cfg_t g_timer_autobaud_extend =
+        { .gtioca =
+        { .output_enabled = false, .stop_level = GPT_PIN_LEVEL_LOW },
+          .gtiocb =
+          { .output_enabled = false, .stop_level = GPT_PIN_LEVEL_LOW },
+          .start_source = (gpt_source_t) (GPT_SOURCE_NONE), .stop_source = (gpt_source_t) (GPT_SOURCE_NONE), .clear_source =
+                  (gpt_source_t) (GPT_SOURCE_NONE),
+          .count_up_source = (gpt_source_t) (GPT_SOURCE_NONE), .count_down_source = (gpt_source_t) (GPT_SOURCE_NONE), .capture_a_source =
+                  (gpt_source_t) (GPT_SOURCE_GTIOCA_RISING_WHILE_GTIOCB_LOW | GPT_SOURCE_GTIOCA_RISING_WHILE_GTIOCB_HIGH | GPT_SOURCE_GTIOCA_FALLING_WHILE_GTIOCB_LOW | GPT_SOURCE_GTIOCA_FALLING_WHILE_GTIOCB_HIGH | GPT_SOURCE_NONE),
+          .capture_b_source = (gpt_source_t) (GPT_SOURCE_NONE), .capture_a_ipl = (12), .capture_b_ipl =
+                  (BSP_IRQ_DISABLED),
+#if defined(VECTOR_NUMBER_GPT4_CAPTURE_COMPARE_A)
+    .capture_a_irq       = VECTOR_NUMBER_GPT4_CAPTURE_COMPARE_A,
+#else
+          .capture_a_irq = FSP_INVALID_VECTOR,
+#endif
+#if defined(VECTOR_NUMBER_GPT4_CAPTURE_COMPARE_B)
+    .capture_b_irq       = VECTOR_NUMBER_GPT4_CAPTURE_COMPARE_B,
+#else
+          .capture_b_irq = FSP_INVALID_VECTOR,
+#endif
+          .compare_match_value =
+          { /* CMP_A */0x0, /* CMP_B */0x0 },
+          .compare_match_status = (0U << 1U) | 0U, .capture_filter_gtioca = GPT_CAPTURE_FILTER_NONE, .capture_filter_gtiocb =
+                  GPT_CAPTURE_FILTER_NONE,
+#if 0
+    .p_pwm_cfg                   = &g_timer_autobaud_pwm_extend,
+#else
+          .p_pwm_cfg = NULL,
+#endif
+#if 0
+    .gtior_setting.gtior_b.gtioa  = (0U << 4U) | (0U << 2U) | (0U << 0U),
+    .gtior_setting.gtior_b.oadflt = (uint32_t) GPT_PIN_LEVEL_LOW,
+    .gtior_setting.gtior_b.oahld  = 0U,
+    .gtior_setting.gtior_b.oae    = (uint32_t) false,
+    .gtior_setting.gtior_b.oadf   = (uint32_t) GPT_GTIOC_DISABLE_PROHIBITED,
+    .gtior_setting.gtior_b.nfaen  = ((uint32_t) GPT_CAPTURE_FILTER_NONE & 1U),
+    .gtior_setting.gtior_b.nfcsa  = ((uint32_t) GPT_CAPTURE_FILTER_NONE >> 1U),
+    .gtior_setting.gtior_b.gtiob  = (0U << 4U) | (0U << 2U) | (0U << 0U),
+    .gtior_setting.gtior_b.obdflt = (uint32_t) GPT_PIN_LEVEL_LOW,
+    .gtior_setting.gtior_b.obhld  = 0U,
+    .gtior_setting.gtior_b.obe    = (uint32_t) false,
+    .gtior_setting.gtior_b.obdf   = (uint32_t) GPT_GTIOC_DISABLE_PROHIBITED,
+    .gtior_setting.gtior_b.nfben  = ((uint32_t) GPT_CAPTURE_FILTER_NONE & 1U),
+    .gtior_setting.gtior_b.nfcsb  = ((uint32_t) GPT_CAPTURE_FILTER_NONE >> 1U),
+#else
+          .gtior_setting.gtior = 0U,
+#endif
+        };
+
+const timer_cfg_t g_timer_autobaud_cfg =
+{ .mode = TIMER_MODE_PERIODIC,
+/* Actual period: 35.79139413333333 seconds. Actual duty: 50%. */.period_counts = (uint32_t) 0x100000000,
+  .duty_cycle_counts = 0x80000000, .source_div = (timer_source_div_t) 0, .channel = 4, .p_callback = uart_autobaud_callback,
+  /** If NULL then do not add & */
+#if defined(NULL)
+    .p_context           = NULL,
+#else
+  .p_context = &NULL,
+#endif
+  .p_extend = &g_timer_autobaud_extend,
+  .cycle_end_ipl = (BSP_IRQ_DISABLED),
+#if defined(VECTOR_NUMBER_GPT4_COUNTER_OVERFLOW)
+    .cycle_end_irq       = VECTOR_NUMBER_GPT4_COUNTER_OVERFLOW,
+#else
+  .cycle_end_irq = FSP_INVALID_VECTOR,
+#endif
+        };
+/* Instance structure to use this module. */
+const timer_instance_t g_timer_autobaud =
+{ .p_ctrl = &g_timer_autobaud_ctrl, .p_cfg = &g_timer_autobaud_cfg, .p_api = &g_timer_on_gpt };
+dmac_instance_ctrl_t g_transfer_dmac_uart2_rx_ctrl;
+transfer_info_t g_transfer_dmac_uart2_rx_info =
+{ .transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,
+  .transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,
+  .transfer_settings_word_b.irq = TRANSFER_IRQ_EACH,
+  .transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,
+  .transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+  .transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,
+  .transfer_settings_word_b.mode = TRANSFER_MODE_REPEAT,
+  .p_dest = (void*) NULL,
+  .p_src = (void const*) &R_SCI_B2->RDR_BY,
+  .num_blocks = 2,
+  .length = 512, };
+const dmac_extended_cfg_t g_transfer_dmac_uart2_rx_extend =
+{ .offset = 1, .src_buffer_size = 1,
+#if defined(VECTOR_NUMBER_DMAC0_INT)
+  .irq = VECTOR_NUMBER_DMAC0_INT,
+#else
+  .irq = FSP_INVALID_VECTOR,
+#endif
+  .ipl = (12),
+  .channel = 0, .p_callback = uart_pc_rx_dmac_callback, .p_context = NULL, .activation_source = ELC_EVENT_SCI2_RXI, };
+const transfer_cfg_t g_transfer_dmac_uart2_rx_cfg =
+{ .p_info = &g_transfer_dmac_uart2_rx_info, .p_extend = &g_transfer_dmac_uart2_rx_extend, };
+/* Instance structure to use this module. */
+const transfer_instance_t g_transfer_dmac_uart2_rx =
+{ .p_ctrl = &g_transfer_dmac_uart2_rx_ctrl, .p_cfg = &g_transfer_dmac_uart2_rx_cfg, .p_api = &g_transfer_on_dmac };
+dmac_instance_ctrl_t g_transfer_dmac_audio_ctrl;
+transfer_info_t g_transfer_dmac_audio_info =
+{ .transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+  .transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_DESTINATION,
+  .transfer_settings_word_b.irq = TRANSFER_IRQ_EACH,
+  .transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,
+  .transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,
+  .transfer_settings_word_b.size = TRANSFER_SIZE_4_BYTE,
+  .transfer_settings_word_b.mode = TRANSFER_MODE_REPEAT,
+  .p_dest = (void*) &R_GPT1->GTCCR[2],
+  .p_src = (void const*) NULL,
+  .num_blocks = 2,
+  .length = 256, };
+const dmac_extended_cfg_t g_transfer_dmac_audio_extend =
+{ .offset = 1, .src_buffer_size = 1,
+#if defined(VECTOR_NUMBER_DMAC1_INT)
+  .irq = VECTOR_NUMBER_DMAC1_INT,
+#else
+  .irq = FSP_INVALID_VECTOR,
+#endif
+  .ipl = (12),
+  .channel = 1, .p_callback = audio_pwm_dmac_callback, .p_context = NULL, .activation_source = ELC_EVENT_GPT1_COUNTER_OVERFLOW, };
+const transfer_cfg_t g_transfer_dmac_audio_cfg =
+{ .p_info = &g_transfer_dmac_audio_info, .p_extend = &g_transfer_dmac_audio_extend, };
+/* Instance structure to use this module. */
+const transfer_instance_t g_transfer_dmac_audio =
+{ .p_ctrl = &g_transfer_dmac_audio_ctrl, .p_cfg = &g_transfer_dmac_audio_cfg, .p_api = &g_transfer_on_dmac };
 void g_hal_init(void)
 {
     g_common_init ();
@@ -4,11 +4,26 @@
 #include <stdint.h>
 #include "bsp_api.h"
 #include "common_data.h"
+#include "r_dtc.h"
+#include "r_dmac.h"
+#include "r_transfer_api.h"
 #include "r_sci_b_uart.h"
 #include "r_uart_api.h"
 #include "r_gpt.h"
 #include "r_timer_api.h"
 FSP_HEADER
+/* Transfer on DTC Instance. */
+extern const transfer_instance_t g_transfer_uart2_tx;
+
+/** Access the DTC instance using these structures when calling API functions directly (::p_api is not used). */
+extern dtc_instance_ctrl_t g_transfer_uart2_tx_ctrl;
+extern const transfer_cfg_t g_transfer_uart2_tx_cfg;
+/* Transfer on DTC Instance. */
+extern const transfer_instance_t g_transfer_uart2_rx;
+
+/** Access the DTC instance using these structures when calling API functions directly (::p_api is not used). */
+extern dtc_instance_ctrl_t g_transfer_uart2_rx_ctrl;
+extern const transfer_cfg_t g_transfer_uart2_rx_cfg;
 /** UART on SCI Instance. */
 extern const uart_instance_t g_uart2;
 
@@ -20,6 +35,18 @@ extern const sci_b_uart_extended_cfg_t g_uart2_cfg_extend;
 #ifndef uart_pc_callback
 void uart_pc_callback(uart_callback_args_t *p_args);
 #endif
+/* Transfer on DTC Instance. */
+extern const transfer_instance_t g_transfer_uart1_tx;
+
+/** Access the DTC instance using these structures when calling API functions directly (::p_api is not used). */
+extern dtc_instance_ctrl_t g_transfer_uart1_tx_ctrl;
+extern const transfer_cfg_t g_transfer_uart1_tx_cfg;
+/* Transfer on DTC Instance. */
+extern const transfer_instance_t g_transfer_uart1_rx;
+
+/** Access the DTC instance using these structures when calling API functions directly (::p_api is not used). */
+extern dtc_instance_ctrl_t g_transfer_uart1_rx_ctrl;
+extern const transfer_cfg_t g_transfer_uart1_rx_cfg;
 /** UART on SCI Instance. */
 extern const uart_instance_t g_uart1;
 
@@ -31,6 +58,18 @@ extern const sci_b_uart_extended_cfg_t g_uart1_cfg_extend;
 #ifndef uart_pc_callback
 void uart_pc_callback(uart_callback_args_t *p_args);
 #endif
+/* Transfer on DTC Instance. */
+extern const transfer_instance_t g_transfer_uart0_tx;
+
+/** Access the DTC instance using these structures when calling API functions directly (::p_api is not used). */
+extern dtc_instance_ctrl_t g_transfer_uart0_tx_ctrl;
+extern const transfer_cfg_t g_transfer_uart0_tx_cfg;
+/* Transfer on DTC Instance. */
+extern const transfer_instance_t g_transfer_uart0_rx;
+
+/** Access the DTC instance using these structures when calling API functions directly (::p_api is not used). */
+extern dtc_instance_ctrl_t g_transfer_uart0_rx_ctrl;
+extern const transfer_cfg_t g_transfer_uart0_rx_cfg;
 /** UART on SCI Instance. */
 extern const uart_instance_t g_uart0;
 
@@ -52,6 +91,46 @@ extern const timer_cfg_t g_timer_cfg;
 #ifndef NULL
 void NULL(timer_callback_args_t *p_args);
 #endif
+/** Timer on GPT Instance. */
+extern const timer_instance_t g_timer_audio;
+
+/** Access the GPT instance using these structures when calling API functions directly (::p_api is not used). */
+extern gpt_instance_ctrl_t g_timer_audio_ctrl;
+extern const timer_cfg_t g_timer_audio_cfg;
+
+#ifndef NULL
+void NULL(timer_callback_args_t *p_args);
+#endif
+/** Timer on GPT Instance. */
+extern const timer_instance_t g_timer_autobaud;
+
+/** Access the GPT instance using these structures when calling API functions directly (::p_api is not used). */
+extern gpt_instance_ctrl_t g_timer_autobaud_ctrl;
+extern const timer_cfg_t g_timer_autobaud_cfg;
+
+#ifndef uart_autobaud_callback
+void uart_autobaud_callback(timer_callback_args_t *p_args);
+#endif
+/* Transfer on DMAC Instance. */
+extern const transfer_instance_t g_transfer_dmac_uart2_rx;
+
+/** Access the DMAC instance using these structures when calling API functions directly (::p_api is not used). */
+extern dmac_instance_ctrl_t g_transfer_dmac_uart2_rx_ctrl;
+extern const transfer_cfg_t g_transfer_dmac_uart2_rx_cfg;
+
+#ifndef uart_pc_rx_dmac_callback
+void uart_pc_rx_dmac_callback(transfer_callback_args_t *p_args);
+#endif
+/* Transfer on DMAC Instance. */
+extern const transfer_instance_t g_transfer_dmac_audio;
+
+/** Access the DMAC instance using these structures when calling API functions directly (::p_api is not used). */
+extern dmac_instance_ctrl_t g_transfer_dmac_audio_ctrl;
+extern const transfer_cfg_t g_transfer_dmac_audio_cfg;
+
+#ifndef audio_pwm_dmac_callback
+void audio_pwm_dmac_callback(transfer_callback_args_t *p_args);
+#endif
 void hal_entry(void);
 void g_hal_init(void);
 FSP_FOOTER
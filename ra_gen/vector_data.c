@@ -16,6 +16,9 @@
             [9] = sci_b_uart_txi_isr, /* SCI2 TXI (Transmit data empty) */
             [10] = sci_b_uart_tei_isr, /* SCI2 TEI (Transmit end) */
             [11] = sci_b_uart_eri_isr, /* SCI2 ERI (Receive error) */
+            [12] = dmac_int_isr, /* DMAC0 INT (DMAC0 transfer end) */
+            [13] = gpt_capture_compare_a_isr, /* GPT4 CAPTURE COMPARE A (Compare match A) */
+            [14] = dmac_int_isr, /* DMAC1 INT (DMAC1 transfer end) */
         };
         #if BSP_FEATURE_ICU_HAS_IELSR
         const bsp_interrupt_event_t g_interrupt_event_link_select[BSP_ICU_VECTOR_MAX_ENTRIES] =
@@ -32,6 +35,9 @@
             [9] = BSP_PRV_VECT_ENUM(EVENT_SCI2_TXI,GROUP1), /* SCI2 TXI (Transmit data empty) */
             [10] = BSP_PRV_VECT_ENUM(EVENT_SCI2_TEI,GROUP2), /* SCI2 TEI (Transmit end) */
             [11] = BSP_PRV_VECT_ENUM(EVENT_SCI2_ERI,GROUP3), /* SCI2 ERI (Receive error) */
+            [12] = BSP_PRV_VECT_ENUM(EVENT_DMAC0_INT,GROUP4), /* DMAC0 INT (DMAC0 transfer end) */
+            [13] = BSP_PRV_VECT_ENUM(EVENT_GPT4_CAPTURE_COMPARE_A,GROUP5), /* GPT4 CAPTURE COMPARE A (Compare match A) */
+            [14] = BSP_PRV_VECT_ENUM(EVENT_DMAC1_INT,GROUP6), /* DMAC1 INT (DMAC1 transfer end) */
         };
         #endif
         #endif
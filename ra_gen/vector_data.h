@@ -6,13 +6,15 @@
         #endif
 /* Number of interrupts allocated */
 #ifndef VECTOR_DATA_IRQ_COUNT
-#define VECTOR_DATA_IRQ_COUNT    (12)
+#define VECTOR_DATA_IRQ_COUNT    (15)
 #endif
 /* ISR prototypes */
 void sci_b_uart_rxi_isr(void);
 void sci_b_uart_txi_isr(void);
 void sci_b_uart_tei_isr(void);
 void sci_b_uart_eri_isr(void);
+void dmac_int_isr(void);
+void gpt_capture_compare_a_isr(void);
 
 /* Vector table allocations */
 #define VECTOR_NUMBER_SCI0_RXI ((IRQn_Type) 0) /* SCI0 RXI (Receive data full) */
@@ -39,6 +41,12 @@ void sci_b_uart_eri_isr(void);
 #define SCI2_TEI_IRQn          ((IRQn_Type) 10) /* SCI2 TEI (Transmit end) */
 #define VECTOR_NUMBER_SCI2_ERI ((IRQn_Type) 11) /* SCI2 ERI (Receive error) */
 #define SCI2_ERI_IRQn          ((IRQn_Type) 11) /* SCI2 ERI (Receive error) */
+#define VECTOR_NUMBER_DMAC0_INT ((IRQn_Type) 12) /* DMAC0 INT (DMAC0 transfer end) */
+#define DMAC0_INT_IRQn          ((IRQn_Type) 12) /* DMAC0 INT (DMAC0 transfer end) */
+#define VECTOR_NUMBER_GPT4_CAPTURE_COMPARE_A ((IRQn_Type) 13) /* GPT4 CAPTURE COMPARE A (Compare match A) */
+#define GPT4_CAPTURE_COMPARE_A_IRQn          ((IRQn_Type) 13) /* GPT4 CAPTURE COMPARE A (Compare match A) */
+#define VECTOR_NUMBER_DMAC1_INT ((IRQn_Type) 14) /* DMAC1 INT (DMAC1 transfer end) */
+#define DMAC1_INT_IRQn          ((IRQn_Type) 14) /* DMAC1 INT (DMAC1 transfer end) */
 #ifdef __cplusplus
         }
         #endif
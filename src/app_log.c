@@ -0,0 +1,99 @@
+/***********************************************************************************************************************
+ * File Name    : app_log.c
+ * Description  : Contains the deferred log, binary records on an RTT up-buffer formatted by the host.
+ **********************************************************************************************************************/
+
+#include <stdarg.h>
+#include "common_utils.h"
+#include "app_log.h"
+#include "bridge_event.h"
+#include "rtt_lockfree.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup app_log
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define APP_LOG_RECORD_WORDS_MAX  (APP_LOG_HEADER_WORDS + APP_LOG_ARGS_MAX)
+
+/* Up-buffer read by the debug probe */
+static uint8_t g_app_log_buffer[APP_LOG_BUFFER_SIZE];
+
+/* Writer shared by the main loop and the interrupts, no interrupt is masked while a record is written */
+static rtt_lockfree_t g_app_log_writer;
+
+/* Records dropped because the up-buffer was not configured yet */
+static volatile uint32_t g_app_log_dropped = RESET_VALUE;
+
+/* Up-buffer configured */
+static volatile bool g_app_log_ready = false;
+
+/*****************************************************************************************************************
+ *  @brief       Configure the up-buffer. Records are written whole or dropped, the CPU never waits for the host.
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void app_log_init(void)
+{
+    /* The record time stamps come from the DWT cycle counter */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+    SEGGER_RTT_ConfigUpBuffer(APP_LOG_RTT_CHANNEL, "AppLog", g_app_log_buffer, sizeof(g_app_log_buffer),
+                              SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+    if (FSP_SUCCESS == rtt_lockfree_init(&g_app_log_writer, APP_LOG_RTT_CHANNEL))
+    {
+        g_app_log_ready = true;
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Write one record. Called through APP_LOG(), which supplies the format ID and argument count.
+ *               Nothing is formatted here, the cost is copying a few words. The RTT lock
+ *               is not taken, so an interrupt logging at any priority is never held off.
+ *  @param[in]   id       Offset of the format string in the .app_log_fmt section
+ *  @param[in]   count    Number of arguments, at most APP_LOG_ARGS_MAX
+ *  @param[in]   ...      Arguments, each 32 bits wide
+ *  @retval      None
+ ****************************************************************************************************************/
+void app_log_write(uint32_t id, uint32_t count, ...)
+{
+    uint32_t record[APP_LOG_RECORD_WORDS_MAX];
+    va_list  args;
+
+    if (!g_app_log_ready)
+    {
+        g_app_log_dropped++;
+        return;
+    }
+
+    record[0] = (id << APP_LOG_COUNT_BITS) | count;
+    record[1] = bridge_event_cycles();
+
+    va_start(args, count);
+    for (uint32_t i = RESET_VALUE; i < count; i++)
+    {
+        record[APP_LOG_HEADER_WORDS + i] = va_arg(args, uint32_t);
+    }
+    va_end(args);
+
+    uint32_t length = (APP_LOG_HEADER_WORDS + count) * sizeof(uint32_t);
+    (void) rtt_lockfree_write(&g_app_log_writer, record, length);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Number of records lost so far
+ *  @param[in]   None
+ *  @retval      Records dropped
+ ****************************************************************************************************************/
+uint32_t app_log_dropped(void)
+{
+    return g_app_log_dropped + g_app_log_writer.dropped_count;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup app_log)
+ **********************************************************************************************************************/
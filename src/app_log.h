@@ -0,0 +1,43 @@
+/***********************************************************************************************************************
+ * File Name    : app_log.h
+ * Description  : Contains data structures and function declarations of app_log.c.
+ **********************************************************************************************************************/
+
+#ifndef APP_LOG_H_
+#define APP_LOG_H_
+
+#include <stdint.h>
+#include "bsp_api.h"
+
+/* Macro definition */
+#define APP_LOG_DEFERRED          (1)       /* 1: APP_PRINT writes binary records decoded on the host by
+                                             *    tools/app_log_decode.py. 0: formatted by SEGGER_RTT_printf(). */
+#define APP_LOG_RTT_CHANNEL       (1u)      /* RTT up-buffer of the records, the terminal keeps channel 0 */
+#define APP_LOG_BUFFER_SIZE       (4096u)   /* Up-buffer bytes */
+#define APP_LOG_ARGS_MAX          (12u)     /* Arguments per record */
+#define APP_LOG_COUNT_BITS        (4u)      /* Header bits holding the argument count */
+#define APP_LOG_HEADER_WORDS      (2u)      /* Format ID with argument count, then the DWT cycle count */
+
+/* Record layout, 32-bit little-endian words:
+ *   (format offset << APP_LOG_COUNT_BITS) | argument count
+ *   DWT cycle count when the record was written
+ *   one word per argument
+ * Format strings live in the .app_log_fmt section, which is not loaded: the offset of a string in that section is
+ * its ID. Arguments are stored raw, %s arguments as pointers, so they must point at constant strings the decoder
+ * finds in the ELF file. A record the up-buffer has no room for is dropped whole. */
+
+/* Argument count of a log call, 0 to APP_LOG_ARGS_MAX */
+#define APP_LOG_NARGS(...)        APP_LOG_NARGS_(0, ##__VA_ARGS__, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define APP_LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, n, ...)    (n)
+
+/* Log with a format that only exists in the ELF file */
+#define APP_LOG(fn_, ...)         ({ \
+        static char const app_log_fmt_[] __attribute__((section(".app_log_fmt"), used)) = fn_; \
+        app_log_write((uint32_t) app_log_fmt_, APP_LOG_NARGS(__VA_ARGS__), ##__VA_ARGS__); })
+
+/* Function declaration */
+void app_log_init(void);
+void app_log_write(uint32_t id, uint32_t count, ...);
+uint32_t app_log_dropped(void);
+
+#endif /* APP_LOG_H_ */
@@ -0,0 +1,354 @@
+/***********************************************************************************************************************
+ * File Name    : audio_pwm.c
+ * Description  : Contains the PWM-DAC audio output driven by a GPT channel and the DMAC.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "audio_pwm.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup audio_pwm
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define AUDIO_PWM_CLIP_MASK       (AUDIO_PWM_CLIPS - 1u)
+#define AUDIO_PWM_SAMPLE_OFFSET   (32768)   /* Moves signed samples to 0 .. 65535 */
+#define AUDIO_PWM_SAMPLE_SHIFT    (16u)     /* 65536 steps scaled to the period */
+
+/*
+ * Private function declarations
+ */
+static fsp_err_t audio_pwm_run(audio_pwm_t * p_audio);
+static void audio_pwm_pause(audio_pwm_t * p_audio);
+static uint32_t audio_pwm_fill(audio_pwm_t * p_audio, uint32_t * p_duty);
+
+/*****************************************************************************************************************
+ *  @brief       Open the GPT and DMAC instances. Nothing plays until audio_pwm_start().
+ *  @param[in]   p_audio       Audio output to initialize
+ *  @param[in]   p_timer       GPT channel in PWM mode, its compare buffer register is the DMAC destination
+ *  @param[in]   p_transfer    DMAC instance in repeat mode, AUDIO_PWM_HALF 4-byte transfers per repeat, activated
+ *                             by the overflow event of the GPT channel
+ *  @retval      FSP_SUCCESS   Upon success
+ *  @retval      Any Other Error code apart from FSP_SUCCESS  Unsuccessful open
+ ****************************************************************************************************************/
+fsp_err_t audio_pwm_open(audio_pwm_t * p_audio, timer_instance_t const * p_timer,
+                         transfer_instance_t const * p_transfer)
+{
+    fsp_err_t    err  = FSP_SUCCESS;
+    timer_info_t info = {RESET_VALUE};
+
+    p_audio->p_timer      = p_timer;
+    p_audio->p_transfer   = p_transfer;
+    p_audio->clip_head    = RESET_VALUE;
+    p_audio->clip_tail    = RESET_VALUE;
+    p_audio->clip_offset  = RESET_VALUE;
+    p_audio->started      = false;
+    p_audio->running      = false;
+    p_audio->flush        = false;
+    p_audio->event_count  = RESET_VALUE;
+    p_audio->sample_count = RESET_VALUE;
+    p_audio->pause_count  = RESET_VALUE;
+
+    err = p_timer->p_api->open(p_timer->p_ctrl, p_timer->p_cfg);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n** Audio timer open failed **\r\n");
+        return err;
+    }
+
+    err = p_timer->p_api->infoGet(p_timer->p_ctrl, &info);
+    if (FSP_SUCCESS != err)
+    {
+        return err;
+    }
+    p_audio->timer_hz      = info.clock_frequency;
+    p_audio->period_counts = info.period_counts;
+    p_audio->sample_rate   = info.clock_frequency / info.period_counts;
+
+    err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n** Audio DMAC open failed **\r\n");
+    }
+    return err;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Set the sample rate and start the output. Blocks already queued play first. The timer and the DMAC
+ *               only run while there is something to play.
+ *  @param[in]   p_audio       Audio output
+ *  @param[in]   sample_rate   AUDIO_PWM_RATE_MIN to AUDIO_PWM_RATE_MAX Hz
+ *  @retval      FSP_SUCCESS   Upon success
+ *  @retval      FSP_ERR_INVALID_ARGUMENT  Sample rate out of range
+ *  @retval      FSP_ERR_IN_USE            Already started, stop first to change the rate
+ *  @retval      Any Other Error code apart from FSP_SUCCESS  Timer or DMAC could not be started
+ ****************************************************************************************************************/
+fsp_err_t audio_pwm_start(audio_pwm_t * p_audio, uint32_t sample_rate)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    if ((sample_rate < AUDIO_PWM_RATE_MIN) || (sample_rate > AUDIO_PWM_RATE_MAX))
+    {
+        return FSP_ERR_INVALID_ARGUMENT;
+    }
+    if (p_audio->started)
+    {
+        return FSP_ERR_IN_USE;
+    }
+
+    p_audio->period_counts = p_audio->timer_hz / sample_rate;
+    p_audio->sample_rate   = sample_rate;
+    err = p_audio->p_timer->p_api->periodSet(p_audio->p_timer->p_ctrl, p_audio->period_counts);
+    if (FSP_SUCCESS != err)
+    {
+        return err;
+    }
+
+    p_audio->started = true;
+    if (RESET_VALUE == audio_pwm_queued(p_audio))
+    {
+        return FSP_SUCCESS;
+    }
+
+    err = audio_pwm_run(p_audio);
+    if (FSP_SUCCESS != err)
+    {
+        p_audio->started = false;
+    }
+    return err;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Queue a block of samples. The samples are not copied, see audio_pwm_clip_t.
+ *  @param[in]   p_audio       Audio output
+ *  @param[in]   p_samples     Signed 16-bit mono samples at the started sample rate
+ *  @param[in]   count         Number of samples
+ *  @retval      FSP_SUCCESS   Upon success
+ *  @retval      FSP_ERR_INVALID_SIZE        No samples
+ *  @retval      FSP_ERR_INSUFFICIENT_SPACE  AUDIO_PWM_CLIPS blocks are already queued
+ ****************************************************************************************************************/
+fsp_err_t audio_pwm_write(audio_pwm_t * p_audio, int16_t const * p_samples, uint32_t count)
+{
+    uint32_t head = p_audio->clip_head;
+
+    if (RESET_VALUE == count)
+    {
+        return FSP_ERR_INVALID_SIZE;
+    }
+    if ((head - p_audio->clip_tail) >= AUDIO_PWM_CLIPS)
+    {
+        return FSP_ERR_INSUFFICIENT_SPACE;
+    }
+
+    p_audio->clip[head & AUDIO_PWM_CLIP_MASK].p_samples = p_samples;
+    p_audio->clip[head & AUDIO_PWM_CLIP_MASK].count     = count;
+
+    /* Publish the block after it is complete, the DMAC interrupt reads it once the head moves */
+    __DMB();
+    p_audio->clip_head = head + 1u;
+    __DMB();
+
+    /* The DMAC interrupt only pauses with the queue empty, so either it sees this block or running reads false */
+    if (p_audio->started && !p_audio->running)
+    {
+        return audio_pwm_run(p_audio);
+    }
+    return FSP_SUCCESS;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Number of blocks queued, the one playing included
+ *  @param[in]   p_audio       Audio output
+ *  @retval      Blocks whose samples are still in use
+ ****************************************************************************************************************/
+uint32_t audio_pwm_queued(audio_pwm_t const * p_audio)
+{
+    return p_audio->clip_head - p_audio->clip_tail;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Drop the queued blocks. Takes effect at the next half buffer, the samples already converted still
+ *               play. Stopped outputs drop them at once.
+ *  @param[in]   p_audio       Audio output
+ *  @retval      None
+ ****************************************************************************************************************/
+void audio_pwm_flush(audio_pwm_t * p_audio)
+{
+    if (p_audio->running)
+    {
+        p_audio->flush = true;
+    }
+    else
+    {
+        p_audio->clip_tail   = p_audio->clip_head;
+        p_audio->clip_offset = RESET_VALUE;
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Refill the half the DMAC finished. Call from the DMAC callback. After the last repeat the channel
+ *               stops, so it is pointed back at the start of the duty buffer first.
+ *  @param[in]   p_audio       Audio output
+ *  @retval      None
+ ****************************************************************************************************************/
+void audio_pwm_event(audio_pwm_t * p_audio)
+{
+    transfer_properties_t info = {RESET_VALUE};
+
+    p_audio->event_count++;
+
+    p_audio->p_transfer->p_api->infoGet(p_audio->p_transfer->p_ctrl, &info);
+    if (RESET_VALUE == info.block_count_remaining)
+    {
+        /* Transfer end. An overflow raised meanwhile stays latched in the DMAC, one sample is played late. */
+        p_audio->p_transfer->p_api->reset(p_audio->p_transfer->p_ctrl, p_audio->duty, NULL, AUDIO_PWM_REPEATS);
+    }
+
+    uint32_t filled = audio_pwm_fill(p_audio, &p_audio->duty[p_audio->fill_half * AUDIO_PWM_HALF]);
+    p_audio->fill_half ^= 1u;
+
+    /* Both halves silent: the last samples have played, stop until the next block is queued */
+    p_audio->silent_halves = (RESET_VALUE == filled) ? (p_audio->silent_halves + 1u) : RESET_VALUE;
+    if ((p_audio->silent_halves >= 2u) && (p_audio->clip_head == p_audio->clip_tail))
+    {
+        audio_pwm_pause(p_audio);
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Stop the output. Queued blocks stay queued and play after the next audio_pwm_start().
+ *  @param[in]   p_audio       Audio output
+ *  @retval      FSP_SUCCESS   Upon success
+ *  @retval      Any Other Error code apart from FSP_SUCCESS  Timer or DMAC could not be stopped
+ ****************************************************************************************************************/
+fsp_err_t audio_pwm_stop(audio_pwm_t * p_audio)
+{
+    p_audio->started = false;
+
+    fsp_err_t err = p_audio->p_timer->p_api->stop(p_audio->p_timer->p_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n** Audio timer stop failed **\r\n");
+        return err;
+    }
+
+    err = p_audio->p_transfer->p_api->disable(p_audio->p_transfer->p_ctrl);
+    p_audio->running = false;
+    return err;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Fill both halves of the duty buffer and start the DMAC and the timer
+ *  @param[in]   p_audio       Audio output, started and not running
+ *  @retval      FSP_SUCCESS   Upon success
+ *  @retval      Any Other Error code apart from FSP_SUCCESS  Timer or DMAC could not be started
+ ****************************************************************************************************************/
+static fsp_err_t audio_pwm_run(audio_pwm_t * p_audio)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    /* Both halves are ready before the first request, the DMAC interrupt refills them from then on */
+    audio_pwm_fill(p_audio, &p_audio->duty[0]);
+    audio_pwm_fill(p_audio, &p_audio->duty[AUDIO_PWM_HALF]);
+    p_audio->fill_half     = RESET_VALUE;
+    p_audio->silent_halves = RESET_VALUE;
+
+    err = p_audio->p_transfer->p_api->reset(p_audio->p_transfer->p_ctrl, p_audio->duty, NULL, AUDIO_PWM_REPEATS);
+    if (FSP_SUCCESS != err)
+    {
+        return err;
+    }
+
+    p_audio->running = true;
+    err = p_audio->p_timer->p_api->start(p_audio->p_timer->p_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        p_audio->running = false;
+        p_audio->p_transfer->p_api->disable(p_audio->p_transfer->p_ctrl);
+        APP_ERR_PRINT ("\r\n** Audio timer start failed **\r\n");
+    }
+    return err;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Stop the timer and the DMAC with the queue empty. Call from the DMAC interrupt. The output was
+ *               at half scale, silence, for the two halves before.
+ *  @param[in]   p_audio       Audio output
+ *  @retval      None
+ ****************************************************************************************************************/
+static void audio_pwm_pause(audio_pwm_t * p_audio)
+{
+    p_audio->p_timer->p_api->stop(p_audio->p_timer->p_ctrl);
+    p_audio->p_transfer->p_api->disable(p_audio->p_transfer->p_ctrl);
+    p_audio->running = false;
+    p_audio->pause_count++;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Convert the next queued samples into duty counts, silence once the queue is empty
+ *  @param[in]   p_audio       Audio output
+ *  @param[in]   p_duty        Half of the duty buffer to fill
+ *  @retval      Queued samples converted, 0 for a silent half
+ ****************************************************************************************************************/
+static uint32_t audio_pwm_fill(audio_pwm_t * p_audio, uint32_t * p_duty)
+{
+    uint32_t period = p_audio->period_counts;
+    uint32_t tail   = p_audio->clip_tail;
+    uint32_t offset = p_audio->clip_offset;
+    uint32_t filled = RESET_VALUE;
+
+    if (p_audio->flush)
+    {
+        p_audio->flush = false;
+        tail           = p_audio->clip_head;
+        offset         = RESET_VALUE;
+    }
+
+    while ((filled < AUDIO_PWM_HALF) && (tail != p_audio->clip_head))
+    {
+        audio_pwm_clip_t const * p_clip = &p_audio->clip[tail & AUDIO_PWM_CLIP_MASK];
+        uint32_t                 count  = p_clip->count - offset;
+
+        if (count > (AUDIO_PWM_HALF - filled))
+        {
+            count = AUDIO_PWM_HALF - filled;
+        }
+
+        for (uint32_t i = RESET_VALUE; i < count; i++)
+        {
+            uint32_t level = (uint32_t) (p_clip->p_samples[offset + i] + AUDIO_PWM_SAMPLE_OFFSET);
+            p_duty[filled + i] = (level * period) >> AUDIO_PWM_SAMPLE_SHIFT;
+        }
+
+        filled                += count;
+        offset                += count;
+        p_audio->sample_count += count;
+
+        if (offset >= p_clip->count)
+        {
+            /* Block done, its samples are no longer read */
+            offset = RESET_VALUE;
+            tail++;
+        }
+    }
+
+    uint32_t samples = filled;
+
+    /* Half scale is silence after the output filter */
+    for (; filled < AUDIO_PWM_HALF; filled++)
+    {
+        p_duty[filled] = period / 2u;
+    }
+
+    p_audio->clip_offset = offset;
+    p_audio->clip_tail   = tail;
+
+    return samples;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup audio_pwm)
+ **********************************************************************************************************************/
@@ -0,0 +1,69 @@
+/***********************************************************************************************************************
+ * File Name    : audio_pwm.h
+ * Description  : Contains data structures and function declarations of audio_pwm.c.
+ **********************************************************************************************************************/
+
+#ifndef AUDIO_PWM_H_
+#define AUDIO_PWM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bsp_api.h"
+#include "r_timer_api.h"
+#include "r_transfer_api.h"
+
+/* Macro definition */
+#define AUDIO_PWM_BUFFER          (512u)    /* Duty buffer in samples, two halves played alternately */
+#define AUDIO_PWM_HALF            (AUDIO_PWM_BUFFER / 2u)     /* DMAC repeat size, one event per half */
+#define AUDIO_PWM_REPEATS         (2u)      /* Repeats until the transfer end event re-arms the channel */
+#define AUDIO_PWM_CLIPS           (4u)      /* Sample blocks that can be queued, power of two */
+#define AUDIO_PWM_RATE_MIN        (8000u)   /* Lowest sample rate in Hz */
+#define AUDIO_PWM_RATE_MAX        (16000u)  /* Highest sample rate in Hz */
+
+/* One block of signed 16-bit mono samples queued for playback. The samples are read while the block plays, so
+ * they must stay unchanged until audio_pwm_queued() no longer counts the block. */
+typedef struct st_audio_pwm_clip
+{
+    int16_t const * p_samples;              /* First sample */
+    uint32_t        count;                  /* Number of samples */
+} audio_pwm_clip_t;
+
+/* PWM-DAC on one GPT channel. The GPT period is one sample. Its overflow event triggers a DMAC transfer of the next
+ * duty count from a double buffer into the compare buffer register, which the GPT loads at the next overflow. The
+ * CPU only runs once per half buffer, in the DMAC interrupt, to convert the next queued samples into duty counts.
+ * An RC low pass on the output pin makes the analogue signal. Once the queue has played out the timer and the DMAC
+ * pause, so a silent output costs no interrupts, and the next audio_pwm_write() resumes them. */
+typedef struct st_audio_pwm
+{
+    timer_instance_t const    * p_timer;                      /* GPT channel in PWM mode driving the output pin */
+    transfer_instance_t const * p_transfer;                   /* DMAC instance linked to the GPT overflow event */
+    uint32_t                    duty[AUDIO_PWM_BUFFER];       /* Duty counts read by the DMAC */
+    audio_pwm_clip_t            clip[AUDIO_PWM_CLIPS];        /* Queued sample blocks */
+    volatile uint32_t           clip_head;                    /* Next block to queue, written by the main loop */
+    volatile uint32_t           clip_tail;                    /* Block playing, written by the DMAC interrupt */
+    uint32_t                    clip_offset;                  /* Next sample of the block playing */
+    uint32_t                    fill_half;                    /* Half the DMAC finished, refilled next */
+    uint32_t                    timer_hz;                     /* GPT count clock */
+    uint32_t                    period_counts;                /* GPT period of one sample */
+    uint32_t                    sample_rate;                  /* Sample rate in Hz */
+    bool                        started;                      /* Output started by audio_pwm_start() */
+    volatile bool               running;                      /* Timer and DMAC running, they pause once the
+                                                               * queued blocks have played */
+    uint32_t                    silent_halves;                /* Halves filled with silence in a row */
+    volatile bool               flush;                        /* Drop the queued blocks at the next half */
+    volatile uint32_t           event_count;                  /* Halves played */
+    volatile uint32_t           sample_count;                 /* Queued samples played */
+    volatile uint32_t           pause_count;                  /* Pauses after the queue ran empty */
+} audio_pwm_t;
+
+/* Function declaration */
+fsp_err_t audio_pwm_open(audio_pwm_t * p_audio, timer_instance_t const * p_timer,
+                         transfer_instance_t const * p_transfer);
+fsp_err_t audio_pwm_start(audio_pwm_t * p_audio, uint32_t sample_rate);
+fsp_err_t audio_pwm_write(audio_pwm_t * p_audio, int16_t const * p_samples, uint32_t count);
+uint32_t audio_pwm_queued(audio_pwm_t const * p_audio);
+void audio_pwm_flush(audio_pwm_t * p_audio);
+void audio_pwm_event(audio_pwm_t * p_audio);
+fsp_err_t audio_pwm_stop(audio_pwm_t * p_audio);
+
+#endif /* AUDIO_PWM_H_ */
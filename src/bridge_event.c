@@ -0,0 +1,136 @@
+/***********************************************************************************************************************
+ * File Name    : bridge_event.c
+ * Description  : Contains the events that wake the sleeping main loop of the bridge.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "bridge_event.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup bridge_event
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define BRIDGE_EVENT_TICK_CYCLES  ((SystemCoreClock / 1000000u) * BRIDGE_EVENT_TICK_US)
+
+/* Events not yet seen by the main loop, set by the interrupts */
+static volatile uint32_t g_bridge_events = RESET_VALUE;
+
+/* Cycles the DWT cycle counter missed while the core clock was stopped in sleep mode */
+static volatile uint32_t g_bridge_sleep_cycles = RESET_VALUE;
+
+/*****************************************************************************************************************
+ *  @brief       Start the main loop tick
+ *  @param[in]   None
+ *  @retval      FSP_SUCCESS   Upon success
+ *  @retval      FSP_ERR_INVALID_ARGUMENT  The tick period does not fit SysTick
+ ****************************************************************************************************************/
+fsp_err_t bridge_event_init(void)
+{
+    /* The DWT timeouts of the other modules assume a running cycle counter */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+    if (RESET_VALUE != SysTick_Config(BRIDGE_EVENT_TICK_CYCLES))
+    {
+        return FSP_ERR_INVALID_ARGUMENT;
+    }
+    return FSP_SUCCESS;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Signal events. Callable from interrupts.
+ *  @param[in]   events    BRIDGE_EVENT_ bits
+ *  @retval      None
+ ****************************************************************************************************************/
+void bridge_event_set(uint32_t events)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    /* Interrupts of different priorities set bits, the read-modify-write must not interleave */
+    FSP_CRITICAL_SECTION_ENTER;
+    g_bridge_events |= events;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Wait for events and clear the ones returned. The CPU sleeps until an interrupt signals one of
+ *               them or the tick comes, so BRIDGE_EVENT_TICK is always waited for. In the DTC and DMAC receive modes
+ *               the received bytes do not interrupt, the tick is what wakes the loop to poll them.
+ *  @param[in]   events        BRIDGE_EVENT_ bits to wait for
+ *  @retval      Events that occurred out of the ones waited for
+ ****************************************************************************************************************/
+uint32_t bridge_event_wait(uint32_t events)
+{
+    uint32_t pending = RESET_VALUE;
+
+    events |= BRIDGE_EVENT_TICK;
+
+    /* With PRIMASK set an interrupt still ends WFI but only runs after the check, so none is missed in between */
+    __disable_irq();
+    if (RESET_VALUE == (g_bridge_events & events))
+    {
+        uint32_t count  = SysTick->VAL;
+        uint32_t cycles = DWT->CYCCNT;
+
+        __DSB();
+        __WFI();
+
+        /* The core clock may stop in sleep mode and the cycle counter with it. The time slept, as SysTick counted
+         * it, is taken before the interrupt that ended the sleep runs, so its time stamps already include it. The
+         * tick wakes the CPU, so SysTick reloaded at most once. */
+        uint32_t now     = SysTick->VAL;
+        bool     reload  = (RESET_VALUE != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk));
+        if (reload)
+        {
+            /* Read again, the reload may have come after the first read */
+            now = SysTick->VAL;
+        }
+        uint32_t slept = reload ? (count + BRIDGE_EVENT_TICK_CYCLES - now) : (count - now);
+        uint32_t run   = DWT->CYCCNT - cycles;
+        if (slept > run)
+        {
+            g_bridge_sleep_cycles += slept - run;
+        }
+
+        /* Let the interrupt that ended the sleep run */
+        __enable_irq();
+        __disable_irq();
+    }
+
+    pending          = g_bridge_events & events;
+    g_bridge_events &= ~pending;
+    __enable_irq();
+
+    return pending;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Time base of the timeouts and time stamps, in core clock cycles. It is the DWT cycle counter plus
+ *               the cycles it missed in sleep mode. The counter itself is never written, its other users keep it.
+ *               Callable from interrupts.
+ *  @param[in]   None
+ *  @retval      Cycle count, wraps like the DWT cycle counter
+ ****************************************************************************************************************/
+uint32_t bridge_event_cycles(void)
+{
+    /* Only the main loop adds to the sleep cycles, with interrupts disabled */
+    return DWT->CYCCNT + g_bridge_sleep_cycles;
+}
+
+/*****************************************************************************************************************
+ *  @brief      SysTick handler, the main loop tick
+ *  @param[in]  None
+ *  @retval     None
+ ****************************************************************************************************************/
+void SysTick_Handler(void)
+{
+    bridge_event_set(BRIDGE_EVENT_TICK);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup bridge_event)
+ **********************************************************************************************************************/
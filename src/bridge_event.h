@@ -0,0 +1,26 @@
+/***********************************************************************************************************************
+ * File Name    : bridge_event.h
+ * Description  : Contains data structures and function declarations of bridge_event.c.
+ **********************************************************************************************************************/
+
+#ifndef BRIDGE_EVENT_H_
+#define BRIDGE_EVENT_H_
+
+#include <stdint.h>
+#include "bsp_api.h"
+
+/* Macro definition */
+#define BRIDGE_EVENT_PC_RX        (1u << 0) /* Bytes from the PC, set by the PC channel and its DMAC */
+#define BRIDGE_EVENT_EP           (1u << 1) /* Talk board prompt or transmit complete */
+#define BRIDGE_EVENT_TICK         (1u << 2) /* Periodic tick of the main loop, drives the polled timeouts */
+#define BRIDGE_EVENT_ALL          (BRIDGE_EVENT_PC_RX | BRIDGE_EVENT_EP | BRIDGE_EVENT_TICK)
+#define BRIDGE_EVENT_TICK_US      (250u)    /* Main loop tick. It polls the DTC and DMAC receive modes, whose bytes do
+                                             * not wake the CPU, so it stays close to UART_RX_DMAC_IDLE_US. */
+
+/* Function declaration */
+fsp_err_t bridge_event_init(void);
+void bridge_event_set(uint32_t events);
+uint32_t bridge_event_wait(uint32_t events);
+uint32_t bridge_event_cycles(void);
+
+#endif /* BRIDGE_EVENT_H_ */
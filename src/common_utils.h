@@ -18,6 +18,7 @@
 #include "hal_data.h"
 /* SEGGER RTT and error related headers */
 #include "SEGGER_RTT/SEGGER_RTT.h"
+#include "app_log.h"
 
 
 #define BIT_SHIFT_8  (8u)
@@ -39,6 +40,21 @@
 
 #define SEGGER_INDEX            (0)
 
+/* Answers to the RTT viewer keys, formatted on the terminal channel where the keys are typed. The main loop and the
+ * status task only, SEGGER_RTT_printf() takes the RTT lock. */
+#define APP_REPLY(fn_, ...)      (SEGGER_RTT_printf (SEGGER_INDEX,(fn_), ##__VA_ARGS__))
+
+#if APP_LOG_DEFERRED
+/* Formats must be string literals, they are stored in the ELF file only and formatted by the host */
+#define APP_PRINT(fn_, ...)      APP_LOG(fn_, ##__VA_ARGS__)
+
+#define APP_ERR_PRINT(fn_, ...)  ({if(LVL_ERR)\
+        APP_LOG("[ERR] In Function: %s(), " fn_, __FUNCTION__, ##__VA_ARGS__);})
+
+#define APP_ERR_TRAP(err)        ({if(err) {\
+        APP_LOG("\r\nReturned Error Code: 0x%x  \r\n", (err));\
+        __asm("BKPT #0\n");}}) /* trap upon the error  */
+#else
 #define APP_PRINT(fn_, ...)      (SEGGER_RTT_printf (SEGGER_INDEX,(fn_), ##__VA_ARGS__))
 
 #define APP_ERR_PRINT(fn_, ...)  ({if(LVL_ERR)\
@@ -47,6 +63,7 @@
 #define APP_ERR_TRAP(err)        ({if(err) {\
         SEGGER_RTT_printf(SEGGER_INDEX, "\r\nReturned Error Code: 0x%x  \r\n", (err));\
         __asm("BKPT #0\n");}}) /* trap upon the error  */
+#endif
 
 #define APP_READ(read_data)     (SEGGER_RTT_Read (SEGGER_INDEX, (read_data), sizeof(read_data)))
 
@@ -12,6 +12,10 @@
 #include "timer_pwm.h"
 #include "uart_ep.h"
 #include "uart_pc.h"
+#include "ram_vectors.h"
+#include "bridge_event.h"
+#include "trace.h"
+#include "perf_region.h"
 //#include "tk/tkernel.h"
 //#include "tm/tmonitor.h"
 
@@ -22,6 +26,26 @@
 
 void R_BSP_WarmStart(bsp_warm_start_event_t event);
 
+#if TRACE_ENABLED
+/* Interrupts timed by the tracer */
+static const struct
+{
+    IRQn_Type    irq;
+    char const * p_name;
+} g_trace_isrs[] =
+{
+    {VECTOR_NUMBER_SCI0_RXI, "SCI0 RXI"},
+    {VECTOR_NUMBER_SCI0_TXI, "SCI0 TXI"},
+    {VECTOR_NUMBER_SCI0_TEI, "SCI0 TEI"},
+    {VECTOR_NUMBER_SCI2_RXI, "SCI2 RXI"},
+    {VECTOR_NUMBER_SCI2_TXI, "SCI2 TXI"},
+    {VECTOR_NUMBER_SCI2_TEI, "SCI2 TEI"},
+    {VECTOR_NUMBER_DMAC0_INT, "DMAC0 INT"},
+    {VECTOR_NUMBER_GPT4_CAPTURE_COMPARE_A, "GPT4 CCMPA"},
+    {VECTOR_NUMBER_DMAC1_INT, "DMAC1 INT"},
+};
+#endif
+
 /*******************************************************************************************************************//**
  * The RA Configuration tool generates main() and uses it to generate threads if an RTOS is used.  This function is
  * called by main() when no RTOS is used.
@@ -31,6 +55,22 @@ void hal_entry(void)
     fsp_err_t err = FSP_SUCCESS;
     fsp_pack_version_t version = {RESET_VALUE};
 
+    /* Log up-buffer, before the first APP_PRINT */
+    app_log_init();
+
+#if TRACE_ENABLED
+    /* Trace up-buffer, before the first TRACE_BEGIN */
+    if (FSP_SUCCESS != trace_init())
+    {
+        APP_PRINT ("\r\n ** TRACE INIT FAILED, no events will be recorded ** \r\n");
+    }
+#endif
+
+#if PERF_REGION_ENABLED
+    /* PMU counters of the measured regions */
+    perf_region_init();
+#endif
+
     /* Version get API for FLEX pack information */
     R_FSP_VersionGet(&version);
 
@@ -46,6 +86,20 @@ void hal_entry(void)
     APP_PRINT("\r\nOpen Serial Terminal with this baud rate value and");
     APP_PRINT("\r\nProvide Input ranging from 1 - 100 to set LED Intensity\r\n");
 
+#if SCI_B_UART_CFG_RXI_FAST_PATH || TRACE_ENABLED
+    /* The SCI_B driver installs its specialised RXI handlers in the vector table and the tracer its interrupt
+     * wrappers, which must be in RAM for that */
+    ram_vectors_init();
+#endif
+
+    /* Events must exist before the first interrupt that signals one */
+    err = bridge_event_init();
+    if (FSP_SUCCESS != err)
+    {
+        APP_PRINT ("\r\n ** BRIDGE EVENT INIT FAILED ** \r\n");
+        APP_ERR_TRAP(err);
+    }
+
     /* Initializing GPT in PWM mode */
     err = gpt_initialize();
     if (FSP_SUCCESS != err)
@@ -63,6 +117,15 @@ void hal_entry(void)
         APP_ERR_TRAP(err);
     }
 
+    /* Starting the PWM-DAC audio output */
+    err = audio_initialize();
+    if (FSP_SUCCESS != err)
+    {
+        APP_PRINT ("\r\n ** AUDIO INIT FAILED ** \r\n");
+        timer_gpt_deinit();
+        APP_ERR_TRAP(err);
+    }
+
     /* Initializing UART:0 */
     err = uart_initialize();
     if (FSP_SUCCESS != err)
@@ -83,6 +146,17 @@ void hal_entry(void)
     }
 #endif
 
+#if TRACE_ENABLED
+    /* Every driver has installed its handlers, wrap them now */
+    for (uint32_t i = RESET_VALUE; i < (sizeof(g_trace_isrs) / sizeof(g_trace_isrs[0])); i++)
+    {
+        if (FSP_SUCCESS != trace_isr_wrap(g_trace_isrs[i].irq, g_trace_isrs[i].p_name))
+        {
+            APP_PRINT ("\r\n ** %s not traced ** \r\n", g_trace_isrs[i].p_name);
+        }
+    }
+#endif
+
 #if 1
     // 起動時の挨拶メッセージ出力
     err = uart_print_pc_msg((uint8_t *)"kkoonnichiha\r"); // uart2
@@ -96,7 +170,6 @@ void hal_entry(void)
 #endif
 
     /* User defined function to demonstrate UART functionality */
-#if 1
     err = uart_pc_com();  // com2
     if (FSP_SUCCESS != err)
     {
@@ -105,20 +178,6 @@ void hal_entry(void)
         deinit_uart();
         APP_ERR_TRAP(err);
     }
-#endif
-
-
-    /* User defined function to demonstrate UART functionality */
-#if 0
-    err = uart_ep_voice();
-    if (FSP_SUCCESS != err)
-    {
-        APP_PRINT ("\r\n ** UART EP Demo FAILED ** \r\n");
-        timer_gpt_deinit();
-        deinit_uart();
-        APP_ERR_TRAP(err);
-    }
-#endif
 }
 
 /*******************************************************************************************************************//**
@@ -135,6 +194,11 @@ void R_BSP_WarmStart(bsp_warm_start_event_t event)
 
         /* Configure pins. */
         R_IOPORT_Open (&g_ioport_ctrl, &g_bsp_pin_cfg);
+
+#if BSP_CFG_SDRAM_ENABLED
+        /* Setup SDRAM and initialize it. Must configure pins first. */
+        R_BSP_SdramInit(true);
+#endif
     }
 }
 
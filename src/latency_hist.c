@@ -0,0 +1,129 @@
+/***********************************************************************************************************************
+ * File Name    : latency_hist.c
+ * Description  : Contains the log-linear latency histogram and its percentiles.
+ **********************************************************************************************************************/
+
+#include <string.h>
+#include "latency_hist.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup latency_hist
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#ifndef RESET_VALUE
+ #define RESET_VALUE              (0x00)
+#endif
+#define LATENCY_HIST_SUB_MASK     (LATENCY_HIST_SUB_COUNT - 1u)
+
+/*
+ * Private function declarations
+ */
+static uint32_t latency_hist_index(uint32_t value);
+static uint32_t latency_hist_upper(uint32_t index);
+
+/*****************************************************************************************************************
+ *  @brief       Clear all buckets
+ *  @param[in]   p_hist   Histogram
+ *  @retval      None
+ ****************************************************************************************************************/
+void latency_hist_reset(latency_hist_t * p_hist)
+{
+    memset(p_hist, RESET_VALUE, sizeof(*p_hist));
+}
+
+/*****************************************************************************************************************
+ *  @brief       Count one value. Constant time, no division.
+ *  @param[in]   p_hist   Histogram
+ *  @param[in]   value    Value to count
+ *  @retval      None
+ ****************************************************************************************************************/
+void latency_hist_record(latency_hist_t * p_hist, uint32_t value)
+{
+    p_hist->counts[latency_hist_index(value)]++;
+    p_hist->total_count++;
+    if (value > p_hist->max)
+    {
+        p_hist->max = value;
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Value at a percentile: the upper end of the bucket holding it, never above the largest value
+ *  @param[in]   p_hist     Histogram
+ *  @param[in]   per_100k   Percentile in thousandths of a percent, 50000 for the median
+ *  @retval      Value, 0 when nothing is recorded
+ ****************************************************************************************************************/
+uint32_t latency_hist_percentile(latency_hist_t const * p_hist, uint32_t per_100k)
+{
+    uint64_t rank  = RESET_VALUE;
+    uint64_t count = RESET_VALUE;
+
+    if (RESET_VALUE == p_hist->total_count)
+    {
+        return RESET_VALUE;
+    }
+
+    /* Rank of the value in the sorted samples, rounded up and at least the first one */
+    rank = (((uint64_t) p_hist->total_count * per_100k) + LATENCY_HIST_PER_100K - 1u) / LATENCY_HIST_PER_100K;
+    if (RESET_VALUE == rank)
+    {
+        rank = 1u;
+    }
+
+    for (uint32_t i = RESET_VALUE; i < LATENCY_HIST_BUCKETS; i++)
+    {
+        count += p_hist->counts[i];
+        if (count >= rank)
+        {
+            uint32_t upper = latency_hist_upper(i);
+            return (upper < p_hist->max) ? upper : p_hist->max;
+        }
+    }
+
+    return p_hist->max;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Bucket of a value: the position of the top bit selects the power of two, the next
+ *               LATENCY_HIST_SUB_BITS bits the bucket within it
+ *  @param[in]   value    Value
+ *  @retval      Bucket index
+ ****************************************************************************************************************/
+static uint32_t latency_hist_index(uint32_t value)
+{
+    if (value < LATENCY_HIST_SUB_COUNT)
+    {
+        return value;
+    }
+
+    uint32_t top   = 31u - (uint32_t) __builtin_clz(value);
+    uint32_t shift = top - LATENCY_HIST_SUB_BITS;
+
+    return ((shift + 1u) << LATENCY_HIST_SUB_BITS) + ((value >> shift) & LATENCY_HIST_SUB_MASK);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Largest value counted in a bucket
+ *  @param[in]   index    Bucket index
+ *  @retval      Value
+ ****************************************************************************************************************/
+static uint32_t latency_hist_upper(uint32_t index)
+{
+    if (index < LATENCY_HIST_SUB_COUNT)
+    {
+        return index;
+    }
+
+    uint32_t shift = (index >> LATENCY_HIST_SUB_BITS) - 1u;
+    uint32_t lower = (LATENCY_HIST_SUB_COUNT + (index & LATENCY_HIST_SUB_MASK)) << shift;
+
+    return lower + ((1u << shift) - 1u);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup latency_hist)
+ **********************************************************************************************************************/
@@ -0,0 +1,33 @@
+/***********************************************************************************************************************
+ * File Name    : latency_hist.h
+ * Description  : Contains data structures and function declarations of latency_hist.c.
+ **********************************************************************************************************************/
+
+#ifndef LATENCY_HIST_H_
+#define LATENCY_HIST_H_
+
+#include <stdint.h>
+#include "bsp_api.h"
+
+/* Macro definition */
+#define LATENCY_HIST_SUB_BITS     (5u)      /* Buckets per power of two as a power of two, 32 buckets keep every
+                                             * value within 1 / 32 = 3.1 % of the bucket it is counted in */
+#define LATENCY_HIST_SUB_COUNT    (1u << LATENCY_HIST_SUB_BITS)
+#define LATENCY_HIST_BUCKETS      ((32u - LATENCY_HIST_SUB_BITS + 1u) * LATENCY_HIST_SUB_COUNT)  /* Whole 32-bit range */
+#define LATENCY_HIST_PER_100K     (100000u) /* Percentiles are given in thousandths of a percent, p99.9 is 99900 */
+
+/* Log-linear histogram in the style of HdrHistogram. Values below LATENCY_HIST_SUB_COUNT have a bucket each, above
+ * that every power of two is split into LATENCY_HIST_SUB_COUNT equal buckets. */
+typedef struct st_latency_hist
+{
+    uint32_t counts[LATENCY_HIST_BUCKETS];  /* Values per bucket */
+    uint32_t total_count;                   /* Values recorded */
+    uint32_t max;                           /* Largest value recorded */
+} latency_hist_t;
+
+/* Function declaration */
+void latency_hist_reset(latency_hist_t * p_hist);
+void latency_hist_record(latency_hist_t * p_hist, uint32_t value);
+uint32_t latency_hist_percentile(latency_hist_t const * p_hist, uint32_t per_100k);
+
+#endif /* LATENCY_HIST_H_ */
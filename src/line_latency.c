@@ -0,0 +1,213 @@
+/***********************************************************************************************************************
+ * File Name    : line_latency.c
+ * Description  : Contains the latency histograms of PC lines, from the carriage return to the talk board reply.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "line_latency.h"
+#include "bridge_event.h"
+
+#if LINE_LATENCY_ENABLED
+
+/*******************************************************************************************************************//**
+ * @addtogroup line_latency
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define LINE_LATENCY_CYCLES_PER_US    (SystemCoreClock / 1000000u)
+
+/* Where the line being timed is. One line is timed at a time, the utterance queue sends no more anyway. */
+typedef enum e_line_latency_state
+{
+    LINE_LATENCY_STATE_IDLE = 0,
+    LINE_LATENCY_STATE_WAIT_START,
+    LINE_LATENCY_STATE_WAIT_COMPLETE,
+    LINE_LATENCY_STATE_WAIT_REPLY,
+} line_latency_state_t;
+
+/*
+ * Private function declarations
+ */
+static void line_latency_record(line_latency_stage_t stage);
+
+/* Percentiles reported, in line_latency_percentiles() order after the maximum */
+static const uint32_t g_line_latency_per_100k[] = {50000u, 99000u, 99900u};
+
+/* Stage names, in line_latency_stage_t order */
+static char const * const g_line_latency_names[LINE_LATENCY_STAGE_COUNT] =
+{
+    "TX start",
+    "TX complete",
+    "Reply",
+};
+
+/* Microseconds from the carriage return, per stage */
+static latency_hist_t g_line_latency_hist[LINE_LATENCY_STAGE_COUNT];
+
+/* Copy a report is computed from, main loop only. Static, it is too large for the stack. */
+static latency_hist_t g_line_latency_copy;
+
+/* Line being timed. Set by the main loop, advanced by the SCI0 interrupts. */
+static volatile line_latency_state_t g_line_latency_state = LINE_LATENCY_STATE_IDLE;
+static void const * gp_line_latency_slot = NULL;
+static uint32_t g_line_latency_rx_cycles = RESET_VALUE;
+
+/*****************************************************************************************************************
+ *  @brief       Clear the histograms
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void line_latency_reset(void)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    FSP_CRITICAL_SECTION_ENTER;
+    for (uint32_t i = RESET_VALUE; i < LINE_LATENCY_STAGE_COUNT; i++)
+    {
+        latency_hist_reset(&g_line_latency_hist[i]);
+    }
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Start timing a line about to be queued for the talk board. Lines that did not come from the PC are
+ *               not timed.
+ *  @param[in]   p_slot    Line slot, passed to the transmit queue as the message context
+ *  @retval      None
+ ****************************************************************************************************************/
+void line_latency_begin(uart_line_slot_t const * p_slot)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    /* The transmit queue may start the line before this returns, in an interrupt as well */
+    FSP_CRITICAL_SECTION_ENTER;
+    if (p_slot->rx_timed)
+    {
+        gp_line_latency_slot     = p_slot;
+        g_line_latency_rx_cycles = p_slot->rx_cycles;
+        g_line_latency_state     = LINE_LATENCY_STATE_WAIT_START;
+    }
+    else
+    {
+        g_line_latency_state = LINE_LATENCY_STATE_IDLE;
+    }
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Stop timing the current line, it was dropped or cut off
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void line_latency_cancel(void)
+{
+    g_line_latency_state = LINE_LATENCY_STATE_IDLE;
+}
+
+/*****************************************************************************************************************
+ *  @brief       A message started on SCI0. Matches the transmit queue start callback.
+ *  @param[in]   p_context    Context of the message, the line slot for lines
+ *  @retval      None
+ ****************************************************************************************************************/
+void line_latency_tx_start(void * p_context)
+{
+    if ((LINE_LATENCY_STATE_WAIT_START == g_line_latency_state) && (gp_line_latency_slot == p_context))
+    {
+        line_latency_record(LINE_LATENCY_TX_START);
+        g_line_latency_state = LINE_LATENCY_STATE_WAIT_COMPLETE;
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       SCI0 transmit complete. Call before the transmit queue starts the next message: only one message is
+ *               on the wire, so once the line started this completion is its own.
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void line_latency_tx_complete(void)
+{
+    if (LINE_LATENCY_STATE_WAIT_COMPLETE == g_line_latency_state)
+    {
+        line_latency_record(LINE_LATENCY_TX_COMPLETE);
+        g_line_latency_state = LINE_LATENCY_STATE_WAIT_REPLY;
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Talk board ready prompt received
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void line_latency_reply(void)
+{
+    if (LINE_LATENCY_STATE_WAIT_REPLY == g_line_latency_state)
+    {
+        line_latency_record(LINE_LATENCY_REPLY);
+        g_line_latency_state = LINE_LATENCY_STATE_IDLE;
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Percentiles of one stage
+ *  @param[in]   stage     Stage
+ *  @param[out]  p_count   Lines timed
+ *  @param[out]  p_us      p50, p99, p99.9 and the maximum, in microseconds
+ *  @retval      None
+ ****************************************************************************************************************/
+void line_latency_percentiles(line_latency_stage_t stage, uint32_t * p_count, uint32_t p_us[LINE_LATENCY_VALUES])
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    /* The SCI0 interrupts record into the histograms. Only the copy is made with them masked, the bucket scans
+     * run on the copy. */
+    FSP_CRITICAL_SECTION_ENTER;
+    g_line_latency_copy = g_line_latency_hist[stage];
+    FSP_CRITICAL_SECTION_EXIT;
+
+    *p_count = g_line_latency_copy.total_count;
+    for (uint32_t i = RESET_VALUE; i < (sizeof(g_line_latency_per_100k) / sizeof(g_line_latency_per_100k[0])); i++)
+    {
+        p_us[i] = latency_hist_percentile(&g_line_latency_copy, g_line_latency_per_100k[i]);
+    }
+    p_us[LINE_LATENCY_VALUES - 1u] = g_line_latency_copy.max;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Print the percentiles of every stage over RTT
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void line_latency_report(void)
+{
+    uint32_t count = RESET_VALUE;
+    uint32_t us[LINE_LATENCY_VALUES] = {RESET_VALUE};
+
+    APP_REPLY("\r\nCR to         lines      p50 us      p99 us    p99.9 us      max us\r\n");
+    for (uint32_t i = RESET_VALUE; i < LINE_LATENCY_STAGE_COUNT; i++)
+    {
+        line_latency_percentiles((line_latency_stage_t) i, &count, us);
+        APP_REPLY("%-11s  %6d  %10d  %10d  %10d  %10d\r\n", g_line_latency_names[i], count, us[0], us[1], us[2],
+                  us[3]);
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Count the time since the carriage return in a stage histogram
+ *  @param[in]   stage    Stage reached
+ *  @retval      None
+ ****************************************************************************************************************/
+static void line_latency_record(line_latency_stage_t stage)
+{
+    uint32_t cycles = bridge_event_cycles() - g_line_latency_rx_cycles;
+
+    latency_hist_record(&g_line_latency_hist[stage], cycles / LINE_LATENCY_CYCLES_PER_US);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup line_latency)
+ **********************************************************************************************************************/
+
+#endif /* LINE_LATENCY_ENABLED */
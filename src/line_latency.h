@@ -0,0 +1,42 @@
+/***********************************************************************************************************************
+ * File Name    : line_latency.h
+ * Description  : Contains data structures and function declarations of line_latency.c.
+ **********************************************************************************************************************/
+
+#ifndef LINE_LATENCY_H_
+#define LINE_LATENCY_H_
+
+#include <stdint.h>
+#include "bsp_api.h"
+#include "latency_hist.h"
+#include "uart_line_pool.h"
+
+/* Macro definition */
+#define LINE_LATENCY_ENABLED      (1)       /* 1: time PC lines on their way to the talk board, see below */
+#define LINE_LATENCY_COMMAND_PREFIX ('@')   /* Same prefix as the link commands */
+#define LINE_LATENCY_COMMAND      ('L')     /* "@L" asks for the percentiles, "@L0" clears them */
+#define LINE_LATENCY_CLEAR        ('0')
+#define LINE_LATENCY_VALUES       (4u)      /* p50, p99, p99.9 and the maximum */
+#define LINE_LATENCY_STAGE_TAGS   ("SCR")   /* Stage letter of each "@L" answer, in line_latency_stage_t order */
+
+/* Stages of a line, each timed from the carriage return that ended it on the PC channel. The cycle counter wraps
+ * after 2^32 cycles, 8.9 s at 480 MHz, so a longer stage is counted modulo that. */
+typedef enum e_line_latency_stage
+{
+    LINE_LATENCY_TX_START = 0,              /* First byte written to SCI0 */
+    LINE_LATENCY_TX_COMPLETE,               /* Last stop bit on the wire, UART_EVENT_TX_COMPLETE */
+    LINE_LATENCY_REPLY,                     /* Talk board ready prompt after the line */
+    LINE_LATENCY_STAGE_COUNT
+} line_latency_stage_t;
+
+/* Function declaration */
+void line_latency_reset(void);
+void line_latency_begin(uart_line_slot_t const * p_slot);
+void line_latency_cancel(void);
+void line_latency_tx_start(void * p_context);
+void line_latency_tx_complete(void);
+void line_latency_reply(void);
+void line_latency_percentiles(line_latency_stage_t stage, uint32_t * p_count, uint32_t p_us[LINE_LATENCY_VALUES]);
+void line_latency_report(void);
+
+#endif /* LINE_LATENCY_H_ */
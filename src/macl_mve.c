@@ -0,0 +1,580 @@
+/***********************************************************************************************************************
+ * File Name    : macl_mve.c
+ * Description  : Contains the R_BSP_Macl Q31 DSP functions for devices without the MACL, Helium (MVE) with a scalar
+ *                fallback.
+ **********************************************************************************************************************/
+
+#include <string.h>
+#include "bsp_api.h"
+#include "macl_mve.h"
+
+#if MACL_MVE_USE_MVE
+ #include <arm_mve.h>
+#endif
+
+/*******************************************************************************************************************//**
+ * @addtogroup macl_mve
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#ifndef RESET_VALUE
+ #define RESET_VALUE              (0x00)    /* common_utils.h is not included so the file also builds on the PC */
+#endif
+#define MACL_MVE_LANES            (4u)      /* Q31 values per Helium vector */
+#define MACL_MVE_Q31_MAX          (INT32_MAX)
+#define MACL_MVE_Q31_MIN          (INT32_MIN)
+#define MACL_MVE_Q31_SHIFT        (31)      /* Q62 products back to Q31 */
+#define MACL_MVE_SCALE_SHIFT_MIN  (-31)     /* Scale shifts beyond these give the same results */
+#define MACL_MVE_SCALE_SHIFT_MAX  (32)
+#define MACL_MVE_BIQUAD_TAPS      (5u)      /* b0, b1, b2, a1, a2 */
+#define MACL_MVE_BIQUAD_STATE     (4u)      /* x[n-1], x[n-2], y[n-1], y[n-2] */
+
+/*
+ * Private function declarations
+ */
+static uint64_t macl_mve_mac(uint64_t acc, q31_t const * p_a, q31_t const * p_b, uint32_t length, bool vector);
+static uint64_t macl_mve_mac_reversed(uint64_t acc, q31_t const * p_a, q31_t const * p_b, uint32_t length,
+                                      bool vector);
+static q31_t macl_mve_clip(int64_t value);
+static int32_t macl_mve_scale_shift(int8_t shift);
+static void macl_mve_mul(const q31_t * p_src_a, const q31_t * p_src_b, q31_t * p_dst, uint32_t block_size,
+                         bool vector);
+static void macl_mve_scale(const q31_t * p_src, q31_t scale_fract, int8_t shift, q31_t * p_dst, uint32_t block_size,
+                           bool vector);
+static void macl_mve_fir(const arm_fir_instance_q31 * p_fir_inst, const q31_t * p_src, q31_t * p_dst,
+                         uint32_t block_size, bool vector);
+static void macl_mve_conv(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b, uint32_t src_b_len,
+                          q31_t * p_dst, bool vector);
+static void macl_mve_correlate(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b, uint32_t src_b_len,
+                               q31_t * p_dst, bool vector);
+static void macl_mve_biquad_df1(const arm_biquad_casd_df1_inst_q31 * p_biquad_csd_df1_inst, const q31_t * p_src,
+                                q31_t * p_dst, uint32_t block_size, bool vector);
+static void macl_mve_lms(const arm_lms_instance_q31 * p_lms_ins_q31, const q31_t * p_src, q31_t * p_ref,
+                         q31_t * p_out, q31_t * p_err, uint32_t block_size, bool vector);
+
+/* bsp_macl.c has the MACL versions of these on the devices that have one */
+#if !BSP_FEATURE_MACL_SUPPORTED
+
+/*****************************************************************************************************************
+ *  @brief       Multiply two vectors, (a * b) >> 31 saturated as the MACL fixed point mode gives it
+ *  @param[in]   p_src_a       First vector
+ *  @param[in]   p_src_b       Second vector
+ *  @param[out]  p_dst         Products, may be one of the inputs
+ *  @param[in]   block_size    Number of values
+ *  @retval      None
+ ****************************************************************************************************************/
+void R_BSP_MaclMulQ31(const q31_t * p_src_a, const q31_t * p_src_b, q31_t * p_dst, uint32_t block_size)
+{
+    macl_mve_mul(p_src_a, p_src_b, p_dst, block_size, MACL_MVE_USE_MVE);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Scale a vector, ((x * scale_fract) >> 32) shifted left by shift + 1 with saturation
+ *  @param[in]   p_src          Vector
+ *  @param[in]   scale_fract    Scale factor
+ *  @param[in]   shift          Shift after the scaling, a negative one shifts right
+ *  @param[out]  p_dst          Scaled values, may be the input
+ *  @param[in]   block_size     Number of values
+ *  @retval      None
+ ****************************************************************************************************************/
+void R_BSP_MaclScaleQ31(const q31_t * p_src, q31_t scale_fract, int8_t shift, q31_t * p_dst, uint32_t block_size)
+{
+    macl_mve_scale(p_src, scale_fract, shift, p_dst, block_size, MACL_MVE_USE_MVE);
+}
+
+/*****************************************************************************************************************
+ *  @brief       FIR filter, 64-bit accumulation and the sum >> 31 as output
+ *  @param[in]   p_fir_inst    Filter, its state is updated
+ *  @param[in]   p_src         Input samples
+ *  @param[out]  p_dst         Output samples, may be the input
+ *  @param[in]   block_size    Number of samples
+ *  @retval      None
+ ****************************************************************************************************************/
+void R_BSP_MaclFirQ31(const arm_fir_instance_q31 * p_fir_inst, const q31_t * p_src, q31_t * p_dst, uint32_t block_size)
+{
+    macl_mve_fir(p_fir_inst, p_src, p_dst, block_size, MACL_MVE_USE_MVE);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Convolution of two sequences, each output the 64-bit sum >> 31
+ *  @param[in]   p_src_a      First sequence
+ *  @param[in]   src_a_len    Its length
+ *  @param[in]   p_src_b      Second sequence
+ *  @param[in]   src_b_len    Its length
+ *  @param[out]  p_dst        src_a_len + src_b_len - 1 outputs
+ *  @retval      None
+ ****************************************************************************************************************/
+void R_BSP_MaclConvQ31(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b, uint32_t src_b_len,
+                       q31_t * p_dst)
+{
+    macl_mve_conv(p_src_a, src_a_len, p_src_b, src_b_len, p_dst, MACL_MVE_USE_MVE);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Cross-correlation of two sequences, each output the 64-bit sum >> 31
+ *  @param[in]   p_src_a      First sequence
+ *  @param[in]   src_a_len    Its length
+ *  @param[in]   p_src_b      Second sequence
+ *  @param[in]   src_b_len    Its length
+ *  @param[out]  p_dst        2 * max(src_a_len, src_b_len) - 1 outputs. The ones the shorter sequence does not reach
+ *                            are zero.
+ *  @retval      None
+ ****************************************************************************************************************/
+void R_BSP_MaclCorrelateQ31(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b, uint32_t src_b_len,
+                            q31_t * p_dst)
+{
+    macl_mve_correlate(p_src_a, src_a_len, p_src_b, src_b_len, p_dst, MACL_MVE_USE_MVE);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Biquad cascade, direct form I. Each stage sums in 64 bits and outputs the sum >> (31 - postShift).
+ *  @param[in]   p_biquad_csd_df1_inst    Filter, its state is updated
+ *  @param[in]   p_src                    Input samples
+ *  @param[out]  p_dst                    Output samples, may be the input
+ *  @param[in]   block_size               Number of samples
+ *  @retval      None
+ ****************************************************************************************************************/
+void R_BSP_MaclBiquadCsdDf1Q31(const arm_biquad_casd_df1_inst_q31 * p_biquad_csd_df1_inst, const q31_t * p_src,
+                               q31_t * p_dst, uint32_t block_size)
+{
+    macl_mve_biquad_df1(p_biquad_csd_df1_inst, p_src, p_dst, block_size, MACL_MVE_USE_MVE);
+}
+
+/*****************************************************************************************************************
+ *  @brief       LMS adaptive filter. The output is the 64-bit sum >> (31 - postShift), the error is saturated.
+ *  @param[in]   p_lms_ins_q31    Filter, its state and coefficients are updated
+ *  @param[in]   p_src            Input samples
+ *  @param[in]   p_ref            Reference samples
+ *  @param[out]  p_out            Output samples
+ *  @param[out]  p_err            Reference minus output
+ *  @param[in]   block_size       Number of samples
+ *  @retval      None
+ ****************************************************************************************************************/
+void R_BSP_MaclLmsQ31(const arm_lms_instance_q31 * p_lms_ins_q31, const q31_t * p_src, q31_t * p_ref, q31_t * p_out,
+                      q31_t * p_err, uint32_t block_size)
+{
+    macl_mve_lms(p_lms_ins_q31, p_src, p_ref, p_out, p_err, block_size, MACL_MVE_USE_MVE);
+}
+#endif
+
+/*****************************************************************************************************************
+ *  @brief       Scalar R_BSP_MaclMulQ31(), the fallback and the reference for the Helium version
+ ****************************************************************************************************************/
+void macl_mve_mul_q31_scalar(const q31_t * p_src_a, const q31_t * p_src_b, q31_t * p_dst, uint32_t block_size)
+{
+    macl_mve_mul(p_src_a, p_src_b, p_dst, block_size, false);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Scalar R_BSP_MaclScaleQ31(), the fallback and the reference for the Helium version
+ ****************************************************************************************************************/
+void macl_mve_scale_q31_scalar(const q31_t * p_src, q31_t scale_fract, int8_t shift, q31_t * p_dst,
+                               uint32_t block_size)
+{
+    macl_mve_scale(p_src, scale_fract, shift, p_dst, block_size, false);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Scalar R_BSP_MaclFirQ31(), the fallback and the reference for the Helium version
+ ****************************************************************************************************************/
+void macl_mve_fir_q31_scalar(const arm_fir_instance_q31 * p_fir_inst, const q31_t * p_src, q31_t * p_dst,
+                             uint32_t block_size)
+{
+    macl_mve_fir(p_fir_inst, p_src, p_dst, block_size, false);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Scalar R_BSP_MaclConvQ31(), the fallback and the reference for the Helium version
+ ****************************************************************************************************************/
+void macl_mve_conv_q31_scalar(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b, uint32_t src_b_len,
+                              q31_t * p_dst)
+{
+    macl_mve_conv(p_src_a, src_a_len, p_src_b, src_b_len, p_dst, false);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Scalar R_BSP_MaclCorrelateQ31(), the fallback and the reference for the Helium version
+ ****************************************************************************************************************/
+void macl_mve_correlate_q31_scalar(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b,
+                                   uint32_t src_b_len, q31_t * p_dst)
+{
+    macl_mve_correlate(p_src_a, src_a_len, p_src_b, src_b_len, p_dst, false);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Scalar R_BSP_MaclBiquadCsdDf1Q31(), the fallback and the reference for the Helium version
+ ****************************************************************************************************************/
+void macl_mve_biquad_df1_q31_scalar(const arm_biquad_casd_df1_inst_q31 * p_biquad_csd_df1_inst, const q31_t * p_src,
+                                    q31_t * p_dst, uint32_t block_size)
+{
+    macl_mve_biquad_df1(p_biquad_csd_df1_inst, p_src, p_dst, block_size, false);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Scalar R_BSP_MaclLmsQ31(), the fallback and the reference for the Helium version
+ ****************************************************************************************************************/
+void macl_mve_lms_q31_scalar(const arm_lms_instance_q31 * p_lms_ins_q31, const q31_t * p_src, q31_t * p_ref,
+                             q31_t * p_out, q31_t * p_err, uint32_t block_size)
+{
+    macl_mve_lms(p_lms_ins_q31, p_src, p_ref, p_out, p_err, block_size, false);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Add the products of two sequences to a 64-bit sum. It wraps like the MACL result register and the
+ *               Helium long accumulate, the sum of two products can already exceed 63 bits.
+ *  @param[in]   acc       Sum so far
+ *  @param[in]   p_a       First sequence
+ *  @param[in]   p_b       Second sequence
+ *  @param[in]   length    Number of products
+ *  @param[in]   vector    Use the Helium instructions, when built with them
+ *  @retval      New sum
+ ****************************************************************************************************************/
+static uint64_t macl_mve_mac(uint64_t acc, q31_t const * p_a, q31_t const * p_b, uint32_t length, bool vector)
+{
+#if MACL_MVE_USE_MVE
+    if (vector)
+    {
+        int64_t sum = (int64_t) acc;
+
+        for (uint32_t i = RESET_VALUE; i < length; i += MACL_MVE_LANES)
+        {
+            /* The tail predicate keeps the last loads inside the sequences */
+            mve_pred16_t active = vctp32q(length - i);
+            int32x4_t    a      = vldrwq_z_s32(&p_a[i], active);
+            int32x4_t    b      = vldrwq_z_s32(&p_b[i], active);
+
+            sum = vmlaldavaq_p_s32(sum, a, b, active);
+        }
+        return (uint64_t) sum;
+    }
+#endif
+    FSP_PARAMETER_NOT_USED(vector);
+    for (uint32_t i = RESET_VALUE; i < length; i++)
+    {
+        acc += (uint64_t) ((int64_t) p_a[i] * p_b[i]);
+    }
+    return acc;
+}
+
+/*****************************************************************************************************************
+ *  @brief       macl_mve_mac() with the second sequence read backwards, p_a[i] times p_b[length - 1 - i]
+ *  @param[in]   acc       Sum so far
+ *  @param[in]   p_a       First sequence
+ *  @param[in]   p_b       Second sequence, first element in memory
+ *  @param[in]   length    Number of products
+ *  @param[in]   vector    Use the Helium instructions, when built with them
+ *  @retval      New sum
+ ****************************************************************************************************************/
+static uint64_t macl_mve_mac_reversed(uint64_t acc, q31_t const * p_a, q31_t const * p_b, uint32_t length,
+                                      bool vector)
+{
+#if MACL_MVE_USE_MVE
+    if (vector)
+    {
+        int64_t sum = (int64_t) acc;
+
+        for (uint32_t i = RESET_VALUE; i < length; i += MACL_MVE_LANES)
+        {
+            /* Byte offsets counting down, the lanes past the end are neither loaded nor summed */
+            mve_pred16_t active = vctp32q(length - i);
+            uint32_t     last   = (length - 1u - i) * sizeof(q31_t);
+            int32x4_t    a      = vldrwq_z_s32(&p_a[i], active);
+            int32x4_t    b      = vldrwq_gather_offset_z_s32(p_b, vddupq_n_u32(last, sizeof(q31_t)), active);
+
+            sum = vmlaldavaq_p_s32(sum, a, b, active);
+        }
+        return (uint64_t) sum;
+    }
+#endif
+    FSP_PARAMETER_NOT_USED(vector);
+    for (uint32_t i = RESET_VALUE; i < length; i++)
+    {
+        acc += (uint64_t) ((int64_t) p_a[i] * p_b[length - 1u - i]);
+    }
+    return acc;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Saturate to Q31
+ *  @param[in]   value    64-bit value
+ *  @retval      value limited to the Q31 range
+ ****************************************************************************************************************/
+static q31_t macl_mve_clip(int64_t value)
+{
+    if (value > MACL_MVE_Q31_MAX)
+    {
+        return MACL_MVE_Q31_MAX;
+    }
+    if (value < MACL_MVE_Q31_MIN)
+    {
+        return MACL_MVE_Q31_MIN;
+    }
+    return (q31_t) value;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Left shift applied after the scaling. A product >> 32 has 31 significant bits at most, so shifts
+ *               beyond the limits give the same results as the limits, and both paths stay defined.
+ *  @param[in]   shift    Shift requested
+ *  @retval      shift + 1, limited
+ ****************************************************************************************************************/
+static int32_t macl_mve_scale_shift(int8_t shift)
+{
+    int32_t scale_shift = shift + 1;
+
+    if (scale_shift > MACL_MVE_SCALE_SHIFT_MAX)
+    {
+        return MACL_MVE_SCALE_SHIFT_MAX;
+    }
+    if (scale_shift < MACL_MVE_SCALE_SHIFT_MIN)
+    {
+        return MACL_MVE_SCALE_SHIFT_MIN;
+    }
+    return scale_shift;
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclMulQ31() on either path. VQDMULH gives the same saturated (a * b) >> 31.
+ ****************************************************************************************************************/
+static void macl_mve_mul(const q31_t * p_src_a, const q31_t * p_src_b, q31_t * p_dst, uint32_t block_size,
+                         bool vector)
+{
+#if MACL_MVE_USE_MVE
+    if (vector)
+    {
+        for (uint32_t i = RESET_VALUE; i < block_size; i += MACL_MVE_LANES)
+        {
+            mve_pred16_t active = vctp32q(block_size - i);
+            int32x4_t    a      = vldrwq_z_s32(&p_src_a[i], active);
+            int32x4_t    b      = vldrwq_z_s32(&p_src_b[i], active);
+
+            vstrwq_p_s32(&p_dst[i], vqdmulhq_s32(a, b), active);
+        }
+        return;
+    }
+#endif
+    FSP_PARAMETER_NOT_USED(vector);
+    for (uint32_t i = RESET_VALUE; i < block_size; i++)
+    {
+        /* Only -1 * -1 leaves the range */
+        p_dst[i] = macl_mve_clip(((int64_t) p_src_a[i] * p_src_b[i]) >> MACL_MVE_Q31_SHIFT);
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclScaleQ31() on either path. VMULH gives the product >> 32, VQSHL the saturating left shift
+ *               or, for a negative shift, the truncating right shift.
+ ****************************************************************************************************************/
+static void macl_mve_scale(const q31_t * p_src, q31_t scale_fract, int8_t shift, q31_t * p_dst, uint32_t block_size,
+                           bool vector)
+{
+    int32_t scale_shift = macl_mve_scale_shift(shift);
+
+#if MACL_MVE_USE_MVE
+    if (vector)
+    {
+        int32x4_t scale  = vdupq_n_s32(scale_fract);
+        int32x4_t amount = vdupq_n_s32(scale_shift);
+
+        for (uint32_t i = RESET_VALUE; i < block_size; i += MACL_MVE_LANES)
+        {
+            mve_pred16_t active = vctp32q(block_size - i);
+            int32x4_t    in     = vldrwq_z_s32(&p_src[i], active);
+
+            vstrwq_p_s32(&p_dst[i], vqshlq_s32(vmulhq_s32(in, scale), amount), active);
+        }
+        return;
+    }
+#endif
+    FSP_PARAMETER_NOT_USED(vector);
+    for (uint32_t i = RESET_VALUE; i < block_size; i++)
+    {
+        int64_t product = ((int64_t) p_src[i] * scale_fract) >> 32;
+
+        if (scale_shift >= 0)
+        {
+            p_dst[i] = macl_mve_clip(product * ((int64_t) 1 << scale_shift));
+        }
+        else
+        {
+            p_dst[i] = (q31_t) (product >> -scale_shift);
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclFirQ31() on either path
+ ****************************************************************************************************************/
+static void macl_mve_fir(const arm_fir_instance_q31 * p_fir_inst, const q31_t * p_src, q31_t * p_dst,
+                         uint32_t block_size, bool vector)
+{
+    q31_t  * p_state  = p_fir_inst->pState;
+    uint32_t num_taps = p_fir_inst->numTaps;
+
+    for (uint32_t n = RESET_VALUE; n < block_size; n++)
+    {
+        /* Sample by sample so the output may overwrite the input */
+        p_state[num_taps - 1u + n] = p_src[n];
+
+        uint64_t acc = macl_mve_mac(RESET_VALUE, &p_state[n], p_fir_inst->pCoeffs, num_taps, vector);
+        p_dst[n] = (q31_t) ((int64_t) acc >> MACL_MVE_Q31_SHIFT);
+    }
+
+    /* Keep the last num_taps - 1 samples for the next block */
+    memmove(p_state, &p_state[block_size], (num_taps - 1u) * sizeof(q31_t));
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclConvQ31() on either path, y[n] = sum of a[k] * b[n - k]
+ ****************************************************************************************************************/
+static void macl_mve_conv(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b, uint32_t src_b_len,
+                          q31_t * p_dst, bool vector)
+{
+    if ((RESET_VALUE == src_a_len) || (RESET_VALUE == src_b_len))
+    {
+        return;
+    }
+
+    for (uint32_t n = RESET_VALUE; n < (src_a_len + src_b_len - 1u); n++)
+    {
+        uint32_t first = (n >= src_b_len) ? (n - (src_b_len - 1u)) : RESET_VALUE;
+        uint32_t last  = (n < src_a_len) ? n : (src_a_len - 1u);
+
+        /* a[first] to a[last] against b[n - first] down to b[n - last] */
+        uint64_t acc = macl_mve_mac_reversed(RESET_VALUE, &p_src_a[first], &p_src_b[n - last], (last - first) + 1u,
+                                             vector);
+        p_dst[n] = (q31_t) ((int64_t) acc >> MACL_MVE_Q31_SHIFT);
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclCorrelateQ31() on either path. Output max(src_a_len, src_b_len) - 1 + l is the sum of
+ *               a[l + k] * b[k], for the lags l from -(src_b_len - 1) to src_a_len - 1. This is where the MACL
+ *               version puts them; it leaves the outputs of the other lags alone, here they are zero.
+ ****************************************************************************************************************/
+static void macl_mve_correlate(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b, uint32_t src_b_len,
+                               q31_t * p_dst, bool vector)
+{
+    if ((RESET_VALUE == src_a_len) || (RESET_VALUE == src_b_len))
+    {
+        return;
+    }
+
+    uint32_t longer = (src_a_len > src_b_len) ? src_a_len : src_b_len;
+    memset(p_dst, RESET_VALUE, ((2u * longer) - 1u) * sizeof(q31_t));
+
+    /* Lag l is index + 1 - src_b_len, the output goes to index + longer - src_b_len */
+    for (uint32_t index = RESET_VALUE; index < (src_a_len + src_b_len - 1u); index++)
+    {
+        uint32_t a_first = (index >= (src_b_len - 1u)) ? (index - (src_b_len - 1u)) : RESET_VALUE;
+        uint32_t b_first = (index < (src_b_len - 1u)) ? ((src_b_len - 1u) - index) : RESET_VALUE;
+        uint32_t count   = src_b_len - b_first;
+
+        if (count > (src_a_len - a_first))
+        {
+            count = src_a_len - a_first;
+        }
+
+        uint64_t acc = macl_mve_mac(RESET_VALUE, &p_src_a[a_first], &p_src_b[b_first], count, vector);
+        p_dst[(index + longer) - src_b_len] = (q31_t) ((int64_t) acc >> MACL_MVE_Q31_SHIFT);
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclBiquadCsdDf1Q31() on either path. The state is used from the first sample on. The MACL
+ *               version leaves out the products of x[n-1], x[n-2], y[n-1] and y[n-2] for the first two samples of a
+ *               call, which only matches this when the state is zero.
+ ****************************************************************************************************************/
+static void macl_mve_biquad_df1(const arm_biquad_casd_df1_inst_q31 * p_biquad_csd_df1_inst, const q31_t * p_src,
+                                q31_t * p_dst, uint32_t block_size, bool vector)
+{
+    uint32_t      shift = MACL_MVE_Q31_SHIFT - (uint32_t) p_biquad_csd_df1_inst->postShift;
+    const q31_t * p_in  = p_src;
+
+    for (uint32_t stage = RESET_VALUE; stage < p_biquad_csd_df1_inst->numStages; stage++)
+    {
+        const q31_t * p_coeffs = &p_biquad_csd_df1_inst->pCoeffs[stage * MACL_MVE_BIQUAD_TAPS];
+        q31_t       * p_state  = &p_biquad_csd_df1_inst->pState[stage * MACL_MVE_BIQUAD_STATE];
+
+        for (uint32_t n = RESET_VALUE; n < block_size; n++)
+        {
+            /* x[n] followed by the state lines up with b0, b1, b2, a1, a2. The recursion leaves one short sum per
+             * sample, Helium does it in two predicated steps. */
+            q31_t taps[MACL_MVE_BIQUAD_TAPS] = {p_in[n], p_state[0], p_state[1], p_state[2], p_state[3]};
+
+            uint64_t acc = macl_mve_mac(RESET_VALUE, taps, p_coeffs, MACL_MVE_BIQUAD_TAPS, vector);
+            q31_t    out = (q31_t) ((int64_t) acc >> shift);
+
+            p_state[1] = p_state[0];
+            p_state[0] = p_in[n];
+            p_state[3] = p_state[2];
+            p_state[2] = out;
+            p_dst[n]   = out;
+        }
+
+        /* The next stage filters this one's output */
+        p_in = p_dst;
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclLmsQ31() on either path. Each coefficient moves by 2 * ((alpha * x) >> 32), saturated.
+ *               VMULH gives the product >> 32 and two saturating adds give the saturated sum.
+ ****************************************************************************************************************/
+static void macl_mve_lms(const arm_lms_instance_q31 * p_lms_ins_q31, const q31_t * p_src, q31_t * p_ref,
+                         q31_t * p_out, q31_t * p_err, uint32_t block_size, bool vector)
+{
+    q31_t  * p_state  = p_lms_ins_q31->pState;
+    q31_t  * p_coeffs = p_lms_ins_q31->pCoeffs;
+    uint32_t num_taps = p_lms_ins_q31->numTaps;
+    uint32_t shift    = MACL_MVE_Q31_SHIFT - p_lms_ins_q31->postShift;
+
+    for (uint32_t n = RESET_VALUE; n < block_size; n++)
+    {
+        q31_t * p_taps = &p_state[n];
+
+        p_state[num_taps - 1u + n] = p_src[n];
+
+        uint64_t acc   = macl_mve_mac(RESET_VALUE, p_taps, p_coeffs, num_taps, vector);
+        q31_t    out   = (q31_t) ((int64_t) acc >> shift);
+        q31_t    err   = macl_mve_clip((int64_t) p_ref[n] - out);
+        q31_t    alpha = (q31_t) (((int64_t) err * p_lms_ins_q31->mu) >> MACL_MVE_Q31_SHIFT);
+
+        p_out[n] = out;
+        p_err[n] = err;
+
+#if MACL_MVE_USE_MVE
+        if (vector)
+        {
+            int32x4_t step = vdupq_n_s32(alpha);
+
+            for (uint32_t i = RESET_VALUE; i < num_taps; i += MACL_MVE_LANES)
+            {
+                mve_pred16_t active = vctp32q(num_taps - i);
+                int32x4_t    x      = vldrwq_z_s32(&p_taps[i], active);
+                int32x4_t    coeff  = vldrwq_z_s32(&p_coeffs[i], active);
+                int32x4_t    delta  = vmulhq_s32(step, x);
+
+                vstrwq_p_s32(&p_coeffs[i], vqaddq_s32(vqaddq_s32(coeff, delta), delta), active);
+            }
+            continue;
+        }
+#endif
+        for (uint32_t i = RESET_VALUE; i < num_taps; i++)
+        {
+            int64_t delta = ((int64_t) alpha * p_taps[i]) >> 32;
+
+            p_coeffs[i] = macl_mve_clip((int64_t) p_coeffs[i] + (2 * delta));
+        }
+    }
+
+    /* Keep the last num_taps - 1 samples for the next block */
+    memmove(p_state, &p_state[block_size], (num_taps - 1u) * sizeof(q31_t));
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup macl_mve)
+ **********************************************************************************************************************/
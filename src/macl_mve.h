@@ -0,0 +1,84 @@
+/***********************************************************************************************************************
+ * File Name    : macl_mve.h
+ * Description  : Contains data structures and function declarations of macl_mve.c.
+ **********************************************************************************************************************/
+
+#ifndef MACL_MVE_H_
+#define MACL_MVE_H_
+
+/* Only standard headers here, the kernels also build on the PC to compare against the scalar versions */
+#include <stdint.h>
+
+/* Macro definition */
+#ifndef MACL_MVE_USE_MVE
+ #if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+  #define MACL_MVE_USE_MVE        (1)       /* Helium integer instructions available, see -march=...+mve */
+ #else
+  #define MACL_MVE_USE_MVE        (0)
+ #endif
+#endif
+
+/* The R_BSP_Macl API takes the CMSIS-DSP types. Without CMSIS-DSP in the project the types it uses are declared here
+ * with the same layout, so the calls stay the same once the library is added. */
+#if __has_include("arm_math_types.h")
+ #include "arm_math_types.h"
+ #include "dsp/filtering_functions.h"
+#else
+typedef int32_t q31_t;
+typedef int64_t q63_t;
+
+/* Q31 FIR filter, see arm_fir_instance_q31 */
+typedef struct
+{
+    uint16_t      numTaps;                  /* Coefficients */
+    q31_t       * pState;                   /* numTaps + block size - 1 samples */
+    const q31_t * pCoeffs;                  /* Coefficients in time reversed order */
+} arm_fir_instance_q31;
+
+/* Q31 biquad cascade, direct form I, see arm_biquad_casd_df1_inst_q31 */
+typedef struct
+{
+    uint32_t      numStages;                /* Second order stages */
+    q31_t       * pState;                   /* x[n-1], x[n-2], y[n-1], y[n-2] per stage */
+    const q31_t * pCoeffs;                  /* b0, b1, b2, a1, a2 per stage */
+    uint8_t       postShift;                /* Left shift of the output, for coefficients beyond +/-1 */
+} arm_biquad_casd_df1_inst_q31;
+
+/* Q31 LMS adaptive filter, see arm_lms_instance_q31 */
+typedef struct
+{
+    uint16_t numTaps;                       /* Coefficients */
+    q31_t  * pState;                        /* numTaps + block size - 1 samples */
+    q31_t  * pCoeffs;                       /* Coefficients in time reversed order, adapted in place */
+    q31_t    mu;                            /* Step size */
+    uint32_t postShift;                     /* Left shift of the output, for coefficients beyond +/-1 */
+} arm_lms_instance_q31;
+#endif
+
+/* Function declaration */
+void R_BSP_MaclMulQ31(const q31_t * p_src_a, const q31_t * p_src_b, q31_t * p_dst, uint32_t block_size);
+void R_BSP_MaclScaleQ31(const q31_t * p_src, q31_t scale_fract, int8_t shift, q31_t * p_dst, uint32_t block_size);
+void R_BSP_MaclFirQ31(const arm_fir_instance_q31 * p_fir_inst, const q31_t * p_src, q31_t * p_dst, uint32_t block_size);
+void R_BSP_MaclConvQ31(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b, uint32_t src_b_len,
+                       q31_t * p_dst);
+void R_BSP_MaclCorrelateQ31(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b, uint32_t src_b_len,
+                            q31_t * p_dst);
+void R_BSP_MaclBiquadCsdDf1Q31(const arm_biquad_casd_df1_inst_q31 * p_biquad_csd_df1_inst, const q31_t * p_src,
+                               q31_t * p_dst, uint32_t block_size);
+void R_BSP_MaclLmsQ31(const arm_lms_instance_q31 * p_lms_ins_q31, const q31_t * p_src, q31_t * p_ref, q31_t * p_out,
+                      q31_t * p_err, uint32_t block_size);
+void macl_mve_mul_q31_scalar(const q31_t * p_src_a, const q31_t * p_src_b, q31_t * p_dst, uint32_t block_size);
+void macl_mve_scale_q31_scalar(const q31_t * p_src, q31_t scale_fract, int8_t shift, q31_t * p_dst,
+                               uint32_t block_size);
+void macl_mve_fir_q31_scalar(const arm_fir_instance_q31 * p_fir_inst, const q31_t * p_src, q31_t * p_dst,
+                             uint32_t block_size);
+void macl_mve_conv_q31_scalar(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b, uint32_t src_b_len,
+                              q31_t * p_dst);
+void macl_mve_correlate_q31_scalar(const q31_t * p_src_a, uint32_t src_a_len, const q31_t * p_src_b,
+                                   uint32_t src_b_len, q31_t * p_dst);
+void macl_mve_biquad_df1_q31_scalar(const arm_biquad_casd_df1_inst_q31 * p_biquad_csd_df1_inst, const q31_t * p_src,
+                                    q31_t * p_dst, uint32_t block_size);
+void macl_mve_lms_q31_scalar(const arm_lms_instance_q31 * p_lms_ins_q31, const q31_t * p_src, q31_t * p_ref,
+                             q31_t * p_out, q31_t * p_err, uint32_t block_size);
+
+#endif /* MACL_MVE_H_ */
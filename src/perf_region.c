@@ -0,0 +1,206 @@
+/***********************************************************************************************************************
+ * File Name    : perf_region.c
+ * Description  : Contains the performance counters of named code regions, taken from the Cortex-M85 PMU.
+ **********************************************************************************************************************/
+
+#include <string.h>
+#include "common_utils.h"
+#include "perf_region.h"
+
+#if PERF_REGION_ENABLED
+
+/*******************************************************************************************************************//**
+ * @addtogroup perf_region
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define PERF_COUNTER_MASK         (0xFFFFu) /* Width of one PMU event counter */
+#define PERF_COUNTER_SHIFT        (16u)
+
+/*
+ * Private function declarations
+ */
+static uint32_t perf_region_event_read(perf_event_t event);
+
+/* PMU event of each counted event, in perf_event_t order */
+static const uint32_t g_perf_event_types[PERF_EVENT_NUM] =
+{
+    ARM_PMU_INST_RETIRED,
+    ARM_PMU_L1D_CACHE_REFILL,
+    ARM_PMU_BR_MIS_PRED,
+    ARM_PMU_STALL_BACKEND,
+};
+
+/* Region names, in perf_region_id_t order */
+static char const * const g_perf_region_names[PERF_REGION_NUM] =
+{
+    "PC callback",
+    "EP callback",
+    "PC rx step",
+    "PC tx step",
+};
+
+/* Totals per region */
+static perf_region_t g_perf_regions[PERF_REGION_NUM];
+
+/*****************************************************************************************************************
+ *  @brief       Program the PMU: the cycle counter and one chained counter pair per event
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void perf_region_init(void)
+{
+    uint32_t mask = PMU_CNTENSET_CCNTR_ENABLE_Msk;
+
+    /* The PMU, like the DWT, only counts with trace enabled */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+
+    for (uint32_t i = RESET_VALUE; i < PERF_EVENT_NUM; i++)
+    {
+        ARM_PMU_Set_EVTYPER(2u * i, g_perf_event_types[i]);
+        ARM_PMU_Set_EVTYPER((2u * i) + 1u, ARM_PMU_CHAIN);
+        mask |= 3u << (2u * i);
+    }
+
+    ARM_PMU_CYCCNT_Reset();
+    ARM_PMU_EVCNTR_ALL_Reset();
+    ARM_PMU_CNTR_Enable(mask);
+    ARM_PMU_Enable();
+
+    perf_region_reset();
+}
+
+/*****************************************************************************************************************
+ *  @brief       Start a pass of a region. Callable from interrupts. A region already started is left as it is.
+ *  @param[in]   id    Region
+ *  @retval      None
+ ****************************************************************************************************************/
+void perf_region_begin(perf_region_id_t id)
+{
+    perf_region_t * p_region = &g_perf_regions[id];
+
+    if (p_region->active)
+    {
+        return;
+    }
+
+    for (uint32_t i = RESET_VALUE; i < PERF_EVENT_NUM; i++)
+    {
+        p_region->start_events[i] = perf_region_event_read((perf_event_t) i);
+    }
+
+    /* Read last, so the reads above are not counted */
+    p_region->start_cycles = ARM_PMU_Get_CCNTR();
+    p_region->active       = true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       End a pass of a region and add its counts to the totals
+ *  @param[in]   id    Region
+ *  @retval      None
+ ****************************************************************************************************************/
+void perf_region_end(perf_region_id_t id)
+{
+    uint32_t        cycles   = ARM_PMU_Get_CCNTR();
+    perf_region_t * p_region = &g_perf_regions[id];
+
+    if (!p_region->active)
+    {
+        return;
+    }
+
+    /* Unsigned differences stay right across a counter wrap */
+    cycles -= p_region->start_cycles;
+    for (uint32_t i = RESET_VALUE; i < PERF_EVENT_NUM; i++)
+    {
+        p_region->events[i] += perf_region_event_read((perf_event_t) i) - p_region->start_events[i];
+    }
+
+    p_region->cycles += cycles;
+    if (cycles > p_region->cycles_max)
+    {
+        p_region->cycles_max = cycles;
+    }
+    p_region->count++;
+    p_region->active = false;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Clear the totals of every region
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void perf_region_reset(void)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    FSP_CRITICAL_SECTION_ENTER;
+    memset(g_perf_regions, RESET_VALUE, sizeof(g_perf_regions));
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Print one line per region: passes, mean and longest cycles, instructions per cycle, and per pass the
+ *               L1 D-cache refills, mispredicted branches and back end stall cycles. Low IPC with many stalls and
+ *               refills points at memory, low IPC without them at dependent computation.
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void perf_region_report(void)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    APP_REPLY("\r\nRegion         passes  cycles    max  IPCx100  L1D refill  mispredict  stall%%\r\n");
+    for (uint32_t id = RESET_VALUE; id < PERF_REGION_NUM; id++)
+    {
+        perf_region_t region;
+
+        /* The interrupts add to the totals, take a consistent copy */
+        FSP_CRITICAL_SECTION_ENTER;
+        region = g_perf_regions[id];
+        FSP_CRITICAL_SECTION_EXIT;
+
+        if (RESET_VALUE == region.count)
+        {
+            APP_REPLY("%-12s  %7d\r\n", g_perf_region_names[id], 0);
+            continue;
+        }
+
+        APP_REPLY("%-12s  %7d  %6d  %5d  %7d  %10d  %10d  %6d\r\n", g_perf_region_names[id], region.count,
+                  (uint32_t) (region.cycles / region.count), region.cycles_max,
+                  (uint32_t) ((region.events[PERF_EVENT_INSTRUCTIONS] * 100u) / region.cycles),
+                  (uint32_t) (region.events[PERF_EVENT_L1D_REFILLS] / region.count),
+                  (uint32_t) (region.events[PERF_EVENT_MISPREDICTS] / region.count),
+                  (uint32_t) ((region.events[PERF_EVENT_BACKEND_STALLS] * 100u) / region.cycles));
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Read a chained counter pair as one 32-bit count
+ *  @param[in]   event    Counted event
+ *  @retval      Count
+ ****************************************************************************************************************/
+static uint32_t perf_region_event_read(perf_event_t event)
+{
+    uint32_t counter = 2u * (uint32_t) event;
+    uint32_t high;
+    uint32_t low;
+
+    /* The lower half may carry into the upper one between the two reads */
+    do
+    {
+        high = ARM_PMU_Get_EVCNTR(counter + 1u);
+        low  = ARM_PMU_Get_EVCNTR(counter);
+    } while (high != ARM_PMU_Get_EVCNTR(counter + 1u));
+
+    return ((high & PERF_COUNTER_MASK) << PERF_COUNTER_SHIFT) | (low & PERF_COUNTER_MASK);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup perf_region)
+ **********************************************************************************************************************/
+
+#endif /* PERF_REGION_ENABLED */
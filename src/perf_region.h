@@ -0,0 +1,64 @@
+/***********************************************************************************************************************
+ * File Name    : perf_region.h
+ * Description  : Contains data structures and function declarations of perf_region.c.
+ **********************************************************************************************************************/
+
+#ifndef PERF_REGION_H_
+#define PERF_REGION_H_
+
+#include <stdint.h>
+#include "bsp_api.h"
+
+/* Macro definition */
+#define PERF_REGION_ENABLED       (1)       /* 1: PMU counts accumulated per region, printed by RTT key 'm'.
+                                             * 0: PERF_REGION_BEGIN/PERF_REGION_END compile to nothing. */
+
+/* Counted events. The PMU event counters are 16 bits wide, each event takes an even counter and the odd one above
+ * it chained for the upper half. The cycle counter is 32 bits wide on its own. */
+typedef enum e_perf_event
+{
+    PERF_EVENT_INSTRUCTIONS = 0,            /* ARM_PMU_INST_RETIRED */
+    PERF_EVENT_L1D_REFILLS,                 /* ARM_PMU_L1D_CACHE_REFILL, 0 while BSP_CFG_DCACHE_ENABLED is 0 */
+    PERF_EVENT_MISPREDICTS,                 /* ARM_PMU_BR_MIS_PRED */
+    PERF_EVENT_BACKEND_STALLS,              /* ARM_PMU_STALL_BACKEND, cycles waiting for data or execution units */
+    PERF_EVENT_NUM,
+} perf_event_t;
+
+/* Measured regions */
+typedef enum e_perf_region_id
+{
+    PERF_REGION_PC_CALLBACK = 0,            /* uart_pc_callback(), in the SCI2 and DMAC interrupts */
+    PERF_REGION_EP_CALLBACK,                /* user_uart_callback(), in the SCI0 interrupts */
+    PERF_REGION_PC_RX_STEP,                 /* Receive path, line and frame parsing */
+    PERF_REGION_PC_TX_STEP,                 /* Utterance queue feeding the talk board */
+    PERF_REGION_NUM,
+} perf_region_id_t;
+
+/* Totals of one region. Interrupts taken inside a region are counted in it. */
+typedef struct st_perf_region
+{
+    uint32_t start_cycles;                     /* Counters at perf_region_begin() */
+    uint32_t start_events[PERF_EVENT_NUM];
+    bool     active;                           /* Between begin and end */
+    uint32_t count;                            /* Completed passes */
+    uint64_t cycles;                           /* Totals over the passes */
+    uint32_t cycles_max;                       /* Longest pass */
+    uint64_t events[PERF_EVENT_NUM];
+} perf_region_t;
+
+#if PERF_REGION_ENABLED
+ #define PERF_REGION_BEGIN(id)    perf_region_begin(id)
+ #define PERF_REGION_END(id)      perf_region_end(id)
+#else
+ #define PERF_REGION_BEGIN(id)
+ #define PERF_REGION_END(id)
+#endif
+
+/* Function declaration */
+void perf_region_init(void);
+void perf_region_begin(perf_region_id_t id);
+void perf_region_end(perf_region_id_t id);
+void perf_region_reset(void);
+void perf_region_report(void);
+
+#endif /* PERF_REGION_H_ */
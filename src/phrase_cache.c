@@ -0,0 +1,263 @@
+/***********************************************************************************************************************
+ * File Name    : phrase_cache.c
+ * Description  : Contains the cache of the phrases the PC sends most often.
+ **********************************************************************************************************************/
+
+#include <string.h>
+#include "phrase_cache.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup phrase_cache
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#ifndef RESET_VALUE
+ #define RESET_VALUE              (0x00)
+#endif
+#define PHRASE_CACHE_FNV_OFFSET   (0x811C9DC5u)   /* FNV-1a 32-bit offset basis */
+#define PHRASE_CACHE_FNV_PRIME    (0x01000193u)   /* FNV-1a 32-bit prime */
+#define PHRASE_CACHE_COMMAND_SIZE (2u + PHRASE_CACHE_HASH_DIGITS + PHRASE_CACHE_LENGTH_DIGITS + 1u)  /* "@C", hash,
+                                                                                           * length and CR */
+
+/*
+ * Private function declarations
+ */
+static void phrase_cache_use(phrase_cache_t * p_cache, phrase_cache_entry_t * p_entry);
+static phrase_cache_entry_t * phrase_cache_victim(phrase_cache_t * p_cache);
+static phrase_cache_entry_t * phrase_cache_find(phrase_cache_t * p_cache, uint32_t hash, uint32_t length);
+
+/* One entry is exactly one slot of the cache image */
+typedef char phrase_cache_entry_size_check_t[(sizeof(phrase_cache_entry_t) == PHRASE_CACHE_ENTRY_SIZE) ? 1 : -1];
+
+/*****************************************************************************************************************
+ *  @brief       Empty the cache
+ *  @param[in]   p_cache    Cache to initialize
+ *  @retval      None
+ ****************************************************************************************************************/
+void phrase_cache_init(phrase_cache_t * p_cache)
+{
+    memset(p_cache, RESET_VALUE, sizeof(*p_cache));
+}
+
+/*****************************************************************************************************************
+ *  @brief       Key of a line, FNV-1a over its text
+ *  @param[in]   p_text    Line text without the carriage return
+ *  @param[in]   length    Text bytes
+ *  @retval      32-bit hash
+ ****************************************************************************************************************/
+uint32_t phrase_cache_hash(uint8_t const * p_text, uint32_t length)
+{
+    uint32_t hash = PHRASE_CACHE_FNV_OFFSET;
+
+    for (uint32_t i = RESET_VALUE; i < length; i++)
+    {
+        hash = (hash ^ p_text[i]) * PHRASE_CACHE_FNV_PRIME;
+    }
+    return hash;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Parse a play command
+ *  @param[in]   p_line    Received line, carriage return included
+ *  @param[in]   length    Line length
+ *  @param[out]  p_hash    Hash the command asks for
+ *  @param[out]  p_length  Text length the command asks for
+ *  @retval      true when the line is a well formed play command
+ ****************************************************************************************************************/
+bool phrase_cache_command(uint8_t const * p_line, uint32_t length, uint32_t * p_hash, uint32_t * p_length)
+{
+    uint32_t value = RESET_VALUE;
+
+    if ((PHRASE_CACHE_COMMAND_SIZE != length) || (PHRASE_CACHE_COMMAND_PREFIX != p_line[0]) ||
+        (PHRASE_CACHE_PLAY_COMMAND != p_line[1]))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 2u; i < (length - 1u); i++)
+    {
+        uint8_t digit = p_line[i];
+
+        if ((digit >= '0') && (digit <= '9'))
+        {
+            digit = (uint8_t) (digit - '0');
+        }
+        else if ((digit >= 'A') && (digit <= 'F'))
+        {
+            digit = (uint8_t) (digit - 'A' + 10u);
+        }
+        else if ((digit >= 'a') && (digit <= 'f'))
+        {
+            digit = (uint8_t) (digit - 'a' + 10u);
+        }
+        else
+        {
+            return false;
+        }
+        value = (value << 4) | digit;
+
+        /* The hash digits come first, the length digits follow */
+        if ((2u + PHRASE_CACHE_HASH_DIGITS - 1u) == i)
+        {
+            *p_hash = value;
+            value   = RESET_VALUE;
+        }
+    }
+
+    *p_length = value;
+    return true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Find a cached line and count the use. Both the hash and the length must match, two lines that
+ *               only share a hash do not stand in for each other.
+ *  @param[in]   p_cache    Cache
+ *  @param[in]   hash       Hash from the play command
+ *  @param[in]   length     Text length from the play command
+ *  @retval      Entry holding the line, NULL when it is not cached
+ ****************************************************************************************************************/
+phrase_cache_entry_t const * phrase_cache_lookup(phrase_cache_t * p_cache, uint32_t hash, uint32_t length)
+{
+    phrase_cache_entry_t * p_entry = phrase_cache_find(p_cache, hash, length);
+
+    if (NULL == p_entry)
+    {
+        p_cache->miss_count++;
+        return NULL;
+    }
+
+    phrase_cache_use(p_cache, p_entry);
+    p_cache->hit_count++;
+    if ((p_entry->length + 1u) > PHRASE_CACHE_COMMAND_SIZE)
+    {
+        p_cache->saved_bytes += (p_entry->length + 1u) - PHRASE_CACHE_COMMAND_SIZE;
+    }
+    return p_entry;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Count a line the PC sent as text, and cache it when it is new. Link commands and lines longer
+ *               than PHRASE_CACHE_TEXT_SIZE are not cached.
+ *  @param[in]   p_cache    Cache
+ *  @param[in]   p_text     Line text without the carriage return
+ *  @param[in]   length     Text bytes
+ *  @retval      None
+ ****************************************************************************************************************/
+void phrase_cache_learn(phrase_cache_t * p_cache, uint8_t const * p_text, uint32_t length)
+{
+    if ((RESET_VALUE == length) || (length > PHRASE_CACHE_TEXT_SIZE) || (PHRASE_CACHE_COMMAND_PREFIX == p_text[0]))
+    {
+        return;
+    }
+
+    uint32_t               hash    = phrase_cache_hash(p_text, length);
+    phrase_cache_entry_t * p_entry = phrase_cache_find(p_cache, hash, length);
+
+    if ((NULL != p_entry) && (RESET_VALUE == memcmp(p_entry->text, p_text, length)))
+    {
+        /* Known line sent as text again, the PC did not use the cache for it */
+        phrase_cache_use(p_cache, p_entry);
+        return;
+    }
+
+    if (NULL == p_entry)
+    {
+        p_entry = phrase_cache_victim(p_cache);
+        if (RESET_VALUE != p_entry->length)
+        {
+            /* The new line starts where the one it replaces stopped, older lines keep only what they earnt since */
+            p_cache->age = p_entry->hits;
+            p_cache->evict_count++;
+        }
+    }
+    else
+    {
+        /* Hash and length collision, the key must stay unique so the newer line takes the entry */
+    }
+
+    memcpy(p_entry->text, p_text, length);
+    p_entry->hash   = hash;
+    p_entry->length = (uint16_t) length;
+    p_entry->hits   = (uint16_t) p_cache->age;
+    phrase_cache_use(p_cache, p_entry);
+    p_cache->insert_count++;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Count one use of an entry. All hit counts are halved when one saturates, so lines that were
+ *               frequent long ago eventually make room.
+ *  @param[in]   p_cache    Cache
+ *  @param[in]   p_entry    Entry used
+ *  @retval      None
+ ****************************************************************************************************************/
+static void phrase_cache_use(phrase_cache_t * p_cache, phrase_cache_entry_t * p_entry)
+{
+    if (PHRASE_CACHE_HITS_MAX == p_entry->hits)
+    {
+        for (uint32_t i = RESET_VALUE; i < PHRASE_CACHE_ENTRIES; i++)
+        {
+            p_cache->entry[i].hits = (uint16_t) (p_cache->entry[i].hits / 2u);
+        }
+        p_cache->age /= 2u;
+    }
+
+    p_entry->hits++;
+    p_entry->last_use = ++p_cache->tick;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Entry a new line goes to: a free one, else the least used, the one unused longest among equals
+ *  @param[in]   p_cache    Cache
+ *  @retval      Entry to overwrite
+ ****************************************************************************************************************/
+static phrase_cache_entry_t * phrase_cache_victim(phrase_cache_t * p_cache)
+{
+    phrase_cache_entry_t * p_victim = &p_cache->entry[0];
+
+    for (uint32_t i = RESET_VALUE; i < PHRASE_CACHE_ENTRIES; i++)
+    {
+        phrase_cache_entry_t * p_entry = &p_cache->entry[i];
+
+        if (RESET_VALUE == p_entry->length)
+        {
+            return p_entry;
+        }
+
+        /* Tick differences stay right across a wrap of the tick */
+        if ((p_entry->hits < p_victim->hits) ||
+            ((p_entry->hits == p_victim->hits) &&
+             ((p_cache->tick - p_entry->last_use) > (p_cache->tick - p_victim->last_use))))
+        {
+            p_victim = p_entry;
+        }
+    }
+    return p_victim;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Entry cached under a hash and a length
+ *  @param[in]   p_cache    Cache
+ *  @param[in]   hash       Text hash
+ *  @param[in]   length     Text bytes
+ *  @retval      Entry, NULL when there is none
+ ****************************************************************************************************************/
+static phrase_cache_entry_t * phrase_cache_find(phrase_cache_t * p_cache, uint32_t hash, uint32_t length)
+{
+    for (uint32_t i = RESET_VALUE; i < PHRASE_CACHE_ENTRIES; i++)
+    {
+        phrase_cache_entry_t * p_entry = &p_cache->entry[i];
+
+        if ((RESET_VALUE != p_entry->length) && (hash == p_entry->hash) && (length == p_entry->length))
+        {
+            return p_entry;
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup phrase_cache)
+ **********************************************************************************************************************/
@@ -0,0 +1,61 @@
+/***********************************************************************************************************************
+ * File Name    : phrase_cache.h
+ * Description  : Contains data structures and function declarations of phrase_cache.c.
+ **********************************************************************************************************************/
+
+#ifndef PHRASE_CACHE_H_
+#define PHRASE_CACHE_H_
+
+/* Only standard headers here, the PC side uses phrase_cache_hash() to build its play commands */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Macro definition */
+#define PHRASE_CACHE_REGION_SIZE  (0x3000u) /* Cache image size in RAM */
+#define PHRASE_CACHE_ENTRY_SIZE   (256u)    /* Bytes per entry, header included */
+#define PHRASE_CACHE_ENTRIES      (PHRASE_CACHE_REGION_SIZE / PHRASE_CACHE_ENTRY_SIZE)
+#define PHRASE_CACHE_HEADER_SIZE  (12u)     /* Hash, length, hit count and last use of an entry */
+#define PHRASE_CACHE_TEXT_SIZE    (PHRASE_CACHE_ENTRY_SIZE - PHRASE_CACHE_HEADER_SIZE)  /* Longest cached line */
+#define PHRASE_CACHE_HITS_MAX     (0xFFFFu) /* Hit counts are halved when one reaches this */
+#define PHRASE_CACHE_COMMAND_PREFIX ('@')   /* Same prefix as the link commands, such lines are never cached */
+#define PHRASE_CACHE_PLAY_COMMAND ('C')     /* "@C<hash><length>": speak the cached line, 8 hex digits of the hash
+                                             * and 2 of the text length */
+#define PHRASE_CACHE_MISS         ('M')     /* "@M<hash><length>": not cached, the PC sends the text instead */
+#define PHRASE_CACHE_HASH_DIGITS  (8u)      /* Hex digits of a hash in the commands */
+#define PHRASE_CACHE_LENGTH_DIGITS (2u)     /* Hex digits of a text length in the commands */
+
+/* One cached line, text without its carriage return. length 0 marks a free entry. */
+typedef struct st_phrase_cache_entry
+{
+    uint32_t hash;                          /* phrase_cache_hash() of the text */
+    uint16_t length;                        /* Text bytes */
+    uint16_t hits;                          /* Uses plus the cache age when it was cached, halved on saturation */
+    uint32_t last_use;                      /* Cache tick of the last use */
+    uint8_t  text[PHRASE_CACHE_TEXT_SIZE];  /* Line text, priority prefix included */
+} phrase_cache_entry_t;
+
+/* Content addressed cache of the lines the PC sends. Every line forwarded to the talk board is learnt, keyed by its
+ * hash and length, and the PC can replay it with a 13 byte command instead of the text. A new line replaces the
+ * entry used least often, the one unused longest among equals. The counts age: a new line starts at the count of
+ * the line it replaced, so it is not the next one out while the old lines keep counts they earnt long ago. The
+ * cache lives in RAM and starts empty after a reset. */
+typedef struct st_phrase_cache
+{
+    phrase_cache_entry_t entry[PHRASE_CACHE_ENTRIES];   /* Cached lines */
+    uint32_t             tick;                          /* Counts learn and lookup calls, orders the uses */
+    uint32_t             age;                           /* Hit count of the last line replaced */
+    uint32_t             hit_count;                     /* Play commands found */
+    uint32_t             miss_count;                    /* Play commands not found */
+    uint32_t             insert_count;                  /* Lines added */
+    uint32_t             evict_count;                   /* Lines replaced by new ones */
+    uint32_t             saved_bytes;                   /* Link bytes the hits did not need */
+} phrase_cache_t;
+
+/* Function declaration */
+void phrase_cache_init(phrase_cache_t * p_cache);
+uint32_t phrase_cache_hash(uint8_t const * p_text, uint32_t length);
+bool phrase_cache_command(uint8_t const * p_line, uint32_t length, uint32_t * p_hash, uint32_t * p_length);
+phrase_cache_entry_t const * phrase_cache_lookup(phrase_cache_t * p_cache, uint32_t hash, uint32_t length);
+void phrase_cache_learn(phrase_cache_t * p_cache, uint8_t const * p_text, uint32_t length);
+
+#endif /* PHRASE_CACHE_H_ */
@@ -0,0 +1,640 @@
+/***********************************************************************************************************************
+ * File Name    : r_dmac.c
+ * Description  : Contains the DMAC transfer driver of this project, on the FSP transfer API.
+ *                The FSP r_dmac module is declared in configuration.xml but its pack sources are not in the tree,
+ *                so this stands in for them. It is not FSP code. Remove it once the pack sources are generated
+ *                into ra/fsp.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "r_dmac.h"
+#include "r_dmac_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "DMAC" in ASCII.  Used to determine if the control block is open. */
+#define DMAC_ID                        (0x444D4143U)
+
+/* Register address of a channel. Channels are evenly spaced. */
+#define DMAC_PRV_REG(ch)               ((R_DMAC0_Type *) (((uint32_t) R_DMAC1 - (uint32_t) R_DMAC0) * (ch) + \
+                                                          (uint32_t) R_DMAC0))
+
+/* Repeat and block size are held in 10 bits, 0 means 1024. */
+#define DMAC_PRV_MASK_CRAL             (0x3FFU)
+#define DMAC_PRV_MASK_CRAH             (0x3FFU)
+#define DMAC_PRV_MASK_CRBL             (0xFFFFU)
+#define DMAC_PRV_MASK_NORMAL_LENGTH    (0xFFFFU)
+
+/* Software request register settings. */
+#define DMAC_PRV_DMREQ_SWREQ           (1U << 0)
+#define DMAC_PRV_DMREQ_CLRS            (1U << 4)
+
+/* DMTMD.DCTG value selecting a peripheral event as activation source. */
+#define DMAC_PRV_DCTG_PERIPHERAL       (1U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void r_dmac_config_transfer_info(dmac_instance_ctrl_t * p_ctrl, transfer_info_t * p_info);
+static void r_dmac_call_callback(dmac_instance_ctrl_t * p_ctrl);
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+static fsp_err_t r_dmac_info_param_check(transfer_info_t * p_info);
+
+#endif
+
+void dmac_int_isr(void);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Global Variables
+ **********************************************************************************************************************/
+
+/** DMAC implementation of transfer API. */
+const transfer_api_t g_transfer_on_dmac =
+{
+    .open          = R_DMAC_Open,
+    .reconfigure   = R_DMAC_Reconfigure,
+    .reset         = R_DMAC_Reset,
+    .infoGet       = R_DMAC_InfoGet,
+    .softwareStart = R_DMAC_SoftwareStart,
+    .softwareStop  = R_DMAC_SoftwareStop,
+    .enable        = R_DMAC_Enable,
+    .disable       = R_DMAC_Disable,
+    .reload        = R_DMAC_Reload,
+    .callbackSet   = R_DMAC_CallbackSet,
+    .close         = R_DMAC_Close,
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup DMAC
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Configure a DMAC channel. Implements @ref transfer_api_t::open.
+ *
+ * The transfer is not enabled by this function. Call @ref transfer_api_t::enable or @ref transfer_api_t::reset to
+ * enable it.
+ *
+ * @retval FSP_SUCCESS                    Successful open.
+ * @retval FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval FSP_ERR_IP_CHANNEL_NOT_PRESENT The configured channel is invalid.
+ * @retval FSP_ERR_IRQ_BSP_DISABLED       The IRQ associated with the channel is not enabled in the BSP and a
+ *                                        callback is configured.
+ * @retval FSP_ERR_ALREADY_OPEN           The control structure is already opened.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_Open (transfer_ctrl_t * const p_api_ctrl, transfer_cfg_t const * const p_cfg)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_extend);
+    FSP_ASSERT(NULL != p_cfg->p_info);
+    FSP_ERROR_RETURN(p_ctrl->open != DMAC_ID, FSP_ERR_ALREADY_OPEN);
+    fsp_err_t err = r_dmac_info_param_check(p_cfg->p_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+#endif
+
+    dmac_extended_cfg_t const * p_extend = (dmac_extended_cfg_t const *) p_cfg->p_extend;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(p_extend->channel < BSP_FEATURE_DMAC_MAX_CHANNEL, FSP_ERR_IP_CHANNEL_NOT_PRESENT);
+    if (NULL != p_extend->p_callback)
+    {
+        FSP_ERROR_RETURN(p_extend->irq >= (IRQn_Type) 0, FSP_ERR_IRQ_BSP_DISABLED);
+    }
+#endif
+
+    p_ctrl->p_cfg             = p_cfg;
+    p_ctrl->p_reg             = DMAC_PRV_REG(p_extend->channel);
+    p_ctrl->p_callback        = p_extend->p_callback;
+    p_ctrl->p_context         = p_extend->p_context;
+    p_ctrl->p_callback_memory = NULL;
+
+    /* Take the module out of the module stop state. */
+    R_BSP_MODULE_START(FSP_IP_DMAC, p_extend->channel);
+
+    /* Make sure the channel is disabled before it is configured. */
+    p_ctrl->p_reg->DMCNT = 0U;
+
+    r_dmac_config_transfer_info(p_ctrl, p_cfg->p_info);
+
+    /* Link the activation source to this channel. */
+    R_DMA->DELSR[p_extend->channel] = (uint32_t) p_extend->activation_source;
+
+    /* Enable the channel interrupt if a callback is used. */
+    if ((NULL != p_ctrl->p_callback) && (p_extend->irq >= (IRQn_Type) 0))
+    {
+        R_BSP_IrqCfgEnable(p_extend->irq, p_extend->ipl, p_ctrl);
+    }
+
+    /* Enable the DMAC module. */
+    R_DMA->DMAST = 1U;
+
+    p_ctrl->open = DMAC_ID;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Reconfigure the transfer with new transfer info and enable it. Implements @ref transfer_api_t::reconfigure.
+ *
+ * @retval FSP_SUCCESS              Transfer is configured and will start when trigger occurs.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ * @retval FSP_ERR_NOT_ENABLED      Source or destination address is NULL.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_Reconfigure (transfer_ctrl_t * const p_api_ctrl, transfer_info_t * p_info)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_info);
+    FSP_ERROR_RETURN(p_ctrl->open == DMAC_ID, FSP_ERR_NOT_OPEN);
+    fsp_err_t err = r_dmac_info_param_check(p_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+#endif
+
+    FSP_ERROR_RETURN((NULL != p_info->p_src) && (NULL != p_info->p_dest), FSP_ERR_NOT_ENABLED);
+
+    p_ctrl->p_reg->DMCNT = 0U;
+
+    r_dmac_config_transfer_info(p_ctrl, p_info);
+
+    p_ctrl->p_reg->DMCNT = 1U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Reset transfer source, destination, and number of transfers, then enable the transfer.
+ * Implements @ref transfer_api_t::reset.
+ *
+ * In repeat mode num_transfers is the number of repeats. In block mode it is the number of blocks.
+ *
+ * @retval FSP_SUCCESS              Transfer reset successfully (transfer is enabled).
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_Reset (transfer_ctrl_t * const p_api_ctrl,
+                        void const * volatile   p_src,
+                        void * volatile         p_dest,
+                        uint16_t const          num_transfers)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DMAC_ID, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Disable the transfer while the settings are updated. */
+    p_ctrl->p_reg->DMCNT = 0U;
+
+    if (NULL != p_src)
+    {
+        p_ctrl->p_reg->DMSAR = (uint32_t) p_src;
+    }
+
+    if (NULL != p_dest)
+    {
+        p_ctrl->p_reg->DMDAR = (uint32_t) p_dest;
+    }
+
+    if (TRANSFER_MODE_NORMAL == p_ctrl->p_reg->DMTMD_b.MD)
+    {
+        p_ctrl->p_reg->DMCRA = num_transfers;
+    }
+    else
+    {
+        /* Restart the current repeat or block from its full size and set the number of repeats or blocks. */
+        uint32_t size = (p_ctrl->p_reg->DMCRA >> R_DMAC0_DMCRA_DMCRAH_Pos) & DMAC_PRV_MASK_CRAH;
+        p_ctrl->p_reg->DMCRA = (size << R_DMAC0_DMCRA_DMCRAH_Pos) | size;
+        p_ctrl->p_reg->DMCRB = num_transfers;
+    }
+
+    /* Clear any status left from the previous transfer, then enable. */
+    p_ctrl->p_reg->DMSTS = 0U;
+    p_ctrl->p_reg->DMCNT = 1U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Start a transfer by software. Implements @ref transfer_api_t::softwareStart.
+ *
+ * @retval FSP_SUCCESS              Transfer started written successfully.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ * @retval FSP_ERR_UNSUPPORTED      Handle was not configured for software activation.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_SoftwareStart (transfer_ctrl_t * const p_api_ctrl, transfer_start_mode_t mode)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DMAC_ID, FSP_ERR_NOT_OPEN);
+#endif
+
+    dmac_extended_cfg_t const * p_extend = (dmac_extended_cfg_t const *) p_ctrl->p_cfg->p_extend;
+
+    /* Software start is only possible without a peripheral activation source. */
+    FSP_ERROR_RETURN(ELC_EVENT_NONE == p_extend->activation_source, FSP_ERR_UNSUPPORTED);
+
+    /* Keep the software request set until the transfer completes in repeat mode. */
+    uint8_t dmreq = (uint8_t) DMAC_PRV_DMREQ_SWREQ;
+    if (TRANSFER_START_MODE_REPEAT == mode)
+    {
+        dmreq |= (uint8_t) DMAC_PRV_DMREQ_CLRS;
+    }
+
+    p_ctrl->p_reg->DMREQ = dmreq;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stop a software started transfer after the current transfer. Implements @ref transfer_api_t::softwareStop.
+ *
+ * @retval FSP_SUCCESS              Transfer stopped written successfully.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_SoftwareStop (transfer_ctrl_t * const p_api_ctrl)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DMAC_ID, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Clear the software request. */
+    p_ctrl->p_reg->DMREQ = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Enable transfers for the configured activation source. Implements @ref transfer_api_t::enable.
+ *
+ * @retval FSP_SUCCESS              Counter value written successfully.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_Enable (transfer_ctrl_t * const p_api_ctrl)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DMAC_ID, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->p_reg->DMCNT = 1U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Disable transfers so that they are no longer triggered by the activation source.
+ * Implements @ref transfer_api_t::disable.
+ *
+ * @retval FSP_SUCCESS              Counter value written successfully.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_Disable (transfer_ctrl_t * const p_api_ctrl)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DMAC_ID, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->p_reg->DMCNT = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Set driver specific information in provided pointer. Implements @ref transfer_api_t::infoGet.
+ *
+ * @retval FSP_SUCCESS              Information has been written to p_properties.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_InfoGet (transfer_ctrl_t * const p_api_ctrl, transfer_properties_t * const p_properties)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_properties);
+    FSP_ERROR_RETURN(p_ctrl->open == DMAC_ID, FSP_ERR_NOT_OPEN);
+#endif
+
+    uint32_t mode = p_ctrl->p_reg->DMTMD_b.MD;
+
+    if (TRANSFER_MODE_NORMAL == mode)
+    {
+        p_properties->block_count_max           = 0U;
+        p_properties->block_count_remaining     = 0U;
+        p_properties->transfer_length_max       = DMAC_MAX_NORMAL_TRANSFER_LENGTH;
+        p_properties->transfer_length_remaining = p_ctrl->p_reg->DMCRA & DMAC_PRV_MASK_NORMAL_LENGTH;
+    }
+    else
+    {
+        p_properties->block_count_max = (TRANSFER_MODE_REPEAT == mode) ? DMAC_MAX_REPEAT_COUNT : DMAC_MAX_BLOCK_COUNT;
+        p_properties->block_count_remaining     = p_ctrl->p_reg->DMCRB & DMAC_PRV_MASK_CRBL;
+        p_properties->transfer_length_max       = DMAC_MAX_REPEAT_TRANSFER_LENGTH;
+        p_properties->transfer_length_remaining = p_ctrl->p_reg->DMCRA & DMAC_PRV_MASK_CRAL;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Placeholder for unsupported reload function. Implements @ref transfer_api_t::reload.
+ *
+ * @retval FSP_ERR_UNSUPPORTED      This MCU has no DMAC reload registers.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_Reload (transfer_ctrl_t * const p_api_ctrl,
+                         void const            * p_src,
+                         void                  * p_dest,
+                         uint32_t const          num_transfers)
+{
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_src);
+    FSP_PARAMETER_NOT_USED(p_dest);
+    FSP_PARAMETER_NOT_USED(num_transfers);
+
+    return FSP_ERR_UNSUPPORTED;
+}
+
+/*******************************************************************************************************************//**
+ * Updates the user callback with the option to provide memory for the callback argument structure.
+ * Implements @ref transfer_api_t::callbackSet.
+ *
+ * @retval  FSP_SUCCESS                  Callback updated successfully.
+ * @retval  FSP_ERR_ASSERTION            A required pointer is NULL.
+ * @retval  FSP_ERR_NOT_OPEN             The control block has not been opened.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_CallbackSet (transfer_ctrl_t * const          p_api_ctrl,
+                              void (                         * p_callback)(transfer_callback_args_t *),
+                              void const * const               p_context,
+                              transfer_callback_args_t * const p_callback_memory)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_callback);
+    FSP_ERROR_RETURN(p_ctrl->open == DMAC_ID, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Store callback and context */
+    p_ctrl->p_callback        = p_callback;
+    p_ctrl->p_context         = p_context;
+    p_ctrl->p_callback_memory = p_callback_memory;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Disable transfer and clean up internal data. Implements @ref transfer_api_t::close.
+ *
+ * @retval FSP_SUCCESS              Successful close.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_Close (transfer_ctrl_t * const p_api_ctrl)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DMAC_ID, FSP_ERR_NOT_OPEN);
+#endif
+
+    dmac_extended_cfg_t const * p_extend = (dmac_extended_cfg_t const *) p_ctrl->p_cfg->p_extend;
+
+    /* Disable DMAC transfers, the interrupt and the event link. */
+    p_ctrl->p_reg->DMCNT = 0U;
+    p_ctrl->p_reg->DMINT = 0U;
+    R_DMA->DELSR[p_extend->channel] = (uint32_t) ELC_EVENT_NONE;
+
+    if (p_extend->irq >= (IRQn_Type) 0)
+    {
+        R_BSP_IrqDisable(p_extend->irq);
+        R_FSP_IsrContextSet(p_extend->irq, NULL);
+    }
+
+    p_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup DMAC)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Write the transfer info to the hardware registers. The channel must be disabled.
+ *
+ * @param[in]   p_ctrl         Pointer to control structure.
+ * @param[in]   p_info         Pointer to transfer info.
+ **********************************************************************************************************************/
+static void r_dmac_config_transfer_info (dmac_instance_ctrl_t * p_ctrl, transfer_info_t * p_info)
+{
+    dmac_extended_cfg_t const * p_extend = (dmac_extended_cfg_t const *) p_ctrl->p_cfg->p_extend;
+    R_DMAC0_Type              * p_reg    = p_ctrl->p_reg;
+    transfer_mode_t             mode     = p_info->transfer_settings_word_b.mode;
+
+    /* Transfer mode, repeat area, size and activation source select. */
+    uint32_t dmtmd = ((uint32_t) mode << R_DMAC0_DMTMD_MD_Pos) |
+                     ((uint32_t) p_info->transfer_settings_word_b.repeat_area << R_DMAC0_DMTMD_DTS_Pos) |
+                     ((uint32_t) p_info->transfer_settings_word_b.size << R_DMAC0_DMTMD_SZ_Pos);
+    if (ELC_EVENT_NONE != p_extend->activation_source)
+    {
+        dmtmd |= DMAC_PRV_DCTG_PERIPHERAL << R_DMAC0_DMTMD_DCTG_Pos;
+    }
+
+    /* Source and destination address update modes. */
+    uint32_t dmamd = ((uint32_t) p_info->transfer_settings_word_b.src_addr_mode << R_DMAC0_DMAMD_SM_Pos) |
+                     ((uint32_t) p_info->transfer_settings_word_b.dest_addr_mode << R_DMAC0_DMAMD_DM_Pos);
+
+    /* The transfer end interrupt is used when a callback is set. TRANSFER_IRQ_EACH also requests the repeat or block
+     * size end interrupt. That interrupt suspends the transfer and the ISR resumes it. */
+    uint32_t dmint = 0U;
+    if (NULL != p_ctrl->p_callback)
+    {
+        dmint = R_DMAC0_DMINT_DTIE_Msk;
+
+        if ((TRANSFER_MODE_NORMAL != mode) && (TRANSFER_IRQ_EACH == p_info->transfer_settings_word_b.irq))
+        {
+            dmint |= R_DMAC0_DMINT_RPTIE_Msk;
+        }
+    }
+
+    p_reg->DMTMD = (uint16_t) dmtmd;
+    p_reg->DMAMD = (uint16_t) dmamd;
+    p_reg->DMINT = (uint8_t) dmint;
+    p_reg->DMOFR = (uint32_t) p_extend->offset;
+    p_reg->DMSAR = (uint32_t) p_info->p_src;
+    p_reg->DMDAR = (uint32_t) p_info->p_dest;
+
+    if (TRANSFER_MODE_NORMAL == mode)
+    {
+        p_reg->DMCRA = p_info->length;
+        p_reg->DMCRB = 0U;
+    }
+    else
+    {
+        /* DMCRAH reloads DMCRAL at the end of every repeat or block. */
+        uint32_t size = p_info->length & DMAC_PRV_MASK_CRAL;
+        p_reg->DMCRA = (size << R_DMAC0_DMCRA_DMCRAH_Pos) | size;
+        p_reg->DMCRB = p_info->num_blocks;
+
+#if BSP_FEATURE_DMAC_HAS_REPEAT_BLOCK_MODE
+        if (TRANSFER_MODE_REPEAT_BLOCK == mode)
+        {
+            /* Ring buffer size in blocks for the source. The destination is not wrapped. */
+            p_reg->DMSBS = ((uint32_t) p_extend->src_buffer_size << R_DMAC0_DMSBS_DMSBSH_Pos) |
+                           p_extend->src_buffer_size;
+            p_reg->DMDBS = 0U;
+        }
+#endif
+    }
+
+    p_reg->DMSTS = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Calls user callback.
+ *
+ * @param[in]     p_ctrl     Pointer to DMAC instance control block
+ **********************************************************************************************************************/
+static void r_dmac_call_callback (dmac_instance_ctrl_t * p_ctrl)
+{
+    transfer_callback_args_t args;
+
+    /* Store callback arguments in memory provided by user if available. */
+    transfer_callback_args_t * p_args = p_ctrl->p_callback_memory;
+    if (NULL == p_args)
+    {
+        /* Store on stack */
+        p_args = &args;
+    }
+    else
+    {
+        /* Save current arguments on the stack in case this is a nested interrupt. */
+        args = *p_args;
+    }
+
+    p_args->p_context = p_ctrl->p_context;
+
+    p_ctrl->p_callback(p_args);
+
+    if (NULL != p_ctrl->p_callback_memory)
+    {
+        /* Restore callback memory in case this is a nested interrupt. */
+        *p_ctrl->p_callback_memory = args;
+    }
+}
+
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+
+/*******************************************************************************************************************//**
+ * Check the transfer info for settings the DMAC cannot perform.
+ *
+ * @param[in]   p_info         Pointer to transfer info.
+ *
+ * @retval FSP_SUCCESS              The transfer info is valid.
+ * @retval FSP_ERR_ASSERTION        Length or number of blocks is out of range.
+ **********************************************************************************************************************/
+static fsp_err_t r_dmac_info_param_check (transfer_info_t * p_info)
+{
+    if (TRANSFER_MODE_NORMAL == p_info->transfer_settings_word_b.mode)
+    {
+        FSP_ASSERT(p_info->length <= DMAC_MAX_NORMAL_TRANSFER_LENGTH);
+    }
+    else
+    {
+        FSP_ASSERT(p_info->length <= DMAC_MAX_REPEAT_TRANSFER_LENGTH);
+    }
+
+ #if !BSP_FEATURE_DMAC_HAS_REPEAT_BLOCK_MODE
+    FSP_ASSERT(TRANSFER_MODE_REPEAT_BLOCK != p_info->transfer_settings_word_b.mode);
+ #endif
+
+    return FSP_SUCCESS;
+}
+
+#endif
+
+/*******************************************************************************************************************//**
+ * DMAC ISR. Handles the transfer end interrupt and, with TRANSFER_IRQ_EACH, the repeat or block size end interrupt.
+ **********************************************************************************************************************/
+void dmac_int_isr (void)
+{
+    /* Save context if RTOS is used */
+    FSP_CONTEXT_SAVE
+
+    IRQn_Type irq = R_FSP_CurrentIrqGet();
+
+    /* Recover ISR context saved in open. */
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
+
+    uint8_t dmsts = p_ctrl->p_reg->DMSTS;
+
+    /* Clear interrupt condition. */
+    p_ctrl->p_reg->DMSTS = 0U;
+
+    /* Dummy read to ensure that interrupt event is cleared. */
+    volatile uint8_t dummy = p_ctrl->p_reg->DMSTS;
+    FSP_PARAMETER_NOT_USED(dummy);
+
+    /* A repeat or block size end stops the channel. Resume it unless the whole transfer has ended. */
+    if ((dmsts & R_DMAC0_DMSTS_ESIF_Msk) && !(dmsts & R_DMAC0_DMSTS_DTIF_Msk))
+    {
+        p_ctrl->p_reg->DMCNT = 1U;
+    }
+
+    /* Clear pending IRQ to make sure it doesn't fire again after exiting */
+    R_BSP_IrqStatusClear(irq);
+
+    /* Call user callback */
+    if (NULL != p_ctrl->p_callback)
+    {
+        r_dmac_call_callback(p_ctrl);
+    }
+
+    /* Restore context if RTOS is used */
+    FSP_CONTEXT_RESTORE
+}
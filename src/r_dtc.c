@@ -0,0 +1,566 @@
+/***********************************************************************************************************************
+ * File Name    : r_dtc.c
+ * Description  : Contains the DTC transfer driver of this project, on the FSP transfer API.
+ *                The FSP r_dtc module is declared in configuration.xml but its pack sources are not in the tree,
+ *                so this stands in for them. It is not FSP code. Remove it once the pack sources are generated
+ *                into ra/fsp.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "r_dtc.h"
+#include "r_dtc_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "DTC" in ASCII.  Used to determine if the control block is open. */
+#define DTC_OPEN                             (0x00445443U)
+
+/* The DTC vector table must be aligned on a 1K boundary. */
+#define DTC_PRV_VECTOR_TABLE_ALIGNMENT       (1024U)
+
+/* Number of entries in the DTC vector table. One per ICU event link. */
+#define DTC_PRV_VECTOR_TABLE_ENTRIES         (BSP_ICU_VECTOR_MAX_ENTRIES)
+
+/* CRA holds the reload value in the upper byte in repeat and block mode. */
+#define DTC_PRV_MASK_CRAL                    (0xFFU)
+#define DTC_PRV_OFFSET_CRAH                  (8U)
+
+/* DTCCR reads back 1 in bit 3. Keep it set when writing the register. */
+#define DTC_PRV_DTCCR_RESERVED               (0x08U)
+#define DTC_PRV_RRS_DISABLE                  (DTC_PRV_DTCCR_RESERVED)
+#define DTC_PRV_RRS_ENABLE                   (DTC_PRV_DTCCR_RESERVED | R_DTC_DTCCR_RRS_Msk)
+
+/* Secure builds on MCUs with the second TrustZone implementation use the secure copies of the control registers. */
+#if (2U == BSP_FEATURE_TZ_VERSION) && (1 == BSP_TZ_SECURE_BUILD)
+ #define DTC_PRV_REG(reg)                    (R_DTC->reg ## _SEC)
+#else
+ #define DTC_PRV_REG(reg)                    (R_DTC->reg)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void r_dtc_state_initialize(void);
+static void r_dtc_set_info(dtc_instance_ctrl_t * p_ctrl, transfer_info_t * p_info);
+static void r_dtc_block_repeat_initialize(transfer_info_t * p_info);
+static void r_dtc_wait_for_transfer_complete(dtc_instance_ctrl_t * p_ctrl);
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+static fsp_err_t r_dtc_length_assert(transfer_info_t * p_info);
+
+#endif
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/* DTC vector table. Each entry points to the transfer information for the ICU event link of the same index. */
+static transfer_info_t * gp_dtc_vector_table[DTC_PRV_VECTOR_TABLE_ENTRIES] BSP_ALIGN_VARIABLE(
+    DTC_PRV_VECTOR_TABLE_ALIGNMENT) BSP_PLACE_IN_SECTION(DTC_CFG_VECTOR_TABLE_SECTION_NAME);
+
+/***********************************************************************************************************************
+ * Global Variables
+ **********************************************************************************************************************/
+
+/** DTC implementation of transfer API. */
+const transfer_api_t g_transfer_on_dtc =
+{
+    .open          = R_DTC_Open,
+    .reconfigure   = R_DTC_Reconfigure,
+    .reset         = R_DTC_Reset,
+    .infoGet       = R_DTC_InfoGet,
+    .enable        = R_DTC_Enable,
+    .disable       = R_DTC_Disable,
+    .softwareStart = R_DTC_SoftwareStart,
+    .softwareStop  = R_DTC_SoftwareStop,
+    .reload        = R_DTC_Reload,
+    .callbackSet   = R_DTC_CallbackSet,
+    .close         = R_DTC_Close,
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup DTC
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Configure the vector table if it hasn't been configured, enable the Module and copy the pointer to the transfer info
+ * into the DTC vector table. Implements @ref transfer_api_t::open.
+ *
+ * The transfer is not enabled by this function. Call @ref transfer_api_t::enable or @ref transfer_api_t::reset to
+ * enable it.
+ *
+ * @retval FSP_SUCCESS              Successful open.
+ *                                  Transfer transfer info pointer copied to DTC Vector table.
+ *                                  Module started.
+ *                                  DTC vector table configured.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_UNSUPPORTED      Address Mode Offset is selected.
+ * @retval FSP_ERR_ALREADY_OPEN     The control structure is already opened.
+ * @retval FSP_ERR_IN_USE           The index for this IRQ in the DTC vector table is already configured.
+ * @retval FSP_ERR_IRQ_BSP_DISABLED The IRQ associated with the activation source is not enabled in the BSP.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_Open (transfer_ctrl_t * const p_api_ctrl, transfer_cfg_t const * const p_cfg)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_extend);
+    FSP_ERROR_RETURN(p_ctrl->open != DTC_OPEN, FSP_ERR_ALREADY_OPEN);
+
+    if (NULL != p_cfg->p_info)
+    {
+        fsp_err_t err = r_dtc_length_assert(p_cfg->p_info);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+#endif
+
+    dtc_extended_cfg_t const * p_extend = (dtc_extended_cfg_t const *) p_cfg->p_extend;
+    IRQn_Type                  irq      = p_extend->activation_source;
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(irq >= (IRQn_Type) 0, FSP_ERR_IRQ_BSP_DISABLED);
+    FSP_ERROR_RETURN(NULL == gp_dtc_vector_table[irq], FSP_ERR_IN_USE);
+#endif
+
+    /* One time initialization for all DTC instances. */
+    r_dtc_state_initialize();
+
+    /* Make sure the activation source is disabled while the transfer information is updated. */
+    R_ICU->IELSR_b[irq].DTCE = 0U;
+
+    p_ctrl->irq = irq;
+
+    if (NULL != p_cfg->p_info)
+    {
+        /* Copy p_info into the DTC vector table. */
+        r_dtc_set_info(p_ctrl, p_cfg->p_info);
+    }
+
+    /* Mark driver as open by initializing it to "DTC" in its ASCII equivalent. */
+    p_ctrl->open = DTC_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Copy pointer to transfer info into the DTC vector table and enable transfer in ICU.
+ * Implements @ref transfer_api_t::reconfigure.
+ *
+ * @retval FSP_SUCCESS              Transfer is configured and will start when trigger occurs.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
+ * @retval FSP_ERR_NOT_ENABLED      Transfer source address is NULL or is not aligned corrrectly.
+ *                                  Transfer destination address is NULL or is not aligned corrrectly.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_Reconfigure (transfer_ctrl_t * const p_api_ctrl, transfer_info_t * p_info)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_info);
+    FSP_ERROR_RETURN(p_ctrl->open == DTC_OPEN, FSP_ERR_NOT_OPEN);
+    fsp_err_t err = r_dtc_length_assert(p_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+#endif
+
+    /* Disable the transfer and wait for any transfer in progress on this vector to finish. */
+    R_ICU->IELSR_b[p_ctrl->irq].DTCE = 0U;
+    r_dtc_wait_for_transfer_complete(p_ctrl);
+
+    /* Copy p_info into the DTC vector table. */
+    r_dtc_set_info(p_ctrl, p_info);
+
+    /* Enable transfers on this activation source. */
+    R_ICU->IELSR_b[p_ctrl->irq].DTCE = 1U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Reset transfer source, destination, and number of transfers. Implements @ref transfer_api_t::reset.
+ *
+ * In repeat mode the number of transfers is fixed at open and num_transfers is ignored.
+ *
+ * @retval FSP_SUCCESS              Transfer reset successfully (transfer is enabled).
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
+ * @retval FSP_ERR_NOT_ENABLED      Transfer information has not been configured for this activation source.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_Reset (transfer_ctrl_t * const p_api_ctrl,
+                       void const * volatile   p_src,
+                       void * volatile         p_dest,
+                       uint16_t const          num_transfers)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DTC_OPEN, FSP_ERR_NOT_OPEN);
+#endif
+
+    transfer_info_t * p_info = gp_dtc_vector_table[p_ctrl->irq];
+    FSP_ERROR_RETURN(NULL != p_info, FSP_ERR_NOT_ENABLED);
+
+    /* Disable transfers on this activation source and let a transfer in progress complete. */
+    R_ICU->IELSR_b[p_ctrl->irq].DTCE = 0U;
+    r_dtc_wait_for_transfer_complete(p_ctrl);
+
+    /* The DTC may skip reading the transfer information if this vector was the last one serviced. Disable read skip
+     * so the updated information is fetched on the next activation. */
+    DTC_PRV_REG(DTCCR) = DTC_PRV_RRS_DISABLE;
+
+    if (NULL != p_src)
+    {
+        p_info->p_src = p_src;
+    }
+
+    if (NULL != p_dest)
+    {
+        p_info->p_dest = p_dest;
+    }
+
+    if (TRANSFER_MODE_BLOCK == p_info->transfer_settings_word_b.mode)
+    {
+        p_info->num_blocks = num_transfers;
+    }
+    else if (TRANSFER_MODE_NORMAL == p_info->transfer_settings_word_b.mode)
+    {
+        p_info->length = num_transfers;
+    }
+    else
+    {
+        /* Repeat mode reloads the length from CRAH. */
+    }
+
+    /* Make sure the transfer information is written before the DTC can be activated. */
+    __DMB();
+
+    DTC_PRV_REG(DTCCR) = DTC_PRV_RRS_ENABLE;
+
+    /* Enable transfers on this activation source. */
+    R_ICU->IELSR_b[p_ctrl->irq].DTCE = 1U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Placeholder for unsupported softwareStart function. Implements @ref transfer_api_t::softwareStart.
+ *
+ * @retval FSP_ERR_UNSUPPORTED      DTC software start is not supported.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_SoftwareStart (transfer_ctrl_t * const p_api_ctrl, transfer_start_mode_t mode)
+{
+    /* This function is not supported for DTC. */
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(mode);
+
+    return FSP_ERR_UNSUPPORTED;
+}
+
+/*******************************************************************************************************************//**
+ * Placeholder for unsupported softwareStop function. Implements @ref transfer_api_t::softwareStop.
+ *
+ * @retval FSP_ERR_UNSUPPORTED      DTC software stop is not supported.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_SoftwareStop (transfer_ctrl_t * const p_api_ctrl)
+{
+    /* This function is not supported for DTC. */
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+}
+
+/*******************************************************************************************************************//**
+ * Enable transfers on this activation source. Implements @ref transfer_api_t::enable.
+ *
+ * @retval FSP_SUCCESS              Transfers will be triggered by the activation source
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
+ * @retval FSP_ERR_NOT_ENABLED      Transfer information has not been configured for this activation source.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_Enable (transfer_ctrl_t * const p_api_ctrl)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DTC_OPEN, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_ERROR_RETURN(NULL != gp_dtc_vector_table[p_ctrl->irq], FSP_ERR_NOT_ENABLED);
+
+    /* Enable transfers on this activation source. */
+    R_ICU->IELSR_b[p_ctrl->irq].DTCE = 1U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Disable transfer on this activation source. Implements @ref transfer_api_t::disable.
+ *
+ * @retval FSP_SUCCESS              Transfers will not occur on activation events.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_Disable (transfer_ctrl_t * const p_api_ctrl)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DTC_OPEN, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Disable transfer. */
+    R_ICU->IELSR_b[p_ctrl->irq].DTCE = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Provides information about this transfer. Implements @ref transfer_api_t::infoGet.
+ *
+ * @retval FSP_SUCCESS              p_properties updated with current instance information.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
+ * @retval FSP_ERR_NOT_ENABLED      Transfer information has not been configured for this activation source.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_InfoGet (transfer_ctrl_t * const p_api_ctrl, transfer_properties_t * const p_properties)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_properties);
+    FSP_ERROR_RETURN(p_ctrl->open == DTC_OPEN, FSP_ERR_NOT_OPEN);
+#endif
+
+    transfer_info_t * p_info = gp_dtc_vector_table[p_ctrl->irq];
+    FSP_ERROR_RETURN(NULL != p_info, FSP_ERR_NOT_ENABLED);
+
+    p_properties->block_count_max       = 0U;
+    p_properties->block_count_remaining = 0U;
+
+    if (TRANSFER_MODE_NORMAL != p_info->transfer_settings_word_b.mode)
+    {
+        /* Repeat and block mode count down in CRAL. */
+        p_properties->transfer_length_max       = DTC_MAX_REPEAT_TRANSFER_LENGTH;
+        p_properties->transfer_length_remaining = (p_info->length & DTC_PRV_MASK_CRAL);
+
+        if (TRANSFER_MODE_BLOCK == p_info->transfer_settings_word_b.mode)
+        {
+            p_properties->block_count_max       = DTC_MAX_BLOCK_COUNT;
+            p_properties->block_count_remaining = p_info->num_blocks;
+        }
+    }
+    else
+    {
+        p_properties->transfer_length_max       = DTC_MAX_NORMAL_TRANSFER_LENGTH;
+        p_properties->transfer_length_remaining = p_info->length;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Placeholder for unsupported reload function. Implements @ref transfer_api_t::reload.
+ *
+ * @retval FSP_ERR_UNSUPPORTED      DTC reload is not supported.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_Reload (transfer_ctrl_t * const p_api_ctrl,
+                        void const            * p_src,
+                        void                  * p_dest,
+                        uint32_t const          num_transfers)
+{
+    /* This function is not supported for DTC. */
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_src);
+    FSP_PARAMETER_NOT_USED(p_dest);
+    FSP_PARAMETER_NOT_USED(num_transfers);
+
+    return FSP_ERR_UNSUPPORTED;
+}
+
+/*******************************************************************************************************************//**
+ * Placeholder for unsupported callbackSet function. Implements @ref transfer_api_t::callbackSet.
+ *
+ * The DTC raises the interrupt of its activation source when a transfer completes, so completion is reported by the
+ * driver that owns that interrupt.
+ *
+ * @retval FSP_ERR_UNSUPPORTED      DTC callbacks are not supported.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_CallbackSet (transfer_ctrl_t * const          p_api_ctrl,
+                             void (                         * p_callback)(transfer_callback_args_t *),
+                             void const * const               p_context,
+                             transfer_callback_args_t * const p_callback_memory)
+{
+    /* This function is not supported for DTC. */
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_callback);
+    FSP_PARAMETER_NOT_USED(p_context);
+    FSP_PARAMETER_NOT_USED(p_callback_memory);
+
+    return FSP_ERR_UNSUPPORTED;
+}
+
+/*******************************************************************************************************************//**
+ * Disables DTC activation in the ICU, then clears transfer data from the DTC vector table.
+ * Implements @ref transfer_api_t::close.
+ *
+ * @retval FSP_SUCCESS              Successful close.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_Close (transfer_ctrl_t * const p_api_ctrl)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DTC_OPEN, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Disable DTC transfers on this activation source. */
+    R_ICU->IELSR_b[p_ctrl->irq].DTCE = 0U;
+    r_dtc_wait_for_transfer_complete(p_ctrl);
+
+    /* Clear pointer in vector table. */
+    gp_dtc_vector_table[p_ctrl->irq] = NULL;
+
+    p_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup DTC)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Start the DTC module and set the vector table base address. Only the first call has any effect.
+ **********************************************************************************************************************/
+static void r_dtc_state_initialize (void)
+{
+    /* Stopping the module stop state of the DTC is required before accessing its registers. */
+    R_BSP_MODULE_START(FSP_IP_DTC, 0);
+
+    if (0U == R_DTC->DTCST)
+    {
+        /* Set the vector table base address. */
+        DTC_PRV_REG(DTCVBR) = (uint32_t) gp_dtc_vector_table;
+
+        /* Enable read skip. The transfer information is only re-read when the activation vector changes. */
+        DTC_PRV_REG(DTCCR) = DTC_PRV_RRS_ENABLE;
+
+        /* Start the DTC. */
+        R_DTC->DTCST = 1U;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Prepare the transfer information and place a pointer to it in the DTC vector table.
+ *
+ * @param[in]   p_ctrl     Control block with the activation source
+ * @param[in]   p_info     Transfer information (may be the first entry of a chain)
+ **********************************************************************************************************************/
+static void r_dtc_set_info (dtc_instance_ctrl_t * p_ctrl, transfer_info_t * p_info)
+{
+    r_dtc_block_repeat_initialize(p_info);
+
+    /* Disable read skip so the DTC fetches the new transfer information. */
+    DTC_PRV_REG(DTCCR) = DTC_PRV_RRS_DISABLE;
+
+    gp_dtc_vector_table[p_ctrl->irq] = p_info;
+
+    /* Make sure the vector table entry and transfer information are written before the DTC is activated. */
+    __DMB();
+
+    DTC_PRV_REG(DTCCR) = DTC_PRV_RRS_ENABLE;
+}
+
+/*******************************************************************************************************************//**
+ * Copy the transfer length into the reload byte (CRAH) for repeat and block mode transfers in the chain.
+ *
+ * @param[in]   p_info     Transfer information (may be the first entry of a chain)
+ **********************************************************************************************************************/
+static void r_dtc_block_repeat_initialize (transfer_info_t * p_info)
+{
+    uint32_t i = 0U;
+
+    do
+    {
+        if (TRANSFER_MODE_NORMAL != p_info[i].transfer_settings_word_b.mode)
+        {
+            uint16_t cral = (uint16_t) (p_info[i].length & DTC_PRV_MASK_CRAL);
+            p_info[i].length = (uint16_t) ((cral << DTC_PRV_OFFSET_CRAH) | cral);
+        }
+    } while (TRANSFER_CHAIN_MODE_DISABLED != p_info[i++].transfer_settings_word_b.chain_mode);
+}
+
+/*******************************************************************************************************************//**
+ * Wait for a transfer on this activation source to finish if one is in progress.
+ *
+ * @param[in]   p_ctrl     Control block with the activation source
+ **********************************************************************************************************************/
+static void r_dtc_wait_for_transfer_complete (dtc_instance_ctrl_t * p_ctrl)
+{
+    if (R_DTC->DTCSTS_b.ACT && ((uint32_t) p_ctrl->irq == R_DTC->DTCSTS_b.VECN))
+    {
+        FSP_HARDWARE_REGISTER_WAIT(R_DTC->DTCSTS_b.ACT, 0U);
+    }
+}
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+
+/*******************************************************************************************************************//**
+ * Verify the settings of every transfer in the chain.
+ *
+ * @param[in]   p_info     Transfer information (may be the first entry of a chain)
+ *
+ * @retval FSP_SUCCESS              All transfers in the chain are valid.
+ * @retval FSP_ERR_ASSERTION        Length is out of range for repeat or block mode.
+ * @retval FSP_ERR_UNSUPPORTED      Address Mode Offset is selected.
+ **********************************************************************************************************************/
+static fsp_err_t r_dtc_length_assert (transfer_info_t * p_info)
+{
+    uint32_t i = 0U;
+
+    do
+    {
+        /* The DTC has no offset addressing. */
+        FSP_ERROR_RETURN(TRANSFER_ADDR_MODE_OFFSET != p_info[i].transfer_settings_word_b.src_addr_mode,
+                         FSP_ERR_UNSUPPORTED);
+        FSP_ERROR_RETURN(TRANSFER_ADDR_MODE_OFFSET != p_info[i].transfer_settings_word_b.dest_addr_mode,
+                         FSP_ERR_UNSUPPORTED);
+
+        if (TRANSFER_MODE_NORMAL != p_info[i].transfer_settings_word_b.mode)
+        {
+            /* Repeat and block mode lengths are limited to the 8-bit CRAL. */
+            FSP_ASSERT(p_info[i].length <= DTC_MAX_REPEAT_TRANSFER_LENGTH);
+        }
+    } while (TRANSFER_CHAIN_MODE_DISABLED != p_info[i++].transfer_settings_word_b.chain_mode);
+
+    return FSP_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,54 @@
+/***********************************************************************************************************************
+ * File Name    : ram_vectors.c
+ * Description  : Contains the copy of the vector table in RAM.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "ram_vectors.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup ram_vectors
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define RAM_VECTORS_ALIGN         (512u)    /* VTOR needs the table size rounded up to a power of two, 112 x 4 bytes */
+
+/*
+ * Private global variables
+ */
+/* Vector table in use after ram_vectors_init(), drivers may replace interrupt handlers in it */
+static fsp_vector_t g_ram_vectors[BSP_VECTOR_TABLE_MAX_ENTRIES] BSP_ALIGN_VARIABLE(RAM_VECTORS_ALIGN);
+
+/*******************************************************************************************************************//**
+ * @brief       Copy the active vector table to RAM and switch VTOR to the copy. Call before any driver is opened,
+ *              so drivers such as r_sci_b_uart can install handlers specialised for their configuration.
+ * @param[in]   None
+ * @retval      None
+ **********************************************************************************************************************/
+void ram_vectors_init(void)
+{
+    fsp_vector_t const * p_flash = (fsp_vector_t const *) SCB->VTOR;
+
+    if (p_flash == g_ram_vectors)
+    {
+        return;
+    }
+
+    /* No interrupt may be taken while VTOR and the table disagree */
+    __disable_irq();
+    for (uint32_t i = RESET_VALUE; i < BSP_VECTOR_TABLE_MAX_ENTRIES; i++)
+    {
+        g_ram_vectors[i] = p_flash[i];
+    }
+    SCB->VTOR = (uint32_t) g_ram_vectors;
+    __DSB();
+    __ISB();
+    __enable_irq();
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup ram_vectors)
+ **********************************************************************************************************************/
@@ -0,0 +1,12 @@
+/***********************************************************************************************************************
+ * File Name    : ram_vectors.h
+ * Description  : Contains function declaration of ram_vectors.c.
+ **********************************************************************************************************************/
+
+#ifndef RAM_VECTORS_H_
+#define RAM_VECTORS_H_
+
+/* Function declaration */
+void ram_vectors_init(void);
+
+#endif /* RAM_VECTORS_H_ */
@@ -0,0 +1,190 @@
+/***********************************************************************************************************************
+ * File Name    : rtt_lockfree.c
+ * Description  : Contains the RTT up-buffer writer that reserves space with LDREX/STREX instead of masking interrupts.
+ **********************************************************************************************************************/
+
+#include <string.h>
+#include "common_utils.h"
+#include "rtt_lockfree.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup rtt_lockfree
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private function declarations
+ */
+static bool rtt_lockfree_reserve(rtt_lockfree_t * p_writer, uint32_t length, uint32_t * p_offset);
+static void rtt_lockfree_release(rtt_lockfree_t * p_writer);
+static void rtt_lockfree_publish(rtt_lockfree_t * p_writer);
+
+/*****************************************************************************************************************
+ *  @brief       Attach a writer to an up-buffer configured with SEGGER_RTT_ConfigUpBuffer()
+ *  @param[in]   p_writer   Writer to initialize
+ *  @param[in]   index      RTT up-buffer index
+ *  @retval      FSP_SUCCESS               Upon success
+ *  @retval      FSP_ERR_INVALID_ARGUMENT  No such up-buffer
+ *  @retval      FSP_ERR_INVALID_SIZE      Up-buffer missing or larger than the offset field
+ ****************************************************************************************************************/
+fsp_err_t rtt_lockfree_init(rtt_lockfree_t * p_writer, unsigned index)
+{
+    if (index >= (unsigned) SEGGER_RTT_MAX_NUM_UP_BUFFERS)
+    {
+        return FSP_ERR_INVALID_ARGUMENT;
+    }
+
+    p_writer->p_up = &_SEGGER_RTT.aUp[index];
+    if ((RESET_VALUE == p_writer->p_up->SizeOfBuffer) || (p_writer->p_up->SizeOfBuffer > RTT_LOCKFREE_SIZE_MAX))
+    {
+        return FSP_ERR_INVALID_SIZE;
+    }
+
+    p_writer->reservation   = (uint32_t) p_writer->p_up->WrOff << RTT_LOCKFREE_OFFSET_SHIFT;
+    p_writer->dropped_count = RESET_VALUE;
+    return FSP_SUCCESS;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Write bytes whole or not at all. Callable from interrupts of any priority, none is masked.
+ *               A write that pre-empts another one becomes visible to the host once both are copied.
+ *  @param[in]   p_writer   Writer
+ *  @param[in]   p_data     Bytes to write
+ *  @param[in]   length     Byte count, less than the up-buffer size
+ *  @retval      true       Written
+ *  @retval      false      No room, counted in dropped_count
+ ****************************************************************************************************************/
+bool rtt_lockfree_write(rtt_lockfree_t * p_writer, void const * p_data, uint32_t length)
+{
+    uint8_t const * p_bytes = p_data;
+    uint8_t       * p_dest  = (uint8_t *) p_writer->p_up->pBuffer;
+    uint32_t        offset  = RESET_VALUE;
+    uint32_t        first   = RESET_VALUE;
+
+    if (!rtt_lockfree_reserve(p_writer, length, &offset))
+    {
+        /* Counted without a lock like the rest */
+        uint32_t dropped;
+        do
+        {
+            dropped = __LDREXW(&p_writer->dropped_count);
+        } while (RESET_VALUE != __STREXW(dropped + 1u, &p_writer->dropped_count));
+
+        return false;
+    }
+
+    /* The reserved run may wrap around the end of the up-buffer */
+    first = p_writer->p_up->SizeOfBuffer - offset;
+    if (first > length)
+    {
+        first = length;
+    }
+    memcpy(&p_dest[offset], p_bytes, first);
+    memcpy(&p_dest[0], &p_bytes[first], length - first);
+
+    rtt_lockfree_release(p_writer);
+    return true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Claim a run of the up-buffer and count this writer as copying. Free space ends before RdOff, so
+ *               runs reserved but not yet published are never handed out twice.
+ *  @param[in]   p_writer   Writer
+ *  @param[in]   length     Bytes to claim
+ *  @param[out]  p_offset   Offset of the claimed run
+ *  @retval      true       Claimed
+ *  @retval      false      Not enough room or nothing to claim
+ ****************************************************************************************************************/
+static bool rtt_lockfree_reserve(rtt_lockfree_t * p_writer, uint32_t length, uint32_t * p_offset)
+{
+    uint32_t size = p_writer->p_up->SizeOfBuffer;
+    uint32_t reservation;
+    uint32_t offset;
+    uint32_t end;
+
+    if ((RESET_VALUE == length) || (length >= size))
+    {
+        return false;
+    }
+
+    do
+    {
+        reservation = __LDREXW(&p_writer->reservation);
+        offset      = reservation >> RTT_LOCKFREE_OFFSET_SHIFT;
+
+        /* One byte stays unused so that a full buffer differs from an empty one, as in SEGGER_RTT.c */
+        uint32_t read_offset = p_writer->p_up->RdOff;
+        uint32_t space       = (read_offset > offset) ? (read_offset - offset - 1u) :
+                                                        ((size - offset) + read_offset - 1u);
+        if (length > space)
+        {
+            __CLREX();
+            return false;
+        }
+
+        end = offset + length;
+        if (end >= size)
+        {
+            end -= size;
+        }
+
+        /* A pre-empting writer that changes the word in between makes the store fail, the claim is retried */
+    } while (RESET_VALUE != __STREXW((end << RTT_LOCKFREE_OFFSET_SHIFT) | ((reservation + 1u) &
+                                                                        RTT_LOCKFREE_WRITERS_MASK),
+                                     &p_writer->reservation));
+
+    *p_offset = offset;
+    return true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Count this writer as done. The last writer out publishes everything reserved so far.
+ *  @param[in]   p_writer   Writer
+ *  @retval      None
+ ****************************************************************************************************************/
+static void rtt_lockfree_release(rtt_lockfree_t * p_writer)
+{
+    uint32_t reservation;
+
+    /* The bytes must be in memory before the host can learn about them */
+    __DMB();
+
+    do
+    {
+        reservation = __LDREXW(&p_writer->reservation) - 1u;
+    } while (RESET_VALUE != __STREXW(reservation, &p_writer->reservation));
+
+    if (RESET_VALUE == (reservation & RTT_LOCKFREE_WRITERS_MASK))
+    {
+        rtt_lockfree_publish(p_writer);
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Move WrOff to the end of the reserved runs when no writer is copying. Exception entry and return
+ *               clear the exclusive monitor, so the reservation word read between LDREX and a successful STREX is
+ *               still current when WrOff is stored: WrOff never moves backwards nor over bytes being copied.
+ *  @param[in]   p_writer   Writer
+ *  @retval      None
+ ****************************************************************************************************************/
+static void rtt_lockfree_publish(rtt_lockfree_t * p_writer)
+{
+    volatile uint32_t * p_write_offset = (volatile uint32_t *) &p_writer->p_up->WrOff;
+    uint32_t            reservation;
+
+    do
+    {
+        (void) __LDREXW(p_write_offset);
+        reservation = p_writer->reservation;
+        if (RESET_VALUE != (reservation & RTT_LOCKFREE_WRITERS_MASK))
+        {
+            /* A writer that claimed after this one publishes when it is done */
+            __CLREX();
+            return;
+        }
+    } while (RESET_VALUE != __STREXW(reservation >> RTT_LOCKFREE_OFFSET_SHIFT, p_write_offset));
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup rtt_lockfree)
+ **********************************************************************************************************************/
@@ -0,0 +1,32 @@
+/***********************************************************************************************************************
+ * File Name    : rtt_lockfree.h
+ * Description  : Contains data structures and function declarations of rtt_lockfree.c.
+ **********************************************************************************************************************/
+
+#ifndef RTT_LOCKFREE_H_
+#define RTT_LOCKFREE_H_
+
+#include <stdint.h>
+#include "bsp_api.h"
+#include "SEGGER_RTT/SEGGER_RTT.h"
+
+/* Macro definition */
+#define RTT_LOCKFREE_OFFSET_SHIFT   (16u)       /* Reservation word: next free offset in the upper half */
+#define RTT_LOCKFREE_WRITERS_MASK   (0xFFFFu)   /* and the number of writers still copying in the lower half */
+#define RTT_LOCKFREE_SIZE_MAX       (0x10000u)  /* Largest up-buffer the offset field can address */
+
+/* Writer of one RTT up-buffer shared by producers of any priority. The J-Link host reader sees the usual
+ * SEGGER_RTT_BUFFER_UP: WrOff only ever moves over bytes that are fully written. The reservation word is private to
+ * the target, so the control block layout is unchanged. Nothing else may write the up-buffer once it is attached. */
+typedef struct st_rtt_lockfree
+{
+    SEGGER_RTT_BUFFER_UP * p_up;               /* Up-buffer in the RTT control block */
+    volatile uint32_t      reservation;        /* Next free offset << 16 | writers copying */
+    volatile uint32_t      dropped_count;      /* Writes refused for lack of room */
+} rtt_lockfree_t;
+
+/* Function declaration */
+fsp_err_t rtt_lockfree_init(rtt_lockfree_t * p_writer, unsigned index);
+bool rtt_lockfree_write(rtt_lockfree_t * p_writer, void const * p_data, uint32_t length);
+
+#endif /* RTT_LOCKFREE_H_ */
@@ -0,0 +1,19 @@
+/***********************************************************************************************************************
+ * File Name    : sci_b_uart_ext_cfg.h
+ * Description  : Contains the configuration of the project extensions to the SCI_B UART driver.
+ *                The configurator has no properties for them and regenerates r_sci_b_uart_cfg.h, so they are set
+ *                here. r_sci_b_uart.h includes this file after the generated configuration.
+ **********************************************************************************************************************/
+
+#ifndef SCI_B_UART_EXT_CFG_H_
+#define SCI_B_UART_EXT_CFG_H_
+
+/* Macro definition */
+#define SCI_B_UART_CFG_ISR_STATS_ENABLE     (1)     /* 1: count RXI/TXI interrupts and RXI cycles per channel */
+#define SCI_B_UART_CFG_RXI_FAST_PATH        (1)     /* 1: install an RXI handler specialised for the channel
+                                                     *    configuration at open. Compare builds with 0 and 1 with
+                                                     *    the 'b' report under the same load. */
+#define SCI_B_UART_CFG_RX_BLOCK_ENABLE      (1)     /* 1: R_SCI_B_UART_RxBlockSet() and UART_EVENT_RX_BLOCK, one
+                                                     *    callback per receive FIFO drain */
+
+#endif /* SCI_B_UART_EXT_CFG_H_ */
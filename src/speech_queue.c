@@ -0,0 +1,456 @@
+/***********************************************************************************************************************
+ * File Name    : speech_queue.c
+ * Description  : Contains the utterance queue between the PC and the talk board.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "speech_queue.h"
+#include "bridge_event.h"
+#include "uart_ep.h"
+#include "uart_pc.h"
+#include "line_latency.h"
+#include "timer_pwm.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup speech_queue
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define SPEECH_QUEUE_MASK         (SPEECH_QUEUE_DEPTH - 1u)
+#define SPEECH_ACK_LENGTH         (16u)     /* Kind, up to ten digits, carriage return and NUL */
+#define SPEECH_NO_ID              (UINT32_MAX)
+#define SPEECH_CYCLES_PER_US      (SystemCoreClock / 1000000u)
+#define SPEECH_CYCLES_PER_MS      (SystemCoreClock / 1000u)
+
+/*
+ * Private function declarations
+ */
+static void speech_queue_start(speech_queue_t * p_queue);
+static void speech_queue_barge_in(speech_queue_t * p_queue, uint32_t priority);
+static void speech_queue_track(speech_queue_t * p_queue, uint32_t ready_count);
+static void speech_queue_timeout(speech_queue_t * p_queue);
+static void speech_queue_wait(speech_queue_t * p_queue, uint32_t limit_ms);
+
+/*
+ * Private global variables
+ */
+/* Queue whose urgent phrases speech_queue_tx_start() times. There is one talk board, so one queue. */
+static speech_queue_t * gp_speech_queue = NULL;
+static void speech_queue_ack(char kind, uint32_t id);
+
+/*****************************************************************************************************************
+ *  @brief       Initialize an utterance queue. The talk board is assumed ready.
+ *  @param[in]   p_queue        Queue to initialize
+ *  @param[in]   ready_count    Current ready prompt count of the talk board channel
+ *  @retval      None
+ ****************************************************************************************************************/
+void speech_queue_init(speech_queue_t * p_queue, uint32_t ready_count)
+{
+    for (uint32_t i = RESET_VALUE; i < SPEECH_PRIORITY_COUNT; i++)
+    {
+        p_queue->head[i] = RESET_VALUE;
+        p_queue->tail[i] = RESET_VALUE;
+    }
+
+    p_queue->next_id          = RESET_VALUE;
+    p_queue->current_id       = RESET_VALUE;
+    p_queue->current_priority = RESET_VALUE;
+    p_queue->ready_seen       = ready_count;
+    p_queue->prompts_to_skip  = RESET_VALUE;
+    p_queue->wait_limit_ms    = RESET_VALUE;
+    p_queue->wait_ms          = RESET_VALUE;
+    p_queue->wait_cycles      = RESET_VALUE;
+    p_queue->wait_stamp       = RESET_VALUE;
+    p_queue->timeout_count    = RESET_VALUE;
+    p_queue->board_ready      = true;
+    p_queue->speaking         = false;
+    p_queue->p_urgent_slot    = NULL;
+    p_queue->urgent_submit_cycles = RESET_VALUE;
+    gp_speech_queue           = p_queue;
+
+    /* Urgent latency is measured with the DWT cycle counter */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+    speech_queue_stats_reset(p_queue);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Queue the phrase held in a line slot and acknowledge it to the PC. On success the queue owns the
+ *               slot and returns it to its pool once the phrase is on the wire.
+ *  @param[in]   p_queue    Utterance queue
+ *  @param[in]   p_slot     Line received from the PC, carriage return included
+ *  @retval      FSP_SUCCESS                 Phrase queued
+ *  @retval      FSP_ERR_INVALID_SIZE        Line holds no phrase, caller keeps the slot
+ *  @retval      FSP_ERR_INSUFFICIENT_SPACE  Queue of the requested priority is full, or the job is not urgent and
+ *                                           would take a line slot kept for urgent lines. Caller keeps the slot.
+ ****************************************************************************************************************/
+fsp_err_t speech_queue_submit(speech_queue_t * p_queue, uart_line_slot_t * p_slot)
+{
+    uint32_t priority = SPEECH_PRIORITY_NORMAL;
+    uint32_t offset   = RESET_VALUE;
+
+    /* Optional "#<n>" priority prefix */
+    if ((p_slot->length >= 2u) && (SPEECH_PRIORITY_PREFIX == p_slot->data[0]) &&
+        (p_slot->data[1] >= '0') && (p_slot->data[1] < ('0' + SPEECH_PRIORITY_COUNT)))
+    {
+        priority = (uint32_t) (p_slot->data[1] - '0');
+        offset   = 2u;
+    }
+
+    /* Nothing but the carriage return left */
+    if ((p_slot->length - offset) <= 1u)
+    {
+        return FSP_ERR_INVALID_SIZE;
+    }
+
+    /* All queues together hold more jobs than the pool has line slots. Less urgent jobs leave the last slots free,
+     * so an urgent line can still be received and barge in. */
+    if (((p_queue->head[priority] - p_queue->tail[priority]) >= SPEECH_QUEUE_DEPTH) ||
+        ((priority > SPEECH_BARGE_IN_PRIORITY) &&
+         (uart_line_pool_free_count(p_slot->p_pool) < SPEECH_URGENT_RESERVE)))
+    {
+        speech_queue_ack(SPEECH_ACK_REJECTED, SPEECH_NO_ID);
+        return FSP_ERR_INSUFFICIENT_SPACE;
+    }
+
+    speech_job_t * p_job = &p_queue->jobs[priority][p_queue->head[priority] & SPEECH_QUEUE_MASK];
+    p_job->p_slot        = p_slot;
+    p_job->offset        = offset;
+    p_job->id            = p_queue->next_id++;
+    p_job->submit_cycles = bridge_event_cycles();
+    p_queue->head[priority]++;
+
+    speech_queue_ack(SPEECH_ACK_QUEUED, p_job->id);
+
+    if (priority <= SPEECH_BARGE_IN_PRIORITY)
+    {
+        /* A prompt already received means the phrase in progress has ended, which must not be cut off and
+         * stopped again: the stop command would then get no answer the queue can tell apart */
+        speech_queue_track(p_queue, uart_ep_ready_count());
+        speech_queue_barge_in(p_queue, priority);
+    }
+
+    /* Start right away when the talk board is idle */
+    speech_queue_start(p_queue);
+
+    return FSP_SUCCESS;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Track the talk board ready prompt and send the next phrase when the board is ready. Call from the
+ *               main loop.
+ *  @param[in]   p_queue        Utterance queue
+ *  @param[in]   ready_count    Ready prompts received on the talk board channel so far
+ *  @retval      None
+ ****************************************************************************************************************/
+void speech_queue_poll(speech_queue_t * p_queue, uint32_t ready_count)
+{
+    speech_queue_track(p_queue, ready_count);
+    speech_queue_start(p_queue);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Time an urgent phrase as it starts on the wire. Matches the transmit queue start callback, runs
+ *               from the SCI0 TX complete interrupt or with interrupts masked.
+ *  @param[in]   p_context    Context of the message, the line slot for phrases
+ *  @retval      None
+ ****************************************************************************************************************/
+void speech_queue_tx_start(void * p_context)
+{
+    speech_queue_t * p_queue = gp_speech_queue;
+
+    if ((NULL == p_queue) || (NULL == p_context) || (p_queue->p_urgent_slot != p_context))
+    {
+        return;
+    }
+
+    /* Queued to first byte on SCI0, the abort of an interrupted phrase and the stop command included */
+    uint32_t latency = bridge_event_cycles() - p_queue->urgent_submit_cycles;
+    p_queue->urgent_latency_last = latency;
+    if (latency > p_queue->urgent_latency_max)
+    {
+        p_queue->urgent_latency_max = latency;
+    }
+    p_queue->urgent_count++;
+    p_queue->p_urgent_slot = NULL;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Count the ready prompts received since the last call and give up an overdue phrase
+ *  @param[in]   p_queue        Utterance queue
+ *  @param[in]   ready_count    Ready prompts received on the talk board channel so far
+ *  @retval      None
+ ****************************************************************************************************************/
+static void speech_queue_track(speech_queue_t * p_queue, uint32_t ready_count)
+{
+    uint32_t prompts = ready_count - p_queue->ready_seen;
+    p_queue->ready_seen = ready_count;
+
+    /* Prompts answering a stop command do not end the phrase sent after it */
+    uint32_t skip = (prompts < p_queue->prompts_to_skip) ? prompts : p_queue->prompts_to_skip;
+    p_queue->prompts_to_skip -= skip;
+    prompts                  -= skip;
+
+    if (RESET_VALUE != prompts)
+    {
+        /* Several prompts since the last poll still mean a single transition to ready */
+        if (p_queue->speaking)
+        {
+            speech_queue_ack(SPEECH_ACK_FINISHED, p_queue->current_id);
+            p_queue->speaking = false;
+        }
+        p_queue->board_ready = true;
+    }
+    else if (!p_queue->board_ready)
+    {
+        speech_queue_timeout(p_queue);
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Print the urgent job statistics over RTT
+ *  @param[in]   p_queue    Utterance queue
+ *  @retval      None
+ ****************************************************************************************************************/
+void speech_queue_report(speech_queue_t const * p_queue)
+{
+    uint32_t cycles_per_us = SPEECH_CYCLES_PER_US;
+
+    APP_REPLY("\r\nSpeech queue: %d waiting, board %s\r\n", speech_queue_pending(p_queue),
+              p_queue->board_ready ? "ready" : "busy");
+    APP_REPLY("Urgent jobs %d, barge-ins %d, latency last %d us, worst %d us\r\n", p_queue->urgent_count,
+              p_queue->barge_in_count, p_queue->urgent_latency_last / cycles_per_us,
+              p_queue->urgent_latency_max / cycles_per_us);
+    APP_REPLY("Prompt timeouts %d\r\n", p_queue->timeout_count);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Clear the urgent job statistics
+ *  @param[in]   p_queue    Utterance queue
+ *  @retval      None
+ ****************************************************************************************************************/
+void speech_queue_stats_reset(speech_queue_t * p_queue)
+{
+    p_queue->barge_in_count      = RESET_VALUE;
+    p_queue->urgent_count        = RESET_VALUE;
+    p_queue->urgent_latency_last = RESET_VALUE;
+    p_queue->urgent_latency_max  = RESET_VALUE;
+    p_queue->timeout_count       = RESET_VALUE;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Number of phrases waiting for the talk board
+ *  @param[in]   p_queue    Utterance queue
+ *  @retval      Jobs queued over all priorities
+ ****************************************************************************************************************/
+uint32_t speech_queue_pending(speech_queue_t const * p_queue)
+{
+    uint32_t pending = RESET_VALUE;
+
+    for (uint32_t i = RESET_VALUE; i < SPEECH_PRIORITY_COUNT; i++)
+    {
+        pending += p_queue->head[i] - p_queue->tail[i];
+    }
+
+    return pending;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Send the highest priority waiting phrase if the talk board is ready
+ *  @param[in]   p_queue    Utterance queue
+ *  @retval      None
+ ****************************************************************************************************************/
+static void speech_queue_start(speech_queue_t * p_queue)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    /* The prompt of a phrase sent during a talk board rate measurement would be dropped */
+    if ((!p_queue->board_ready) || uart_ep_autobaud_busy())
+    {
+        return;
+    }
+
+    for (uint32_t priority = RESET_VALUE; priority < SPEECH_PRIORITY_COUNT; priority++)
+    {
+        while (p_queue->head[priority] != p_queue->tail[priority])
+        {
+            speech_job_t     * p_job  = &p_queue->jobs[priority][p_queue->tail[priority] & SPEECH_QUEUE_MASK];
+            uart_line_slot_t * p_slot = p_job->p_slot;
+
+#if LINE_LATENCY_ENABLED
+            /* Armed first, the line may start on the wire before uart_print_user_line() returns */
+            line_latency_begin(p_slot);
+#endif
+            if (priority <= SPEECH_BARGE_IN_PRIORITY)
+            {
+                p_queue->urgent_submit_cycles = p_job->submit_cycles;
+                __DMB();
+                p_queue->p_urgent_slot = p_slot;
+            }
+
+            /* The slot goes back to the pool from the talk board TX complete interrupt */
+            err = uart_print_user_line(&p_slot->data[p_job->offset], p_slot->length - p_job->offset,
+                                       uart_line_pool_release, p_slot);
+            if (FSP_ERR_INSUFFICIENT_SPACE == err)
+            {
+                p_queue->p_urgent_slot = NULL;
+                /* Transmit queue is full, try again on the next poll */
+                return;
+            }
+
+            p_queue->tail[priority]++;
+
+            if (FSP_SUCCESS != err)
+            {
+                p_queue->p_urgent_slot = NULL;
+                /* Phrase cannot be sent at all, drop it and report it finished so the PC does not wait */
+#if LINE_LATENCY_ENABLED
+                line_latency_cancel();
+#endif
+                uart_line_pool_release(p_slot);
+                speech_queue_ack(SPEECH_ACK_FINISHED, p_job->id);
+                continue;
+            }
+
+            p_queue->current_id       = p_job->id;
+            p_queue->current_priority = priority;
+            p_queue->speaking         = true;
+            speech_queue_wait(p_queue, SPEECH_PROMPT_TIMEOUT_MS +
+                                       ((p_slot->length - p_job->offset) * SPEECH_PROMPT_MS_PER_BYTE));
+            speech_queue_ack(SPEECH_ACK_STARTED, p_job->id);
+            return;
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Make room for an urgent job. Less urgent jobs still waiting are flushed, and a less urgent phrase
+ *               the talk board is speaking is cut off on the wire and stopped on the board.
+ *  @param[in]   p_queue     Utterance queue
+ *  @param[in]   priority    Priority of the urgent job
+ *  @retval      None
+ ****************************************************************************************************************/
+static void speech_queue_barge_in(speech_queue_t * p_queue, uint32_t priority)
+{
+    for (uint32_t level = priority + 1u; level < SPEECH_PRIORITY_COUNT; level++)
+    {
+        while (p_queue->head[level] != p_queue->tail[level])
+        {
+            speech_job_t * p_job = &p_queue->jobs[level][p_queue->tail[level] & SPEECH_QUEUE_MASK];
+
+            uart_line_pool_release(p_job->p_slot);
+            speech_queue_ack(SPEECH_ACK_CANCELLED, p_job->id);
+            p_queue->tail[level]++;
+        }
+    }
+
+    if (p_queue->speaking && (p_queue->current_priority > priority))
+    {
+        /* Drops whatever of the phrase is still queued for SCI0, the slot is released by the abort */
+#if LINE_LATENCY_ENABLED
+        line_latency_cancel();
+#endif
+        uart_abort_user_msg();
+        speech_queue_ack(SPEECH_ACK_CANCELLED, p_queue->current_id);
+        p_queue->speaking = false;
+        p_queue->barge_in_count++;
+
+        /* Queued behind nothing, so the stop command goes out right away */
+        fsp_err_t err = uart_print_user_data((uint8_t const *) SPEECH_STOP_COMMAND, sizeof(SPEECH_STOP_COMMAND) - 1u);
+        if (FSP_SUCCESS == err)
+        {
+            p_queue->board_ready     = true;
+            p_queue->prompts_to_skip = SPEECH_STOP_PROMPTS;
+        }
+        else
+        {
+            /* The board may still be speaking the cut phrase. Its prompt, or the timeout, frees it. */
+            APP_ERR_PRINT("\r\n**  Talk board stop command not sent  **\r\n");
+            speech_queue_wait(p_queue, SPEECH_PROMPT_TIMEOUT_MS);
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Wait for the talk board prompt, giving up after a time
+ *  @param[in]   p_queue     Utterance queue
+ *  @param[in]   limit_ms    Prompt timeout
+ *  @retval      None
+ ****************************************************************************************************************/
+static void speech_queue_wait(speech_queue_t * p_queue, uint32_t limit_ms)
+{
+    p_queue->board_ready   = false;
+    p_queue->wait_limit_ms = limit_ms;
+    p_queue->wait_ms       = RESET_VALUE;
+    p_queue->wait_cycles   = RESET_VALUE;
+    p_queue->wait_stamp    = bridge_event_cycles();
+}
+
+/*****************************************************************************************************************
+ *  @brief       Give up the phrase sent when its ready prompt is overdue. The prompt may have been lost on the line,
+ *               or swallowed while SCI0 measured the rate, and the queue must not wait for it forever.
+ *  @param[in]   p_queue    Utterance queue
+ *  @retval      None
+ ****************************************************************************************************************/
+static void speech_queue_timeout(speech_queue_t * p_queue)
+{
+    uint32_t now           = bridge_event_cycles();
+    uint32_t cycles_per_ms = SPEECH_CYCLES_PER_MS;
+
+    /* The cycle counter wraps every few seconds, so the wait is summed in milliseconds poll by poll */
+    p_queue->wait_cycles += now - p_queue->wait_stamp;
+    p_queue->wait_stamp   = now;
+    p_queue->wait_ms     += p_queue->wait_cycles / cycles_per_ms;
+    p_queue->wait_cycles %= cycles_per_ms;
+    if (p_queue->wait_ms < p_queue->wait_limit_ms)
+    {
+        return;
+    }
+
+    if (p_queue->speaking)
+    {
+        speech_queue_ack(SPEECH_ACK_FAILED, p_queue->current_id);
+        p_queue->speaking = false;
+
+        /* The talk board is absent or stuck, the MCU sounds the chime itself. Without audio output this does
+         * nothing. */
+        (void) audio_chime();
+    }
+#if LINE_LATENCY_ENABLED
+    line_latency_cancel();
+#endif
+
+    /* A prompt owed to an earlier stop command is not waited for either */
+    p_queue->prompts_to_skip = RESET_VALUE;
+    p_queue->board_ready     = true;
+    p_queue->timeout_count++;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Send an acknowledgement to the PC. A full PC transmit queue only loses the acknowledgement.
+ *  @param[in]   kind    One of the SPEECH_ACK_ characters
+ *  @param[in]   id      Job number, SPEECH_NO_ID for none
+ *  @retval      None
+ ****************************************************************************************************************/
+static void speech_queue_ack(char kind, uint32_t id)
+{
+    char ack[SPEECH_ACK_LENGTH] = {RESET_VALUE};
+
+    if (SPEECH_NO_ID == id)
+    {
+        snprintf(ack, sizeof(ack), "%c\r", kind);
+    }
+    else
+    {
+        snprintf(ack, sizeof(ack), "%c%lu\r", kind, (unsigned long) id);
+    }
+
+    uart_print_pc_msg((uint8_t *) ack);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup speech_queue)
+ **********************************************************************************************************************/
@@ -0,0 +1,91 @@
+/***********************************************************************************************************************
+ * File Name    : speech_queue.h
+ * Description  : Contains data structures and function declarations of speech_queue.c.
+ **********************************************************************************************************************/
+
+#ifndef SPEECH_QUEUE_H_
+#define SPEECH_QUEUE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bsp_api.h"
+#include "uart_line_pool.h"
+
+/* Macro definition */
+#define SPEECH_QUEUE_DEPTH        (8u)      /* Jobs waiting per priority, must be a power of two */
+#define SPEECH_PRIORITY_PREFIX    ('#')     /* "#<n>" at the start of a line selects priority n, 0 is highest */
+#define SPEECH_BARGE_IN_PRIORITY  (SPEECH_PRIORITY_HIGH)    /* Jobs up to this priority interrupt less urgent speech */
+#define SPEECH_STOP_COMMAND       ("\x1B\r")  /* Sent to make the talk board drop the phrase it is speaking */
+#define SPEECH_STOP_PROMPTS       (1u)      /* Ready prompts the talk board returns for the stop command */
+#define SPEECH_PROMPT_TIMEOUT_MS  (5000u)   /* No prompt this long after a phrase was sent, plus the time below per
+                                             * phrase byte, and the job is given up: a lost prompt must not stop
+                                             * the queue for good */
+#define SPEECH_PROMPT_MS_PER_BYTE (200u)    /* Speaking time allowed per phrase byte */
+#define SPEECH_URGENT_RESERVE     (1u)      /* Line slots a less urgent job may not take, so an urgent line can
+                                             * always be received while the queues are full */
+
+/* Acknowledgements sent to the PC, each followed by the job number and a carriage return */
+#define SPEECH_ACK_QUEUED         ('Q')     /* Job accepted */
+#define SPEECH_ACK_STARTED        ('S')     /* Job sent to the talk board */
+#define SPEECH_ACK_FINISHED       ('F')     /* Talk board returned to its prompt */
+#define SPEECH_ACK_REJECTED       ('R')     /* Queue of the requested priority is full, no job number */
+#define SPEECH_ACK_CANCELLED      ('C')     /* Job interrupted or flushed by a more urgent one */
+#define SPEECH_ACK_FAILED         ('E')     /* No prompt from the talk board in time, the job is given up */
+
+/* Job priorities, lower value is spoken first */
+typedef enum e_speech_priority
+{
+    SPEECH_PRIORITY_HIGH = 0,
+    SPEECH_PRIORITY_NORMAL,
+    SPEECH_PRIORITY_LOW,
+    SPEECH_PRIORITY_COUNT
+} speech_priority_t;
+
+/* One phrase waiting for the talk board. The text stays in its line slot until transmission completes. */
+typedef struct st_speech_job
+{
+    uart_line_slot_t * p_slot;              /* Line holding the phrase */
+    uint32_t           offset;              /* First phrase byte in the slot, priority prefix skipped */
+    uint32_t           id;                  /* Job number reported to the PC */
+    uint32_t           submit_cycles;       /* Cycle counter when the job was queued */
+} speech_job_t;
+
+/* Utterance queue. Phrases wait here until the talk board reports it is ready, then the highest priority one is
+ * sent. An urgent job interrupts a less urgent phrase and flushes the less urgent jobs. Everything runs in the
+ * main loop, the UART callbacks only count ready prompts and time the start of urgent phrases. */
+typedef struct st_speech_queue
+{
+    speech_job_t jobs[SPEECH_PRIORITY_COUNT][SPEECH_QUEUE_DEPTH];   /* Job ring per priority */
+    uint32_t     head[SPEECH_PRIORITY_COUNT];                        /* Next job to fill */
+    uint32_t     tail[SPEECH_PRIORITY_COUNT];                        /* Next job to send */
+    uint32_t     next_id;                                            /* Number given to the next job */
+    uint32_t     current_id;                                         /* Job the talk board is speaking */
+    uint32_t     current_priority;                                   /* Priority of current_id */
+    uint32_t     ready_seen;                                         /* Ready prompt count at the last poll */
+    uint32_t     prompts_to_skip;                                    /* Prompts owed to a stop command */
+    uint32_t     wait_limit_ms;                                      /* Prompt timeout of the phrase sent */
+    uint32_t     wait_ms;                                            /* Time waited for the prompt so far */
+    uint32_t     wait_cycles;                                        /* Part of a millisecond not in wait_ms yet */
+    uint32_t     wait_stamp;                                         /* Cycle counter at the last wait update */
+    uint32_t     timeout_count;                                      /* Prompts that never came */
+    bool         board_ready;                                        /* Talk board is waiting for a phrase */
+    bool         speaking;                                           /* current_id is valid */
+    uint32_t     barge_in_count;                                     /* Phrases interrupted by urgent jobs */
+    volatile uint32_t urgent_count;                                  /* Urgent jobs started on SCI0 */
+    void const * volatile p_urgent_slot;                             /* Urgent line not started on SCI0 yet */
+    uint32_t     urgent_submit_cycles;                               /* Cycle counter when it was queued */
+    volatile uint32_t urgent_latency_last;                           /* Queued to first byte on SCI0 of the last
+                                                                      * urgent job, cycles */
+    volatile uint32_t urgent_latency_max;                            /* Worst urgent latency seen, cycles */
+} speech_queue_t;
+
+/* Function declaration */
+void speech_queue_init(speech_queue_t * p_queue, uint32_t ready_count);
+fsp_err_t speech_queue_submit(speech_queue_t * p_queue, uart_line_slot_t * p_slot);
+void speech_queue_poll(speech_queue_t * p_queue, uint32_t ready_count);
+void speech_queue_tx_start(void * p_context);
+uint32_t speech_queue_pending(speech_queue_t const * p_queue);
+void speech_queue_report(speech_queue_t const * p_queue);
+void speech_queue_stats_reset(speech_queue_t * p_queue);
+
+#endif /* SPEECH_QUEUE_H_ */
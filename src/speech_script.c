@@ -0,0 +1,167 @@
+/***********************************************************************************************************************
+ * File Name    : speech_script.c
+ * Description  : Contains the sentence ring holding a narration uploaded by the PC.
+ **********************************************************************************************************************/
+
+#include <string.h>
+#include "speech_script.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup speech_script
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#ifndef RESET_VALUE
+ #define RESET_VALUE              (0x00)
+#endif
+
+/*
+ * Private function declarations
+ */
+static void speech_script_copy_out(speech_script_t const * p_script, uint32_t offset, uint8_t * p_dest,
+                                   uint32_t length);
+
+/*****************************************************************************************************************
+ *  @brief       Attach the buffer and empty the script
+ *  @param[in]   p_script   Script to initialize
+ *  @param[in]   p_buffer   Sentence ring storage
+ *  @param[in]   size       Storage bytes, power of two
+ *  @retval      None
+ ****************************************************************************************************************/
+void speech_script_init(speech_script_t * p_script, uint8_t * p_buffer, uint32_t size)
+{
+    p_script->p_buffer = p_buffer;
+    p_script->size     = size;
+    speech_script_clear(p_script);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Drop all sentences and reset the counters. The buffer contents are left as they are.
+ *  @param[in]   p_script   Script
+ *  @retval      None
+ ****************************************************************************************************************/
+void speech_script_clear(speech_script_t * p_script)
+{
+    p_script->head         = RESET_VALUE;
+    p_script->tail         = RESET_VALUE;
+    p_script->state        = SPEECH_SCRIPT_STATE_IDLE;
+    p_script->stored_count = RESET_VALUE;
+    p_script->spoken_count = RESET_VALUE;
+    p_script->full_count   = RESET_VALUE;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Store one sentence. A carriage return is added, the text must not hold one.
+ *  @param[in]   p_script   Script
+ *  @param[in]   p_text     Sentence text without the carriage return
+ *  @param[in]   length     Text bytes
+ *  @retval      FSP_SUCCESS                 Upon success
+ *  @retval      FSP_ERR_INVALID_SIZE        Empty sentence
+ *  @retval      FSP_ERR_INSUFFICIENT_SPACE  Ring full, the sentence is counted in full_count. The sentences after
+ *                                           it are refused as well until the next clear, so the narration never
+ *                                           skips one.
+ ****************************************************************************************************************/
+fsp_err_t speech_script_append(speech_script_t * p_script, uint8_t const * p_text, uint32_t length)
+{
+    uint32_t mask   = p_script->size - 1u;
+    uint32_t offset = p_script->head & mask;
+    uint32_t first  = p_script->size - offset;
+
+    if (RESET_VALUE == length)
+    {
+        return FSP_ERR_INVALID_SIZE;
+    }
+    if ((RESET_VALUE != p_script->full_count) ||
+        ((length + 1u) > (p_script->size - (p_script->head - p_script->tail))))
+    {
+        p_script->full_count++;
+        return FSP_ERR_INSUFFICIENT_SPACE;
+    }
+
+    /* The sentence may wrap around the end of the ring */
+    if (first > length)
+    {
+        first = length;
+    }
+    memcpy(&p_script->p_buffer[offset], p_text, first);
+    memcpy(&p_script->p_buffer[0], &p_text[first], length - first);
+    p_script->p_buffer[(p_script->head + length) & mask] = SPEECH_SCRIPT_DELIMITER;
+
+    p_script->head += length + 1u;
+    p_script->stored_count++;
+    return FSP_SUCCESS;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Take out the oldest sentence. One longer than the destination is cut and ends with its carriage
+ *               return all the same, the rest of it is dropped.
+ *  @param[in]   p_script     Script
+ *  @param[out]  p_sentence   Destination, the sentence with its carriage return
+ *  @param[in]   size         Destination bytes, at least 2
+ *  @retval      Sentence bytes, carriage return included. 0 when no sentence is stored.
+ ****************************************************************************************************************/
+uint32_t speech_script_next(speech_script_t * p_script, uint8_t * p_sentence, uint32_t size)
+{
+    uint32_t mask   = p_script->size - 1u;
+    uint32_t stored = p_script->head - p_script->tail;
+    uint32_t offset = p_script->tail & mask;
+    uint32_t first  = p_script->size - offset;
+    uint32_t length = RESET_VALUE;
+    uint32_t copy   = RESET_VALUE;
+    uint8_t * p_end = NULL;
+
+    if (RESET_VALUE == stored)
+    {
+        return RESET_VALUE;
+    }
+
+    /* Find the delimiter in up to two runs, before and after the end of the ring */
+    if (first > stored)
+    {
+        first = stored;
+    }
+    p_end = memchr(&p_script->p_buffer[offset], SPEECH_SCRIPT_DELIMITER, first);
+    length = (NULL != p_end) ? (uint32_t) (p_end - &p_script->p_buffer[offset]) : first;
+    if ((NULL == p_end) && (stored > first))
+    {
+        p_end = memchr(&p_script->p_buffer[0], SPEECH_SCRIPT_DELIMITER, stored - first);
+        length += (NULL != p_end) ? (uint32_t) (p_end - &p_script->p_buffer[0]) : (stored - first);
+    }
+
+    /* Every stored sentence ends with its delimiter, length is the text before it */
+    copy = (length < (size - 1u)) ? length : (size - 1u);
+    speech_script_copy_out(p_script, offset, p_sentence, copy);
+    p_sentence[copy] = SPEECH_SCRIPT_DELIMITER;
+
+    p_script->tail += length + 1u;
+    p_script->spoken_count++;
+    return copy + 1u;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Copy bytes out of the ring, across its end when needed
+ *  @param[in]   p_script   Script
+ *  @param[in]   offset     Ring offset of the first byte
+ *  @param[out]  p_dest     Destination
+ *  @param[in]   length     Bytes to copy, at most the ring size
+ *  @retval      None
+ ****************************************************************************************************************/
+static void speech_script_copy_out(speech_script_t const * p_script, uint32_t offset, uint8_t * p_dest,
+                                   uint32_t length)
+{
+    uint32_t first = p_script->size - offset;
+
+    if (first > length)
+    {
+        first = length;
+    }
+    memcpy(p_dest, &p_script->p_buffer[offset], first);
+    memcpy(&p_dest[first], &p_script->p_buffer[0], length - first);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup speech_script)
+ **********************************************************************************************************************/
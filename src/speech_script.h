@@ -0,0 +1,52 @@
+/***********************************************************************************************************************
+ * File Name    : speech_script.h
+ * Description  : Contains data structures and function declarations of speech_script.c.
+ **********************************************************************************************************************/
+
+#ifndef SPEECH_SCRIPT_H_
+#define SPEECH_SCRIPT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bsp_api.h"
+
+/* Macro definition */
+#define SPEECH_SCRIPT_COMMAND_PREFIX ('@')  /* Same prefix as the link commands */
+#define SPEECH_SCRIPT_BEGIN       ('S')     /* "@S": drop the current script, store the lines that follow and speak them */
+#define SPEECH_SCRIPT_END         ('E')     /* "@E": upload complete, answered "@K<sentences stored>" */
+#define SPEECH_SCRIPT_CANCEL      ('X')     /* "@X": stop speaking the script and drop it */
+#define SPEECH_SCRIPT_ACCEPT      ('K')     /* Answer to "@E" */
+#define SPEECH_SCRIPT_FULL        ('O')     /* "@O<sentence>": ring full, the upload is cut before this sentence */
+#define SPEECH_SCRIPT_DONE        ('D')     /* "@D": last sentence of a complete upload handed to the talk board */
+#define SPEECH_SCRIPT_DELIMITER   ('\r')    /* Ends every sentence in the buffer */
+
+/* Script states */
+typedef enum e_speech_script_state
+{
+    SPEECH_SCRIPT_STATE_IDLE = 0,           /* No script */
+    SPEECH_SCRIPT_STATE_UPLOAD,             /* Lines from the PC are stored, stored sentences are spoken meanwhile */
+    SPEECH_SCRIPT_STATE_PLAY,               /* Upload complete, speaking the rest */
+} speech_script_state_t;
+
+/* Narration uploaded by the PC in one go. Each line is one sentence, stored with its carriage return in a byte ring
+ * so uploads of any length stream through, and taken out one sentence at a time as the talk board becomes ready.
+ * The PC link is then busy only for the upload, not for the whole narration. */
+typedef struct st_speech_script
+{
+    uint8_t             * p_buffer;         /* Sentence ring, SDRAM when enabled */
+    uint32_t              size;             /* Ring size, power of two */
+    uint32_t              head;             /* Bytes stored since the last clear */
+    uint32_t              tail;             /* Bytes taken out since the last clear */
+    speech_script_state_t state;            /* Upload and playback state */
+    uint32_t              stored_count;     /* Sentences stored since the last "@S" */
+    uint32_t              spoken_count;     /* Sentences taken out since the last "@S" */
+    uint32_t              full_count;       /* Sentences lost because the ring was full */
+} speech_script_t;
+
+/* Function declaration */
+void speech_script_init(speech_script_t * p_script, uint8_t * p_buffer, uint32_t size);
+void speech_script_clear(speech_script_t * p_script);
+fsp_err_t speech_script_append(speech_script_t * p_script, uint8_t const * p_text, uint32_t length);
+uint32_t speech_script_next(speech_script_t * p_script, uint8_t * p_sentence, uint32_t size);
+
+#endif /* SPEECH_SCRIPT_H_ */
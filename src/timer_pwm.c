@@ -11,12 +11,34 @@
 #include "common_utils.h"
 #include "timer_pwm.h"
 #include "uart_ep.h"
+#include "audio_pwm.h"
 
 /*******************************************************************************************************************//**
  * @addtogroup r_sci_uart_ep
  * @{
  **********************************************************************************************************************/
 
+/*
+ * Private macro definitions
+ */
+#define AUDIO_CHIME_TONE_SAMPLES  ((AUDIO_RATE_HZ * AUDIO_CHIME_TONE_MS) / 1000u)
+#define AUDIO_CHIME_HIGH_HZ       (880u)    /* First tone */
+#define AUDIO_CHIME_LOW_HZ        (660u)    /* Second tone */
+#define AUDIO_CHIME_AMPLITUDE     (24576)   /* 3/4 of full scale */
+
+#if TIMER_PWM_AUDIO
+/*
+ * Private function declarations
+ */
+static void audio_chime_render(int16_t * p_samples, uint32_t frequency);
+
+/* PWM-DAC fed by g_timer_audio and g_transfer_dmac_audio */
+static audio_pwm_t g_audio;
+
+/* Two tone chime, rendered once at start up */
+static int16_t g_audio_chime[AUDIO_CHIME_TONE_SAMPLES * 2u];
+#endif
+
 /*******************************************************************************************************************//**
  * @brief       Initialize GPT in PWM mode.
  * @param[in]   None
@@ -99,6 +121,126 @@ void timer_gpt_deinit(void)
         APP_ERR_PRINT ("\r\n ** R_GPT_Close API failed **\r\n");
     }
 }
+/*******************************************************************************************************************//**
+ * @brief       Open the PWM-DAC audio output and start it at AUDIO_RATE_HZ. The timer and the DMAC only run while
+ *              queued samples play.
+ * @param[in]   None
+ * @retval      FSP_SUCCESS         Upon success
+ * @retval      Any Other Error code apart from FSP_SUCCESS  Unsuccessful open or start
+ **********************************************************************************************************************/
+fsp_err_t audio_initialize(void)
+{
+#if TIMER_PWM_AUDIO
+    fsp_err_t err = FSP_SUCCESS;
+
+    audio_chime_render(&g_audio_chime[0], AUDIO_CHIME_HIGH_HZ);
+    audio_chime_render(&g_audio_chime[AUDIO_CHIME_TONE_SAMPLES], AUDIO_CHIME_LOW_HZ);
+
+    err = audio_pwm_open(&g_audio, &g_timer_audio, &g_transfer_dmac_audio);
+    if (FSP_SUCCESS != err)
+    {
+        return err;
+    }
+
+    err = audio_pwm_start(&g_audio, AUDIO_RATE_HZ);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n ** Audio start failed **\r\n");
+    }
+    return err;
+#else
+    return FSP_SUCCESS;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * @brief       Queue samples for the audio output, used when the talk board is busy or absent
+ * @param[in]   p_samples           Signed 16-bit mono samples at AUDIO_RATE_HZ, kept unchanged while they play
+ * @param[in]   count               Number of samples
+ * @retval      FSP_SUCCESS         Upon success
+ * @retval      FSP_ERR_UNSUPPORTED Audio output disabled
+ * @retval      Any Other Error code apart from FSP_SUCCESS  Queue full or no samples
+ **********************************************************************************************************************/
+fsp_err_t audio_play(int16_t const * p_samples, uint32_t count)
+{
+#if TIMER_PWM_AUDIO
+    return audio_pwm_write(&g_audio, p_samples, count);
+#else
+    FSP_PARAMETER_NOT_USED(p_samples);
+    FSP_PARAMETER_NOT_USED(count);
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * @brief       Play the two tone chime
+ * @param[in]   None
+ * @retval      FSP_SUCCESS         Upon success
+ * @retval      Any Other Error code apart from FSP_SUCCESS  See audio_play()
+ **********************************************************************************************************************/
+fsp_err_t audio_chime(void)
+{
+#if TIMER_PWM_AUDIO
+    return audio_play(g_audio_chime, sizeof(g_audio_chime) / sizeof(g_audio_chime[0]));
+#else
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * @brief       Print the audio output state on the RTT viewer
+ * @param[in]   None
+ * @retval      None
+ **********************************************************************************************************************/
+void audio_report(void)
+{
+#if TIMER_PWM_AUDIO
+    APP_REPLY("\r\nAudio %d Hz, period %d counts, halves %d, samples %d, queued %d, %s, pauses %d\r\n",
+              g_audio.sample_rate, g_audio.period_counts, g_audio.event_count, g_audio.sample_count,
+              audio_pwm_queued(&g_audio), g_audio.running ? "playing" : "idle", g_audio.pause_count);
+#endif
+}
+
+#if TIMER_PWM_AUDIO
+/*******************************************************************************************************************//**
+ * @brief       Render one decaying triangle tone
+ * @param[out]  p_samples           AUDIO_CHIME_TONE_SAMPLES samples
+ * @param[in]   frequency           Tone frequency in Hz
+ * @retval      None
+ **********************************************************************************************************************/
+static void audio_chime_render(int16_t * p_samples, uint32_t frequency)
+{
+    uint32_t phase = RESET_VALUE;
+    uint32_t step  = (uint32_t) (((uint64_t) frequency << 32) / AUDIO_RATE_HZ);
+
+    for (uint32_t i = RESET_VALUE; i < AUDIO_CHIME_TONE_SAMPLES; i++)
+    {
+        /* Triangle from the phase, -32768 .. 32767 */
+        int32_t triangle = (int32_t) ((phase < 0x80000000u) ? (phase >> 15) : (0xFFFFFFFFu - phase) >> 15) - 32768;
+
+        /* Linear decay to zero at the end of the tone */
+        int32_t envelope = (int32_t) ((AUDIO_CHIME_AMPLITUDE * (int32_t) (AUDIO_CHIME_TONE_SAMPLES - i)) /
+                                      (int32_t) AUDIO_CHIME_TONE_SAMPLES);
+
+        p_samples[i] = (int16_t) ((triangle * envelope) >> 15);
+        phase       += step;
+    }
+}
+#endif
+
+/*******************************************************************************************************************//**
+ * @brief       Audio DMAC callback, raised once per half of the duty buffer
+ * @param[in]   p_args              Transfer callback arguments
+ * @retval      None
+ **********************************************************************************************************************/
+void audio_pwm_dmac_callback(transfer_callback_args_t *p_args)
+{
+    FSP_PARAMETER_NOT_USED(p_args);
+#if TIMER_PWM_AUDIO
+    audio_pwm_event(&g_audio);
+#endif
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup r_sci_uart_ep)
  **********************************************************************************************************************/
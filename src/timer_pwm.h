@@ -18,11 +18,19 @@
 #define MAX_INTENISTY       (100u)        /* Maximum intensity 100 */
 #define STEP                (10u)         /* Step increment/decrement */
 #define MAX_DUTY_CYCLE      (1000u)       /* Max duty cycle count */
+#define TIMER_PWM_AUDIO     (1)           /* 1: PWM-DAC audio on GTIOC1A, P405, see audio_pwm.h. P405 is the
+                                           * Ethernet TXEN of pin group B, free while the Ethernet uses group A. */
+#define AUDIO_RATE_HZ       (16000u)      /* Sample rate of the chime and of cached phrases */
+#define AUDIO_CHIME_TONE_MS (150u)        /* Length of each chime tone */
 
 /* Function declaration */
 fsp_err_t gpt_initialize(void);
 fsp_err_t gpt_start(void);
 fsp_err_t set_intensity(uint32_t raw_count, uint8_t pin);
 void timer_gpt_deinit(void);
+fsp_err_t audio_initialize(void);
+fsp_err_t audio_play(int16_t const * p_samples, uint32_t count);
+fsp_err_t audio_chime(void);
+void audio_report(void);
 
 #endif /* TIMER_PWM_H_ */
@@ -0,0 +1,185 @@
+/***********************************************************************************************************************
+ * File Name    : trace.c
+ * Description  : Contains the event tracer, begin and end events with cycle time stamps on an RTT up-buffer.
+ **********************************************************************************************************************/
+
+#include <string.h>
+#include "common_utils.h"
+#include "trace.h"
+#include "bridge_event.h"
+#include "rtt_lockfree.h"
+
+#if TRACE_ENABLED
+
+/*******************************************************************************************************************//**
+ * @addtogroup trace
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define TRACE_NAME_WORDS          ((TRACE_NAME_MAX + 3u) / 4u)
+
+/*
+ * Private function declarations
+ */
+static void trace_isr_trampoline(void);
+
+/* Generated vector table in flash, ra_gen/vector_data.c */
+extern const fsp_vector_t g_vector_table[BSP_ICU_VECTOR_MAX_ENTRIES];
+
+/* Up-buffer read by the debug probe */
+static uint8_t g_trace_buffer[TRACE_BUFFER_SIZE];
+
+/* Writer shared by the main loop and the interrupts. The MCU has one core, the up-buffer is its event ring. */
+static rtt_lockfree_t g_trace_writer;
+
+/* Up-buffer configured */
+static volatile bool g_trace_ready = false;
+
+/* Handlers the wrapped vector table entries used to point at */
+static fsp_vector_t g_trace_isr_handlers[BSP_ICU_VECTOR_MAX_ENTRIES];
+
+/*****************************************************************************************************************
+ *  @brief       Configure the up-buffer and name the events of the bridge loop
+ *  @param[in]   None
+ *  @retval      FSP_SUCCESS   Upon success
+ *  @retval      Any Other Error code apart from FSP_SUCCESS  Up-buffer not usable
+ ****************************************************************************************************************/
+fsp_err_t trace_init(void)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    /* The time stamps come from the DWT cycle counter */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+    SEGGER_RTT_ConfigUpBuffer(TRACE_RTT_CHANNEL, "Trace", g_trace_buffer, sizeof(g_trace_buffer),
+                              SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+    err = rtt_lockfree_init(&g_trace_writer, TRACE_RTT_CHANNEL);
+    if (FSP_SUCCESS != err)
+    {
+        return err;
+    }
+    g_trace_ready = true;
+
+    trace_name(TRACE_ID_BRIDGE_LOOP, "bridge loop");
+    trace_name(TRACE_ID_PC_RX_STEP, "PC rx step");
+    trace_name(TRACE_ID_PC_TX_STEP, "PC tx step");
+    return FSP_SUCCESS;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Record one event. Called through TRACE_BEGIN() and TRACE_END(), from interrupts as well.
+ *  @param[in]   type   TRACE_TYPE_BEGIN or TRACE_TYPE_END
+ *  @param[in]   id     Event ID
+ *  @retval      None
+ ****************************************************************************************************************/
+void trace_event(trace_type_t type, uint32_t id)
+{
+    uint32_t record[2];
+
+    if (!g_trace_ready)
+    {
+        return;
+    }
+
+    record[0] = ((uint32_t) type << TRACE_TYPE_SHIFT) | (id & TRACE_ID_MASK);
+    record[1] = bridge_event_cycles();
+    (void) rtt_lockfree_write(&g_trace_writer, record, sizeof(record));
+}
+
+/*****************************************************************************************************************
+ *  @brief       Name an event ID for the host tool. Call before the first event of that ID.
+ *  @param[in]   id       Event ID
+ *  @param[in]   p_name   Name, cut at TRACE_NAME_MAX characters
+ *  @retval      None
+ ****************************************************************************************************************/
+void trace_name(uint32_t id, char const * p_name)
+{
+    uint32_t record[2u + TRACE_NAME_WORDS] = {RESET_VALUE};
+    uint32_t length = (uint32_t) strnlen(p_name, TRACE_NAME_MAX);
+
+    if (!g_trace_ready)
+    {
+        return;
+    }
+
+    record[0] = ((uint32_t) TRACE_TYPE_NAME << TRACE_TYPE_SHIFT) | (length << TRACE_LENGTH_SHIFT) |
+                (id & TRACE_ID_MASK);
+    record[1] = bridge_event_cycles();
+    memcpy(&record[2], p_name, length);
+    (void) rtt_lockfree_write(&g_trace_writer, record, (2u + ((length + 3u) / 4u)) * sizeof(uint32_t));
+}
+
+/*****************************************************************************************************************
+ *  @brief       Time an interrupt: its vector table entry is pointed at a wrapper that records TRACE_ID_IRQ_BASE
+ *               plus the IRQ number around the handler. The vector table must be in RAM, see ram_vectors_init().
+ *               Call after the driver is opened, R_SCI_B_UART_Open() installs its own RXI handler; reopening the
+ *               driver replaces the wrapper again.
+ *  @param[in]   irq      Interrupt to time
+ *  @param[in]   p_name   Event name
+ *  @retval      FSP_SUCCESS               Upon success
+ *  @retval      FSP_ERR_INVALID_ARGUMENT  Interrupt not used
+ *  @retval      FSP_ERR_UNSUPPORTED       Vector table still in flash
+ ****************************************************************************************************************/
+fsp_err_t trace_isr_wrap(IRQn_Type irq, char const * p_name)
+{
+    fsp_vector_t * p_table = (fsp_vector_t *) SCB->VTOR + BSP_CORTEX_VECTOR_TABLE_ENTRIES;
+
+    if ((irq < 0) || (irq >= (IRQn_Type) BSP_ICU_VECTOR_MAX_ENTRIES) || (NULL == p_table[irq]))
+    {
+        return FSP_ERR_INVALID_ARGUMENT;
+    }
+    if (p_table == g_vector_table)
+    {
+        return FSP_ERR_UNSUPPORTED;
+    }
+    if (trace_isr_trampoline == p_table[irq])
+    {
+        return FSP_SUCCESS;
+    }
+
+    trace_name(TRACE_ID_IRQ_BASE + (uint32_t) irq, p_name);
+
+    /* The handler must be known before the first exception that goes through the wrapper */
+    g_trace_isr_handlers[irq] = p_table[irq];
+    __DMB();
+    p_table[irq] = trace_isr_trampoline;
+    __DSB();
+    __ISB();
+    return FSP_SUCCESS;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Number of events lost so far
+ *  @param[in]   None
+ *  @retval      Events dropped
+ ****************************************************************************************************************/
+uint32_t trace_dropped(void)
+{
+    return g_trace_writer.dropped_count;
+}
+
+/*****************************************************************************************************************
+ *  @brief      Wrapper in the vector table entries of the timed interrupts. The handler sees the same IPSR, so
+ *              R_FSP_CurrentIrqGet() still finds its control block.
+ *  @param[in]  None
+ *  @retval     None
+ ****************************************************************************************************************/
+static void trace_isr_trampoline(void)
+{
+    IRQn_Type irq = R_FSP_CurrentIrqGet();
+    uint32_t  id  = TRACE_ID_IRQ_BASE + (uint32_t) irq;
+
+    trace_event(TRACE_TYPE_BEGIN, id);
+    g_trace_isr_handlers[irq]();
+    trace_event(TRACE_TYPE_END, id);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup trace)
+ **********************************************************************************************************************/
+
+#endif /* TRACE_ENABLED */
@@ -0,0 +1,61 @@
+/***********************************************************************************************************************
+ * File Name    : trace.h
+ * Description  : Contains data structures and function declarations of trace.c.
+ **********************************************************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <stdint.h>
+#include "bsp_api.h"
+
+/* Macro definition */
+#define TRACE_ENABLED             (0)       /* 1: begin and end events streamed on RTT, converted to a timeline by
+                                             *    tools/trace_to_chrome.py. 0: TRACE_BEGIN/TRACE_END compile to
+                                             *    nothing and no interrupt is wrapped. */
+#define TRACE_RTT_CHANNEL         (2u)      /* Last of the three RTT up-buffers, after the terminal and AppLog */
+#define TRACE_BUFFER_SIZE         (8192u)   /* Up-buffer bytes, 1024 events */
+#define TRACE_NAME_MAX            (24u)     /* Longest event name, longer ones are cut */
+#define TRACE_TYPE_SHIFT          (28u)     /* Event header: type in the top bits */
+#define TRACE_LENGTH_SHIFT        (16u)     /* name length of a name record */
+#define TRACE_ID_MASK             (0xFFFFu) /* and the event ID in the low half */
+
+/* Record layout, 32-bit little-endian words:
+ *   (type << TRACE_TYPE_SHIFT) | (name length << TRACE_LENGTH_SHIFT) | event ID
+ *   DWT cycle count when the event happened
+ *   name records only: the name, padded with NULs to a whole word
+ * Every ID used is named once, before its first event. A record the up-buffer has no room for is dropped whole. */
+
+/* Record types */
+typedef enum e_trace_type
+{
+    TRACE_TYPE_BEGIN = 0,                   /* Section entered */
+    TRACE_TYPE_END   = 1,                   /* Section left */
+    TRACE_TYPE_NAME  = 2,                   /* Name of an event ID */
+} trace_type_t;
+
+/* Event IDs */
+typedef enum e_trace_id
+{
+    TRACE_ID_BRIDGE_LOOP = 0,               /* One pass of uart_pc_com() after its wait */
+    TRACE_ID_PC_RX_STEP,                    /* Parsing of what the PC sent */
+    TRACE_ID_PC_TX_STEP,                    /* Feeding the talk board */
+    TRACE_ID_IRQ_BASE    = 0x100,           /* Wrapped interrupt, plus its IRQ number */
+} trace_id_t;
+
+#if TRACE_ENABLED
+ #define TRACE_BEGIN(id)          trace_event(TRACE_TYPE_BEGIN, (uint32_t) (id))
+ #define TRACE_END(id)            trace_event(TRACE_TYPE_END, (uint32_t) (id))
+#else
+ #define TRACE_BEGIN(id)
+ #define TRACE_END(id)
+#endif
+
+/* Function declaration */
+fsp_err_t trace_init(void);
+void trace_event(trace_type_t type, uint32_t id);
+void trace_name(uint32_t id, char const * p_name);
+fsp_err_t trace_isr_wrap(IRQn_Type irq, char const * p_name);
+uint32_t trace_dropped(void);
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,316 @@
+/***********************************************************************************************************************
+ * File Name    : uart_autobaud.c
+ * Description  : Contains the baud rate detection of the talk board channel.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "uart_autobaud.h"
+#include "bridge_event.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_autobaud
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define UART_AUTOBAUD_CYCLES_PER_MS   (SystemCoreClock / 1000u)
+#define UART_AUTOBAUD_RATE_COUNT      (12u)
+
+/*
+ * Private function declarations
+ */
+static uint32_t uart_autobaud_measure(uart_autobaud_t const * p_autobaud);
+static uint32_t uart_autobaud_snap(uint32_t rate);
+static fsp_err_t uart_autobaud_apply(uart_autobaud_t * p_autobaud, uint32_t rate);
+static void uart_autobaud_stop(uart_autobaud_t * p_autobaud);
+
+/* Standard rates a measurement is rounded to */
+static const uint32_t g_uart_autobaud_rate[UART_AUTOBAUD_RATE_COUNT] =
+{
+    9600u, 19200u, 38400u, 57600u, 115200u, 230400u, 460800u, 921600u, 1000000u, 1500000u, 2000000u, 3000000u
+};
+
+/*****************************************************************************************************************
+ *  @brief       Open the capture timer. The timer stays stopped until a measurement starts.
+ *  @param[in]   p_autobaud     Detection state to initialize
+ *  @param[in]   p_timer        GPT channel capturing both edges of the receive line
+ *  @param[in]   p_uart_ctrl    SCI_B channel to reconfigure
+ *  @retval      FSP_SUCCESS    Upon success
+ *  @retval      Any Other Error code apart from FSP_SUCCESS  Unsuccessful open
+ ****************************************************************************************************************/
+fsp_err_t uart_autobaud_open(uart_autobaud_t * p_autobaud, timer_instance_t const * p_timer,
+                             uart_ctrl_t * p_uart_ctrl)
+{
+    fsp_err_t    err  = FSP_SUCCESS;
+    timer_info_t info = {RESET_VALUE};
+
+    p_autobaud->p_timer     = p_timer;
+    p_autobaud->p_uart_ctrl = p_uart_ctrl;
+    p_autobaud->state       = UART_AUTOBAUD_STATE_IDLE;
+    p_autobaud->edge_count  = RESET_VALUE;
+    p_autobaud->rate        = RESET_VALUE;
+    p_autobaud->measured    = RESET_VALUE;
+    p_autobaud->done_count  = RESET_VALUE;
+    p_autobaud->fail_count  = RESET_VALUE;
+
+    /* The timeout is measured with the DWT cycle counter */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+    p_autobaud->timeout_cycles = UART_AUTOBAUD_TIMEOUT_MS * UART_AUTOBAUD_CYCLES_PER_MS;
+
+    err = p_timer->p_api->open(p_timer->p_ctrl, p_timer->p_cfg);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n** Autobaud timer open failed **\r\n");
+        return err;
+    }
+
+    err = p_timer->p_api->infoGet(p_timer->p_ctrl, &info);
+    p_autobaud->timer_hz = info.clock_frequency;
+    return err;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Start a measurement. The caller then makes the talk board send something, a wake-up line
+ *               answered with its prompt is enough.
+ *  @param[in]   p_autobaud     Detection state
+ *  @retval      FSP_SUCCESS    Upon success
+ *  @retval      FSP_ERR_IN_USE A measurement is already running
+ *  @retval      Any Other Error code apart from FSP_SUCCESS  Timer could not be started
+ ****************************************************************************************************************/
+fsp_err_t uart_autobaud_start(uart_autobaud_t * p_autobaud)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    if (UART_AUTOBAUD_STATE_MEASURING == p_autobaud->state)
+    {
+        return FSP_ERR_IN_USE;
+    }
+
+    p_autobaud->edge_count = RESET_VALUE;
+    p_autobaud->first_edge = true;
+    p_autobaud->start      = bridge_event_cycles();
+
+    /* State first, the capture interrupt checks it */
+    p_autobaud->state = UART_AUTOBAUD_STATE_MEASURING;
+
+    err = p_autobaud->p_timer->p_api->start(p_autobaud->p_timer->p_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        p_autobaud->state = UART_AUTOBAUD_STATE_FAILED;
+        APP_ERR_PRINT ("\r\n** Autobaud timer start failed **\r\n");
+    }
+    return err;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Store one edge. Call from the capture callback of the timer.
+ *  @param[in]   p_autobaud     Detection state
+ *  @param[in]   p_args         Timer callback arguments
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_autobaud_capture(uart_autobaud_t * p_autobaud, timer_callback_args_t * p_args)
+{
+    if ((TIMER_EVENT_CAPTURE_A != p_args->event) || (UART_AUTOBAUD_STATE_MEASURING != p_autobaud->state))
+    {
+        return;
+    }
+
+    if (p_autobaud->first_edge)
+    {
+        p_autobaud->first_edge = false;
+    }
+    else if (p_autobaud->edge_count < UART_AUTOBAUD_EDGES)
+    {
+        /* The timer runs over the full 32 bits, so the difference is right across a wrap */
+        p_autobaud->interval[p_autobaud->edge_count] = p_args->capture - p_autobaud->last_capture;
+        p_autobaud->edge_count++;
+    }
+    else
+    {
+        /* Buffer full, uart_autobaud_poll() finishes the measurement */
+    }
+
+    p_autobaud->last_capture = p_args->capture;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Finish a measurement once enough edges arrived or the timeout expired. Call from the main loop.
+ *  @param[in]   p_autobaud     Detection state
+ *  @retval      true when a measurement finished in this call, see state for the result
+ ****************************************************************************************************************/
+bool uart_autobaud_poll(uart_autobaud_t * p_autobaud)
+{
+    if (UART_AUTOBAUD_STATE_MEASURING != p_autobaud->state)
+    {
+        return false;
+    }
+
+    bool timeout = ((bridge_event_cycles() - p_autobaud->start) > p_autobaud->timeout_cycles);
+    if ((p_autobaud->edge_count < UART_AUTOBAUD_EDGES) && !timeout)
+    {
+        return false;
+    }
+
+    uart_autobaud_stop(p_autobaud);
+
+    uint32_t measured = RESET_VALUE;
+    if (p_autobaud->edge_count >= UART_AUTOBAUD_MIN_EDGES)
+    {
+        measured = uart_autobaud_measure(p_autobaud);
+    }
+
+    p_autobaud->measured = measured;
+    if ((RESET_VALUE != measured) && (FSP_SUCCESS == uart_autobaud_apply(p_autobaud, uart_autobaud_snap(measured))))
+    {
+        p_autobaud->done_count++;
+        p_autobaud->state = UART_AUTOBAUD_STATE_DONE;
+    }
+    else
+    {
+        p_autobaud->fail_count++;
+        p_autobaud->state = UART_AUTOBAUD_STATE_FAILED;
+    }
+    return true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Tell whether a measurement is running. Bytes received meanwhile may be framed at the wrong rate.
+ *  @param[in]   p_autobaud     Detection state
+ *  @retval      true while measuring
+ ****************************************************************************************************************/
+bool uart_autobaud_busy(uart_autobaud_t const * p_autobaud)
+{
+    return (UART_AUTOBAUD_STATE_MEASURING == p_autobaud->state);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Rate from the collected intervals. The shortest interval is taken as one bit, or as the fewest bits
+ *               that make every other interval a whole number of bits within a quarter bit. The total time is then
+ *               divided by the total bits.
+ *  @param[in]   p_autobaud     Detection state
+ *  @retval      Rate in bps, 0 when no usable interval was found
+ ****************************************************************************************************************/
+static uint32_t uart_autobaud_measure(uart_autobaud_t const * p_autobaud)
+{
+    uint32_t count    = p_autobaud->edge_count;
+    uint32_t shortest = UINT32_MAX;
+
+    for (uint32_t i = RESET_VALUE; i < count; i++)
+    {
+        if ((RESET_VALUE != p_autobaud->interval[i]) && (p_autobaud->interval[i] < shortest))
+        {
+            shortest = p_autobaud->interval[i];
+        }
+    }
+
+    if (UINT32_MAX == shortest)
+    {
+        return RESET_VALUE;
+    }
+
+    for (uint32_t split = 1u; split <= UART_AUTOBAUD_MAX_SPLIT; split++)
+    {
+        uint64_t time = RESET_VALUE;
+        uint32_t bits = RESET_VALUE;
+        bool     fits = true;
+
+        for (uint32_t i = RESET_VALUE; (i < count) && fits; i++)
+        {
+            /* Interval in units of shortest / split, rounded to whole bits */
+            uint64_t scaled = (uint64_t) p_autobaud->interval[i] * split;
+            uint64_t n      = (scaled + (shortest / 2u)) / shortest;
+            uint64_t whole  = n * shortest;
+            uint64_t error  = (scaled > whole) ? (scaled - whole) : (whole - scaled);
+
+            if ((n < 1u) || (n > UART_AUTOBAUD_MAX_BITS))
+            {
+                continue;
+            }
+
+            fits  = ((error * 4u) <= shortest);
+            time += p_autobaud->interval[i];
+            bits += (uint32_t) n;
+        }
+
+        if (fits && (RESET_VALUE != bits))
+        {
+            return (uint32_t) ((((uint64_t) p_autobaud->timer_hz * bits) + (time / 2u)) / time);
+        }
+    }
+
+    return RESET_VALUE;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Round a measured rate to the nearest standard rate when it is close enough
+ *  @param[in]   rate    Measured rate in bps
+ *  @retval      Standard rate, or the measured rate when none is within UART_AUTOBAUD_SNAP_X_1000
+ ****************************************************************************************************************/
+static uint32_t uart_autobaud_snap(uint32_t rate)
+{
+    for (uint32_t i = RESET_VALUE; i < UART_AUTOBAUD_RATE_COUNT; i++)
+    {
+        uint32_t standard   = g_uart_autobaud_rate[i];
+        uint32_t difference = (rate > standard) ? (rate - standard) : (standard - rate);
+
+        if (((uint64_t) difference * 1000u) <= ((uint64_t) standard * UART_AUTOBAUD_SNAP_X_1000))
+        {
+            return standard;
+        }
+    }
+    return rate;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Calculate the divisor and write it to the open channel. Bit rate modulation is only used when
+ *               no plain divisor is within UART_AUTOBAUD_MAX_ERROR_X_1000.
+ *  @param[in]   p_autobaud     Detection state
+ *  @param[in]   rate           Rate in bps
+ *  @retval      FSP_SUCCESS    Upon success
+ *  @retval      Any Other Error code apart from FSP_SUCCESS  No divisor or unsuccessful write
+ ****************************************************************************************************************/
+static fsp_err_t uart_autobaud_apply(uart_autobaud_t * p_autobaud, uint32_t rate)
+{
+    sci_b_baud_setting_t setting = {RESET_VALUE};
+    fsp_err_t            err     = R_SCI_B_UART_BaudCalculate(rate, false, UART_AUTOBAUD_MAX_ERROR_X_1000, &setting);
+
+    if (FSP_SUCCESS != err)
+    {
+        err = R_SCI_B_UART_BaudCalculate(rate, true, UART_AUTOBAUD_MAX_ERROR_X_1000, &setting);
+    }
+    if (FSP_SUCCESS != err)
+    {
+        return err;
+    }
+
+    err = R_SCI_B_UART_BaudSet(p_autobaud->p_uart_ctrl, &setting);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n**  R_SCI_B_UART_BaudSet API failed  **\r\n");
+        return err;
+    }
+
+    p_autobaud->rate = rate;
+    return err;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Stop the capture timer
+ *  @param[in]   p_autobaud     Detection state
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_autobaud_stop(uart_autobaud_t * p_autobaud)
+{
+    fsp_err_t err = p_autobaud->p_timer->p_api->stop(p_autobaud->p_timer->p_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n** Autobaud timer stop failed **\r\n");
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_autobaud)
+ **********************************************************************************************************************/
@@ -0,0 +1,65 @@
+/***********************************************************************************************************************
+ * File Name    : uart_autobaud.h
+ * Description  : Contains data structures and function declarations of uart_autobaud.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_AUTOBAUD_H_
+#define UART_AUTOBAUD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bsp_api.h"
+#include "r_timer_api.h"
+#include "r_sci_b_uart.h"
+
+/* Macro definition */
+#define UART_AUTOBAUD_EDGES        (64u)    /* Edge intervals collected per measurement */
+#define UART_AUTOBAUD_MIN_EDGES    (3u)     /* Intervals needed to accept a measurement at the timeout, a lone
+                                             * prompt '>' has 3 */
+#define UART_AUTOBAUD_MAX_BITS     (9u)     /* Longer intervals span an idle gap and are not used */
+#define UART_AUTOBAUD_MAX_SPLIT    (4u)     /* Shortest interval taken as up to this many bits */
+#define UART_AUTOBAUD_TIMEOUT_MS   (200u)   /* Time the talk board has to answer the wake-up line */
+#define UART_AUTOBAUD_SNAP_X_1000  (30u)    /* Measured rates within 3.0 % of a standard rate use that rate */
+#define UART_AUTOBAUD_MAX_ERROR_X_1000 (2000u)  /* Divisor error accepted by R_SCI_B_UART_BaudCalculate(), 2.000 % */
+
+/* Measurement states */
+typedef enum e_uart_autobaud_state
+{
+    UART_AUTOBAUD_STATE_IDLE = 0,           /* No measurement since start up */
+    UART_AUTOBAUD_STATE_MEASURING,          /* Capture running, waiting for edges */
+    UART_AUTOBAUD_STATE_DONE,               /* Rate measured and applied */
+    UART_AUTOBAUD_STATE_FAILED,             /* Too few edges or no usable divisor, previous rate kept */
+} uart_autobaud_state_t;
+
+/* Baud rate detection of one SCI_B channel. A GPT channel captures both edges of the line the channel receives
+ * on. The bit is the largest whole fraction of the shortest interval that every interval of up to
+ * UART_AUTOBAUD_MAX_BITS bits is a whole multiple of, and the average over those intervals refines it before the
+ * divisor is calculated and written without closing the channel. A reply whose runs are all an even number of bits
+ * long measures half the rate; the prompt '>' does not, its runs are 2, 5 and 2 bits. */
+typedef struct st_uart_autobaud
+{
+    timer_instance_t const * p_timer;       /* GPT channel capturing the receive line edges */
+    uart_ctrl_t            * p_uart_ctrl;   /* SCI_B channel to reconfigure */
+    volatile uart_autobaud_state_t state;   /* Measurement state */
+    uint32_t                 interval[UART_AUTOBAUD_EDGES];  /* Timer counts between successive edges */
+    volatile uint32_t        edge_count;    /* Intervals stored, the first edge only starts the count */
+    bool                     first_edge;    /* Next capture is the first edge of the measurement */
+    uint32_t                 last_capture;  /* Timer count of the previous edge */
+    uint32_t                 timer_hz;      /* Timer count clock */
+    uint32_t                 start;         /* Cycle counter when the measurement started */
+    uint32_t                 timeout_cycles;  /* UART_AUTOBAUD_TIMEOUT_MS in CPU cycles */
+    uint32_t                 rate;          /* Last applied rate in bps */
+    uint32_t                 measured;      /* Last measured rate in bps, before snapping */
+    uint32_t                 done_count;    /* Measurements applied */
+    uint32_t                 fail_count;    /* Measurements failed */
+} uart_autobaud_t;
+
+/* Function declaration */
+fsp_err_t uart_autobaud_open(uart_autobaud_t * p_autobaud, timer_instance_t const * p_timer,
+                             uart_ctrl_t * p_uart_ctrl);
+fsp_err_t uart_autobaud_start(uart_autobaud_t * p_autobaud);
+void uart_autobaud_capture(uart_autobaud_t * p_autobaud, timer_callback_args_t * p_args);
+bool uart_autobaud_poll(uart_autobaud_t * p_autobaud);
+bool uart_autobaud_busy(uart_autobaud_t const * p_autobaud);
+
+#endif /* UART_AUTOBAUD_H_ */
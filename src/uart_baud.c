@@ -0,0 +1,261 @@
+/***********************************************************************************************************************
+ * File Name    : uart_baud.c
+ * Description  : Contains the baud rate negotiation of the PC channel.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "uart_baud.h"
+#include "bridge_event.h"
+#include "uart_pc.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_baud
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define UART_BAUD_CYCLES_PER_MS   (SystemCoreClock / 1000u)
+#define UART_BAUD_REPLY_LENGTH    (16u)     /* "@A", up to ten digits, carriage return and NUL */
+#define UART_BAUD_SETTING(bgdm_, abcs_, abcse_, cks_, brr_, brme_, mddr_)                                   \
+    {.baudrate_bits_b.bgdm = (bgdm_), .baudrate_bits_b.abcs = (abcs_), .baudrate_bits_b.abcse = (abcse_),      \
+     .baudrate_bits_b.cks  = (cks_), .baudrate_bits_b.brr = (brr_), .baudrate_bits_b.brme = (brme_),           \
+     .baudrate_bits_b.mddr = (mddr_)}
+
+/*
+ * Private function declarations
+ */
+static void uart_baud_set(uart_baud_t * p_baud, uint32_t index);
+static void uart_baud_reply(char kind, uint32_t rate);
+
+/* Rates offered to the PC */
+static const uint32_t g_uart_baud_rate[UART_BAUD_RATE_COUNT] =
+{
+    115200u, 230400u, 460800u, 921600u, 1000000u, 1500000u, 2000000u, 3000000u, 4000000u
+};
+
+/* Register settings for g_uart_baud_rate, calculated with R_SCI_B_UART_BaudCalculate() for UART_BAUD_SCICLK_HZ.
+ * Bit rate modulation is only used where no divisor is exact. Recalculated at start up if the SCI clock differs,
+ * so a switch is a table lookup and never divides. */
+static sci_b_baud_setting_t g_uart_baud_setting[UART_BAUD_RATE_COUNT] =
+{
+    UART_BAUD_SETTING(1, 0, 0, 0, 64, false, 128),  /* 0.160 % error, same as the hal_data.c boot setting */
+    UART_BAUD_SETTING(1, 0, 0, 0, 21, true, 173),   /* 0.009 % */
+    UART_BAUD_SETTING(1, 0, 0, 0, 10, true, 173),   /* 0.009 % */
+    UART_BAUD_SETTING(1, 0, 0, 0,  6, true, 220),   /* 0.092 % */
+    UART_BAUD_SETTING(0, 0, 1, 0, 19, false, 128),  /* Exact */
+    UART_BAUD_SETTING(1, 0, 0, 0,  4, false, 128),  /* Exact */
+    UART_BAUD_SETTING(0, 0, 1, 0,  9, false, 128),  /* Exact */
+    UART_BAUD_SETTING(1, 1, 0, 0,  4, false, 128),  /* Exact */
+    UART_BAUD_SETTING(0, 0, 1, 0,  4, false, 128),  /* Exact */
+};
+
+/*****************************************************************************************************************
+ *  @brief       Initialize the negotiation. The channel must be open at the first table rate.
+ *  @param[in]   p_baud         Negotiation state to initialize
+ *  @param[in]   p_uart_ctrl    SCI_B channel to switch
+ *  @param[in]   p_tx_queue     Transmit queue of the channel
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_baud_init(uart_baud_t * p_baud, uart_ctrl_t * p_uart_ctrl, uart_tx_queue_t * p_tx_queue)
+{
+    p_baud->p_uart_ctrl    = p_uart_ctrl;
+    p_baud->p_tx_queue     = p_tx_queue;
+    p_baud->state          = UART_BAUD_STATE_IDLE;
+    p_baud->current        = RESET_VALUE;
+    p_baud->previous       = RESET_VALUE;
+    p_baud->requested      = RESET_VALUE;
+    p_baud->available      = (1u << UART_BAUD_RATE_COUNT) - 1u;
+    p_baud->error          = false;
+    p_baud->switch_count   = RESET_VALUE;
+    p_baud->fallback_count = RESET_VALUE;
+
+    /* The probe timeout is measured with the DWT cycle counter */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+    p_baud->probe_cycles = UART_BAUD_PROBE_TIMEOUT_MS * UART_BAUD_CYCLES_PER_MS;
+
+    if (UART_BAUD_SCICLK_HZ != R_FSP_SciClockHzGet())
+    {
+        /* Clock tree changed since the table was made. The boot rate stays as configured in hal_data.c. */
+        for (uint32_t i = 1u; i < UART_BAUD_RATE_COUNT; i++)
+        {
+            if ((FSP_SUCCESS != R_SCI_B_UART_BaudCalculate(g_uart_baud_rate[i], false, UART_BAUD_MAX_ERROR_X_1000,
+                                                           &g_uart_baud_setting[i])) &&
+                (FSP_SUCCESS != R_SCI_B_UART_BaudCalculate(g_uart_baud_rate[i], true, UART_BAUD_MAX_ERROR_X_1000,
+                                                           &g_uart_baud_setting[i])))
+            {
+                p_baud->available &= ~(1u << i);
+            }
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Handle a link command line from the PC
+ *  @param[in]   p_baud    Negotiation state
+ *  @param[in]   p_line    Received line, carriage return included
+ *  @param[in]   length    Line length
+ *  @retval      true when the line was a link command and must not be forwarded
+ ****************************************************************************************************************/
+bool uart_baud_command(uart_baud_t * p_baud, uint8_t const * p_line, uint32_t length)
+{
+    if ((length < 2u) || (UART_BAUD_COMMAND_PREFIX != p_line[0]))
+    {
+        return false;
+    }
+
+    if (UART_BAUD_PROBE_COMMAND == p_line[1])
+    {
+        if (UART_BAUD_STATE_PROBE == p_baud->state)
+        {
+            /* Bytes arrived at the new rate, keep it unless the channel reported errors meanwhile */
+            if (p_baud->error)
+            {
+                return true;
+            }
+            p_baud->state = UART_BAUD_STATE_IDLE;
+            p_baud->switch_count++;
+        }
+        uart_baud_reply(UART_BAUD_PROBE_COMMAND, RESET_VALUE);
+        return true;
+    }
+
+    if (UART_BAUD_SWITCH_COMMAND == p_line[1])
+    {
+        uint32_t rate  = RESET_VALUE;
+        uint32_t index = UART_BAUD_RATE_COUNT;
+
+        for (uint32_t i = 2u; (i < length) && (p_line[i] >= '0') && (p_line[i] <= '9') && (rate < 100000000u); i++)
+        {
+            rate = (rate * 10u) + (uint32_t) (p_line[i] - '0');
+        }
+
+        for (uint32_t i = RESET_VALUE; i < UART_BAUD_RATE_COUNT; i++)
+        {
+            if ((g_uart_baud_rate[i] == rate) && (p_baud->available & (1u << i)))
+            {
+                index = i;
+            }
+        }
+
+        if ((UART_BAUD_STATE_IDLE != p_baud->state) || (UART_BAUD_RATE_COUNT == index))
+        {
+            uart_baud_reply(UART_BAUD_REJECT, RESET_VALUE);
+            return true;
+        }
+
+        /* Acknowledge at the old rate, the switch waits until the acknowledgement is on the wire */
+        uart_baud_reply(UART_BAUD_ACCEPT, rate);
+        p_baud->requested = index;
+        p_baud->state     = UART_BAUD_STATE_DRAIN;
+        return true;
+    }
+
+    /* Unknown command, do not let it reach the talk board either */
+    uart_baud_reply(UART_BAUD_REJECT, RESET_VALUE);
+    return true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Advance the negotiation. Call from the main loop.
+ *  @param[in]   p_baud    Negotiation state
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_baud_poll(uart_baud_t * p_baud)
+{
+    if (UART_BAUD_STATE_DRAIN == p_baud->state)
+    {
+        /* Changing the rate cuts off any byte still being sent */
+        if (uart_tx_queue_idle(p_baud->p_tx_queue))
+        {
+            p_baud->previous = p_baud->current;
+            uart_baud_set(p_baud, p_baud->requested);
+            p_baud->error       = false;
+            p_baud->probe_start = bridge_event_cycles();
+            p_baud->state       = UART_BAUD_STATE_PROBE;
+        }
+    }
+    else if (UART_BAUD_STATE_PROBE == p_baud->state)
+    {
+        /* The PC returns to the previous rate on its own when it gets no probe answer */
+        if (p_baud->error || ((bridge_event_cycles() - p_baud->probe_start) > p_baud->probe_cycles))
+        {
+            uart_baud_set(p_baud, p_baud->previous);
+            p_baud->fallback_count++;
+            p_baud->state = UART_BAUD_STATE_IDLE;
+        }
+    }
+    else
+    {
+        /* Nothing in progress */
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Report a receive error. Call from the UART callback. Only matters while a new rate is on probation.
+ *  @param[in]   p_baud    Negotiation state
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_baud_error(uart_baud_t * p_baud)
+{
+    if (UART_BAUD_STATE_PROBE == p_baud->state)
+    {
+        p_baud->error = true;
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Rate in use
+ *  @param[in]   p_baud    Negotiation state
+ *  @retval      Baud rate in bps
+ ****************************************************************************************************************/
+uint32_t uart_baud_rate(uart_baud_t const * p_baud)
+{
+    return g_uart_baud_rate[p_baud->current];
+}
+
+/*****************************************************************************************************************
+ *  @brief       Apply a table entry to the channel
+ *  @param[in]   p_baud    Negotiation state
+ *  @param[in]   index     Table index
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_baud_set(uart_baud_t * p_baud, uint32_t index)
+{
+    fsp_err_t err = R_SCI_B_UART_BaudSet(p_baud->p_uart_ctrl, &g_uart_baud_setting[index]);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n**  R_SCI_B_UART_BaudSet API failed  **\r\n");
+        return;
+    }
+
+    p_baud->current = index;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Answer the PC. A full PC transmit queue loses the answer, the PC then times out and retries.
+ *  @param[in]   kind    Reply character after the command prefix
+ *  @param[in]   rate    Rate to append, 0 for none
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_baud_reply(char kind, uint32_t rate)
+{
+    char reply[UART_BAUD_REPLY_LENGTH] = {RESET_VALUE};
+
+    if (RESET_VALUE == rate)
+    {
+        snprintf(reply, sizeof(reply), "%c%c\r", UART_BAUD_COMMAND_PREFIX, kind);
+    }
+    else
+    {
+        snprintf(reply, sizeof(reply), "%c%c%lu\r", UART_BAUD_COMMAND_PREFIX, kind, (unsigned long) rate);
+    }
+
+    uart_print_pc_msg((uint8_t *) reply);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_baud)
+ **********************************************************************************************************************/
@@ -0,0 +1,60 @@
+/***********************************************************************************************************************
+ * File Name    : uart_baud.h
+ * Description  : Contains data structures and function declarations of uart_baud.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_BAUD_H_
+#define UART_BAUD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bsp_api.h"
+#include "r_sci_b_uart.h"
+#include "uart_tx_queue.h"
+
+/* Macro definition */
+#define UART_BAUD_COMMAND_PREFIX  ('@')     /* Lines starting with it are link commands, never phrases */
+#define UART_BAUD_SWITCH_COMMAND  ('B')     /* "@B<rate>": switch to <rate>, answered "@A<rate>" or "@N" */
+#define UART_BAUD_PROBE_COMMAND   ('P')     /* "@P": link check, answered "@P". Confirms a switch. */
+#define UART_BAUD_ACCEPT          ('A')     /* Switch accepted, the new rate follows the acknowledgement */
+#define UART_BAUD_REJECT          ('N')     /* Rate not in the table, negotiation busy or unknown command */
+#define UART_BAUD_RATE_COUNT      (9u)      /* Entries in the baud rate table, the first one is the boot rate */
+#define UART_BAUD_SCICLK_HZ       (120000000u)  /* SCI clock the baud rate table was calculated for */
+#define UART_BAUD_MAX_ERROR_X_1000 (2000u)  /* Rate error accepted when the table is recalculated, 2.000 % */
+#define UART_BAUD_PROBE_TIMEOUT_MS (500u)   /* Time the PC has to send "@P" at the new rate */
+
+/* Negotiation states */
+typedef enum e_uart_baud_state
+{
+    UART_BAUD_STATE_IDLE = 0,               /* Running at the current rate */
+    UART_BAUD_STATE_DRAIN,                  /* "@A" accepted, waiting for it to leave the transmitter */
+    UART_BAUD_STATE_PROBE,                  /* New rate set, waiting for the PC probe */
+} uart_baud_state_t;
+
+/* Baud rate negotiation of one SCI_B channel. The PC asks for a rate from the table, the board acknowledges at
+ * the old rate, switches once the acknowledgement is out and keeps the new rate only if the PC probe arrives
+ * without receive errors before the timeout. Otherwise both sides return to the previous rate. */
+typedef struct st_uart_baud
+{
+    uart_ctrl_t       * p_uart_ctrl;        /* SCI_B channel to switch */
+    uart_tx_queue_t   * p_tx_queue;         /* Transmit queue of the channel, drained before a switch */
+    uart_baud_state_t   state;              /* Negotiation state */
+    uint32_t            current;            /* Table index in use */
+    uint32_t            previous;           /* Table index to return to when the probe fails */
+    uint32_t            requested;          /* Table index acknowledged to the PC */
+    uint32_t            available;          /* Bit per table index usable at the present SCI clock */
+    uint32_t            probe_start;        /* Cycle counter when the new rate was set */
+    uint32_t            probe_cycles;       /* UART_BAUD_PROBE_TIMEOUT_MS in CPU cycles */
+    volatile bool       error;              /* Receive error reported by the UART callback */
+    uint32_t            switch_count;       /* Switches confirmed by a probe */
+    uint32_t            fallback_count;     /* Switches undone */
+} uart_baud_t;
+
+/* Function declaration */
+void uart_baud_init(uart_baud_t * p_baud, uart_ctrl_t * p_uart_ctrl, uart_tx_queue_t * p_tx_queue);
+bool uart_baud_command(uart_baud_t * p_baud, uint8_t const * p_line, uint32_t length);
+void uart_baud_poll(uart_baud_t * p_baud);
+void uart_baud_error(uart_baud_t * p_baud);
+uint32_t uart_baud_rate(uart_baud_t const * p_baud);
+
+#endif /* UART_BAUD_H_ */
@@ -0,0 +1,204 @@
+/***********************************************************************************************************************
+ * File Name    : uart_bench.c
+ * Description  : Contains the UART interrupt load benchmark.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "uart_bench.h"
+#include "uart_text.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_bench
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define UART_BENCH_CHANNELS       (2u)
+#define UART_BENCH_KB             (1024u)
+#define UART_BENCH_TEXT_MIN       (16u)     /* Smallest text kernel input, quadrupled up to the largest */
+#define UART_BENCH_TEXT_MAX       (4096u)
+#define UART_BENCH_TEXT_PASSES    (8u)      /* Runs per size, the fastest one is reported */
+
+/*
+ * Private data structures
+ */
+typedef struct st_uart_bench_snapshot
+{
+    uint32_t rxi_count;
+    uint32_t rx_byte_count;
+    uint32_t rx_idle_count;
+    uint32_t txi_count;
+    uint32_t rxi_cycles;
+} uart_bench_snapshot_t;
+
+/*
+ * Private global variables
+ */
+static sci_b_uart_instance_ctrl_t * const gp_bench_ctrl[UART_BENCH_CHANNELS] = {&g_uart0_ctrl, &g_uart2_ctrl};
+static char const * const g_bench_name[UART_BENCH_CHANNELS] = {"SCI0 talk board", "SCI2 PC"};
+
+/* Counter values when the measurement window was opened */
+static uart_bench_snapshot_t g_bench_start[UART_BENCH_CHANNELS];
+
+/* Text kernel input, printable romaji with the line end in the last byte so every kernel reads all of it */
+static uint8_t g_bench_text[UART_BENCH_TEXT_MAX];
+
+/*
+ * Private function declarations
+ */
+static uint32_t uart_bench_text_cycles(uint32_t kernel, uint32_t length, uint32_t * p_result);
+
+/*****************************************************************************************************************
+ *  @brief       Open a new measurement window on all bridge channels
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_bench_reset(void)
+{
+#if SCI_B_UART_CFG_ISR_STATS_ENABLE
+    /* The RXI handlers time themselves with the DWT cycle counter */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint32_t i = RESET_VALUE; i < UART_BENCH_CHANNELS; i++)
+    {
+        g_bench_start[i].rxi_count     = gp_bench_ctrl[i]->rxi_count;
+        g_bench_start[i].rx_byte_count = gp_bench_ctrl[i]->rx_byte_count;
+        g_bench_start[i].rx_idle_count = gp_bench_ctrl[i]->rx_idle_count;
+        g_bench_start[i].txi_count     = gp_bench_ctrl[i]->txi_count;
+        g_bench_start[i].rxi_cycles    = gp_bench_ctrl[i]->rxi_cycles;
+    }
+#endif
+}
+
+/*****************************************************************************************************************
+ *  @brief       Print RX interrupt entries per KB and RXI cycles per byte received since the last reset over RTT
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_bench_report(void)
+{
+#if SCI_B_UART_CFG_ISR_STATS_ENABLE
+    APP_REPLY("\r\nUART ISR load (FIFO %s, RXI fast path %s)", SCI_B_UART_CFG_FIFO_SUPPORT ? "on" : "off",
+              SCI_B_UART_CFG_RXI_FAST_PATH ? "on" : "off");
+
+    for (uint32_t i = RESET_VALUE; i < UART_BENCH_CHANNELS; i++)
+    {
+        uint32_t rxi   = gp_bench_ctrl[i]->rxi_count - g_bench_start[i].rxi_count;
+        uint32_t bytes = gp_bench_ctrl[i]->rx_byte_count - g_bench_start[i].rx_byte_count;
+        uint32_t idle  = gp_bench_ctrl[i]->rx_idle_count - g_bench_start[i].rx_idle_count;
+        uint32_t txi   = gp_bench_ctrl[i]->txi_count - g_bench_start[i].txi_count;
+        uint32_t cycles = gp_bench_ctrl[i]->rxi_cycles - g_bench_start[i].rxi_cycles;
+
+        /* RXI entries per KB, one decimal place */
+        uint32_t per_kb_x10 = (RESET_VALUE == bytes) ? RESET_VALUE :
+                              (uint32_t) (((uint64_t) rxi * UART_BENCH_KB * 10u) / bytes);
+
+        /* RXI handler cycles per received byte, one decimal place */
+        uint32_t cycles_x10 = (RESET_VALUE == bytes) ? RESET_VALUE : (uint32_t) (((uint64_t) cycles * 10u) / bytes);
+
+        APP_REPLY("\r\n  %s: %u bytes, %u RXI (%u idle), %u.%u RXI/KB, %u.%u cycles/byte, %u TXI",
+                  g_bench_name[i], bytes, rxi, idle, per_kb_x10 / 10u, per_kb_x10 % 10u,
+                  cycles_x10 / 10u, cycles_x10 % 10u, txi);
+    }
+    /* The handlers time themselves from their first to their last instruction */
+    APP_REPLY("\r\n  Cycles exclude exception entry and exit, add their cost once per RXI\r\n");
+#else
+    APP_REPLY("\r\nUART ISR statistics disabled (SCI_B_UART_CFG_ISR_STATS_ENABLE)\r\n");
+#endif
+}
+
+/*****************************************************************************************************************
+ *  @brief       Print the cycles of the Helium text kernels and of their scalar versions for 16 B to 4 KB of text
+ *               over RTT. Results that differ between the two are flagged.
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_bench_text(void)
+{
+    static char const * const kernel_name[3] = {"find_eol", "printable", "classify"};
+    static uint8_t const      romaji[]       = "konnichiha, tenki ga yoi desune. ";
+
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint32_t i = RESET_VALUE; i < UART_BENCH_TEXT_MAX; i++)
+    {
+        g_bench_text[i] = romaji[i % (sizeof(romaji) - 1u)];
+    }
+
+    APP_REPLY("\r\nText kernels (MVE %s), cycles scalar / vector", UART_TEXT_USE_MVE ? "on" : "off");
+
+    for (uint32_t length = UART_BENCH_TEXT_MIN; length <= UART_BENCH_TEXT_MAX; length *= 4u)
+    {
+        /* Line end last, found by the search and rejected by the printable check only at the very end */
+        g_bench_text[length - 1u] = '\r';
+
+        APP_REPLY("\r\n  %4u B:", length);
+        for (uint32_t kernel = RESET_VALUE; kernel < 3u; kernel++)
+        {
+            uint32_t scalar_result = RESET_VALUE;
+            uint32_t vector_result = RESET_VALUE;
+            uint32_t scalar        = uart_bench_text_cycles(kernel, length, &scalar_result);
+            uint32_t vector        = uart_bench_text_cycles(kernel + 3u, length, &vector_result);
+
+            APP_REPLY(" %s %u / %u%s", kernel_name[kernel], scalar, vector,
+                      (scalar_result == vector_result) ? "" : " MISMATCH");
+        }
+
+        g_bench_text[length - 1u] = romaji[(length - 1u) % (sizeof(romaji) - 1u)];
+    }
+    APP_REPLY("\r\n");
+}
+
+/*****************************************************************************************************************
+ *  @brief       Time one text kernel on the benchmark text
+ *  @param[in]   kernel      0 to 2 scalar find_eol, printable, classify, 3 to 5 the same dispatched versions
+ *  @param[in]   length      Bytes of g_bench_text to process
+ *  @param[out]  p_result    Kernel result, compared between the two versions
+ *  @retval      Fewest cycles of UART_BENCH_TEXT_PASSES runs
+ ****************************************************************************************************************/
+static uint32_t uart_bench_text_cycles(uint32_t kernel, uint32_t length, uint32_t * p_result)
+{
+    uint32_t best = UINT32_MAX;
+
+    for (uint32_t pass = RESET_VALUE; pass < UART_BENCH_TEXT_PASSES; pass++)
+    {
+        uint32_t start = DWT->CYCCNT;
+
+        switch (kernel)
+        {
+            case 0u:
+                *p_result = uart_text_find_eol_scalar(g_bench_text, length);
+                break;
+            case 1u:
+                *p_result = uart_text_printable_scalar(g_bench_text, length);
+                break;
+            case 2u:
+                *p_result = uart_text_classify_scalar(g_bench_text, length);
+                break;
+            case 3u:
+                *p_result = uart_text_find_eol(g_bench_text, length);
+                break;
+            case 4u:
+                *p_result = uart_text_printable(g_bench_text, length);
+                break;
+            default:
+                *p_result = uart_text_classify(g_bench_text, length);
+                break;
+        }
+
+        uint32_t cycles = DWT->CYCCNT - start;
+        if (cycles < best)
+        {
+            best = cycles;
+        }
+    }
+    return best;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_bench)
+ **********************************************************************************************************************/
@@ -0,0 +1,14 @@
+/***********************************************************************************************************************
+ * File Name    : uart_bench.h
+ * Description  : Contains function declarations of uart_bench.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_BENCH_H_
+#define UART_BENCH_H_
+
+/* Function declaration */
+void uart_bench_reset(void);
+void uart_bench_report(void);
+void uart_bench_text(void);
+
+#endif /* UART_BENCH_H_ */
@@ -0,0 +1,169 @@
+/***********************************************************************************************************************
+ * File Name    : uart_cut_through.c
+ * Description  : Contains the cut-through forwarding from the PC channel to the talk board channel.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "uart_cut_through.h"
+#include "uart_ep.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_cut_through
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private function declarations
+ */
+static void uart_cut_through_abort(uart_cut_through_t * p_cut);
+static bool uart_cut_through_abort_flush(uart_cut_through_t * p_cut);
+
+/*****************************************************************************************************************
+ *  @brief       Initialize cut-through forwarding from a receive ring
+ *  @param[in]   p_cut     Forwarding state to initialize
+ *  @param[in]   p_ring    Receive ring of the PC channel
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_cut_through_init(uart_cut_through_t * p_cut, uart_rx_ring_t * p_ring)
+{
+    p_cut->p_ring        = p_ring;
+    p_cut->line_length   = RESET_VALUE;
+    p_cut->overflow_seen = p_ring->overflow_count;
+    p_cut->error         = false;
+    p_cut->discard       = false;
+    p_cut->abort_pending = false;
+    p_cut->line_count    = RESET_VALUE;
+    p_cut->abort_count   = RESET_VALUE;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Mark the line being received as invalid. Call from the UART callback on receive errors.
+ *  @param[in]   p_cut     Forwarding state
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_cut_through_error(uart_cut_through_t * p_cut)
+{
+    p_cut->error = true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Forward every byte received since the last call to the talk board. Call from the main loop.
+ *               Stops early when the talk board transmit queue is full and continues on the next call.
+ *  @param[in]   p_cut     Forwarding state
+ *  @retval      Number of lines completed during this call
+ ****************************************************************************************************************/
+uint32_t uart_cut_through_poll(uart_cut_through_t * p_cut)
+{
+    uint32_t        lines  = RESET_VALUE;
+    uint32_t        length = RESET_VALUE;
+    uint8_t const * p_data = NULL;
+
+    /* A receive error or dropped bytes invalidate the line currently being forwarded */
+    uint32_t overflow = p_cut->p_ring->overflow_count;
+    if (p_cut->error || (overflow != p_cut->overflow_seen))
+    {
+        p_cut->error         = false;
+        p_cut->overflow_seen = overflow;
+        uart_cut_through_abort(p_cut);
+    }
+
+    if (!uart_cut_through_abort_flush(p_cut))
+    {
+        return lines;
+    }
+
+    while ((length = uart_rx_ring_peek(p_cut->p_ring, &p_data)) > RESET_VALUE)
+    {
+        /* An abort raised in this loop must reach the board before any byte of the next line */
+        if (!uart_cut_through_abort_flush(p_cut))
+        {
+            break;
+        }
+
+        /* Handle at most one line per step */
+        uint8_t const * p_end    = memchr(p_data, p_cut->p_ring->delimiter, length);
+        bool            line_end = (NULL != p_end);
+        uint32_t        step     = line_end ? ((uint32_t) (p_end - p_data) + 1u) : length;
+        uint32_t        payload  = line_end ? (step - 1u) : step;
+
+        if (p_cut->discard)
+        {
+            /* Dropped up to the delimiter */
+        }
+        else if (line_end && (RESET_VALUE == payload) && (RESET_VALUE == p_cut->line_length))
+        {
+            /* Empty line, nothing to forward */
+        }
+        else if ((p_cut->line_length + payload) > UART_CUT_MAX_LINE)
+        {
+            /* Too long for the talk board, the step is dropped by the discard branch on the next iteration */
+            uart_cut_through_abort(p_cut);
+            continue;
+        }
+        else
+        {
+            if (FSP_SUCCESS != uart_print_user_data(p_data, step))
+            {
+                /* Queue full, keep the bytes in the ring and retry on the next call */
+                break;
+            }
+            p_cut->line_length += step;
+
+            if (line_end)
+            {
+                p_cut->line_count++;
+                lines++;
+            }
+        }
+
+        if (line_end)
+        {
+            p_cut->line_length = RESET_VALUE;
+            p_cut->discard     = false;
+        }
+        uart_rx_ring_consume(p_cut->p_ring, step);
+    }
+
+    return lines;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Drop the rest of the current line and cancel it on the board if part of it was already sent
+ *  @param[in]   p_cut     Forwarding state
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_cut_through_abort(uart_cut_through_t * p_cut)
+{
+    if (RESET_VALUE != p_cut->line_length)
+    {
+        p_cut->abort_pending = true;
+        p_cut->abort_count++;
+    }
+
+    p_cut->line_length = RESET_VALUE;
+    p_cut->discard     = true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Queue a pending abort sequence
+ *  @param[in]   p_cut     Forwarding state
+ *  @retval      true when no abort is pending any more
+ ****************************************************************************************************************/
+static bool uart_cut_through_abort_flush(uart_cut_through_t * p_cut)
+{
+    if (p_cut->abort_pending)
+    {
+        if (FSP_SUCCESS != uart_print_user_data((uint8_t const *) UART_CUT_ABORT_SEQUENCE,
+                                                sizeof(UART_CUT_ABORT_SEQUENCE) - 1u))
+        {
+            return false;
+        }
+        p_cut->abort_pending = false;
+    }
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_cut_through)
+ **********************************************************************************************************************/
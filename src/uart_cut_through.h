@@ -0,0 +1,38 @@
+/***********************************************************************************************************************
+ * File Name    : uart_cut_through.h
+ * Description  : Contains data structures and function declarations of uart_cut_through.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_CUT_THROUGH_H_
+#define UART_CUT_THROUGH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bsp_api.h"
+#include "uart_rx_ring.h"
+
+/* Macro definition */
+#define UART_CUT_MAX_LINE         (255u)    /* Longest line forwarded, delimiter excluded */
+#define UART_CUT_ABORT_SEQUENCE   "\x1B\r"  /* ESC is not valid in a phrase, so the board rejects the partial line */
+
+/* Cut-through forwarding state. Bytes are forwarded as soon as they are in the receive ring instead of once the
+ * whole line has arrived. A line found invalid after forwarding started is cancelled with UART_CUT_ABORT_SEQUENCE
+ * and the rest of it is dropped up to the delimiter. */
+typedef struct st_uart_cut_through
+{
+    uart_rx_ring_t  * p_ring;               /* Receive ring the bytes are taken from */
+    uint32_t          line_length;          /* Bytes of the current line already forwarded */
+    uint32_t          overflow_seen;        /* Ring overflow count at the last check */
+    volatile bool     error;                /* Receive error reported by the UART callback */
+    bool              discard;              /* Current line was aborted, drop bytes up to the delimiter */
+    bool              abort_pending;        /* Abort sequence still has to be queued */
+    uint32_t          line_count;           /* Lines forwarded completely */
+    uint32_t          abort_count;          /* Lines cancelled after forwarding started */
+} uart_cut_through_t;
+
+/* Function declaration */
+void uart_cut_through_init(uart_cut_through_t * p_cut, uart_rx_ring_t * p_ring);
+void uart_cut_through_error(uart_cut_through_t * p_cut);
+uint32_t uart_cut_through_poll(uart_cut_through_t * p_cut);
+
+#endif /* UART_CUT_THROUGH_H_ */
@@ -1,6 +1,6 @@
 /***********************************************************************************************************************
- * File Name    : uart.c
- * Description  : Contains UART functions definition.
+ * File Name    : uart_ep.c
+ * Description  : Contains the talk board (SCI0) channel: transmit queue, reply ring, ready prompt and autobaud.
  **********************************************************************************************************************/
 /***********************************************************************************************************************
 * Copyright (c) 2020 - 2024 Renesas Electronics Corporation and/or its affiliates
@@ -13,6 +13,13 @@
 #include "uart_ep.h"
 #include "uart_pc.h"
 #include "timer_pwm.h"
+#include "uart_tx_queue.h"
+#include "uart_rx_ring.h"
+#include "uart_autobaud.h"
+#include "bridge_event.h"
+#include "perf_region.h"
+#include "line_latency.h"
+#include "speech_queue.h"
 
 /*******************************************************************************************************************//**
  * @addtogroup r_sci_uart_ep
@@ -22,55 +29,45 @@
 /*
  * Private function declarations
  */
+#if LINE_LATENCY_ENABLED || UART_PC_SPEECH_QUEUE
+static void uart_ep_tx_start(void * p_context);
+#endif
 
 /*
  * Private global variables
  */
-/* Temporary buffer to save data from receive buffer for further processing */
-static uint8_t g_temp_buffer[DATA_LENGTH] = {RESET_VALUE};
+/* Buffer the talk board replies are taken out into */
+static uint8_t g_line_buffer[MAX_DATA_LENGTH + 1u] = {RESET_VALUE};
+
+/* Receive ring filled by the RX ISR, drained line by line by uart_ep_poll() */
+static uart_rx_ring_t g_uart0_rx_ring;
 
-/* Counter to update g_temp_buffer index */
-static volatile uint8_t g_counter_var = RESET_VALUE;
+/* Ready prompts received from the talk board, read by the utterance queue */
+static volatile uint32_t g_uart0_ready_count = RESET_VALUE;
 
-/* Flag to check whether data is received or not */
-static volatile uint8_t g_data_received_flag = false;
+/* Transmit queue towards the talk board */
+static uart_tx_queue_t g_uart0_tx_queue;
 
-/* Flag for user callback */
-static volatile uint8_t g_uart_event = RESET_VALUE;
+#if UART_EP_AUTOBAUD
+/* Rate detection of the talk board channel, fed by the g_timer_autobaud capture interrupt */
+static uart_autobaud_t g_uart0_autobaud;
+#endif
 
 /*****************************************************************************************************************
- *  @brief       UART Example project to demonstrate the functionality
+ *  @brief       Discard the reply lines the talk board sent. The bridge acts on its ready prompt only, which the
+ *               callback counts, so the lines are taken out to keep the ring from filling. Call from the main loop.
  *  @param[in]   None
- *  @retval      FSP_SUCCESS     Upon success
- *  @retval      Any Other Error code apart from FSP_SUCCESS
+ *  @retval      None
  ****************************************************************************************************************/
-fsp_err_t uart_ep_voice(void)
+void uart_ep_poll(void)
 {
-    fsp_err_t err = FSP_SUCCESS;
+    uint32_t line_count = uart_rx_ring_lines_available(&g_uart0_rx_ring);
 
-    while (true)
+    while (line_count--)
     {
-        if(g_data_received_flag)
-        {
-            g_data_received_flag  = false;
-            uint8_t input_length = RESET_VALUE;
-
-            /* Calculate g_temp_buffer length */
-            input_length = ((uint8_t)(strlen((char *) &g_temp_buffer)));
+        uint32_t input_length = RESET_VALUE;
 
-            /* Check if input data length is in limit */
-            if (((uint8_t)input_length > 0) && (g_temp_buffer[0] == CARRIAGE_ASCII))
-            {
-                err = uart_print_user_msg(g_temp_buffer);// reply
-                if (FSP_SUCCESS != err)
-                {
-                    APP_PRINT ("\r\n ** UART0 FAILED *uart0_print_user_msg* \r\n");
-                    timer_gpt_deinit();
-                    deinit_pc_uart();
-                    APP_ERR_TRAP(err);
-                }
-            }
-        } 
+        (void) uart_rx_ring_line_get(&g_uart0_rx_ring, g_line_buffer, sizeof(g_line_buffer), &input_length);
     }
 }
 
@@ -84,6 +81,9 @@ fsp_err_t uart_initialize(void)
 {
     fsp_err_t err = FSP_SUCCESS;
 
+    /* Receive ring must be ready before the first RX interrupt */
+    uart_rx_ring_init(&g_uart0_rx_ring, CARRIAGE_ASCII);
+
     /* Initialize UART channel with baud rate 115200 */
 #if defined (BOARD_RA6T2_MCK) || defined (BOARD_RA8M1_EK)
     err = R_SCI_B_UART_Open (&g_uart0_ctrl, &g_uart0_cfg);
@@ -93,58 +93,197 @@ fsp_err_t uart_initialize(void)
     if (FSP_SUCCESS != err)
     {
         APP_ERR_PRINT ("\r\n**  R_SCI_UART_Open API failed  **\r\n");
+        return err;
     }
+
+    /* Transmission is driven by the TX interrupts from here on */
+    err = uart_tx_queue_init(&g_uart0_tx_queue, &g_uart0_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        return err;
+    }
+#if LINE_LATENCY_ENABLED || UART_PC_SPEECH_QUEUE
+    /* The start of a PC line on the wire is one of its timed stages, and ends the urgent phrase latency */
+    uart_tx_queue_start_callback_set(&g_uart0_tx_queue, uart_ep_tx_start);
+#endif
+
+#if SCI_B_UART_CFG_RX_BLOCK_ENABLE
+    /* One callback per receive FIFO drain. The driver flags blocks holding the ready prompt. */
+    err = R_SCI_B_UART_RxBlockSet(&g_uart0_ctrl, true, UART_EP_READY_PROMPT);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n**  R_SCI_B_UART_RxBlockSet API failed  **\r\n");
+        return err;
+    }
+#endif
+
+#if UART_EP_AUTOBAUD
+    /* The talk board may not run at the configured rate, measure it on its first reply */
+    err = uart_autobaud_open(&g_uart0_autobaud, &g_timer_autobaud, &g_uart0_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        return err;
+    }
+    err = uart_ep_autobaud_start();
+#endif
     return err;
 }
 
 /*****************************************************************************************************************
- *  @brief       print user message to terminal
+ *  @brief       Queue user message for the talk board. Returns without waiting for the transmission.
  *  @param[in]   p_msg
- *  @retval      FSP_SUCCESS                Upon success
- *  @retval      FSP_ERR_TRANSFER_ABORTED   Upon event failure
+ *  @retval      FSP_SUCCESS                 Upon success
+ *  @retval      FSP_ERR_INSUFFICIENT_SPACE  Transmit queue is full
  *  @retval      Any Other Error code apart from FSP_SUCCESS,  Unsuccessful write operation
  ****************************************************************************************************************/
 fsp_err_t uart_print_user_msg(uint8_t *p_msg)
 {
     fsp_err_t err   = FSP_SUCCESS;
-    uint8_t msg_len = RESET_VALUE;
-    uint32_t local_timeout = (DATA_LENGTH * UINT16_MAX);
-    uint8_t *p_temp_ptr = (uint8_t *)p_msg;
+    uint32_t msg_len = RESET_VALUE;
 
     /* Calculate length of message received */
-    msg_len = ((uint8_t)(strlen((char *)p_temp_ptr)));
+    msg_len = ((uint32_t)(strlen((char *)p_msg)));
 
-    /* Reset callback capture variable */
-    g_uart_event = RESET_VALUE;
+    /* Writing to terminal, TX complete interrupt advances the queue */
+    err = uart_tx_queue_send(&g_uart0_tx_queue, p_msg, msg_len);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n**  UART0 transmit queue rejected message  **\r\n");
+    }
+    return err;
+}
 
-    /* Writing to terminal */
-#if defined (BOARD_RA6T2_MCK) || defined (BOARD_RA8M1_EK)
-    err = R_SCI_B_UART_Write (&g_uart0_ctrl, p_msg, msg_len);
-#else
-    err = R_SCI_UART_Write (&g_uart0_ctrl, p_msg, msg_len);
-#endif
+/*****************************************************************************************************************
+ *  @brief       Queue bytes of known length for the talk board. A full queue is reported without a print, so callers
+ *               can retry on the next pass.
+ *  @param[in]   p_data     Bytes to send
+ *  @param[in]   length     Number of bytes
+ *  @retval      FSP_SUCCESS                 Upon success
+ *  @retval      FSP_ERR_INSUFFICIENT_SPACE  Transmit queue is full
+ *  @retval      Any Other Error code apart from FSP_SUCCESS,  Unsuccessful write operation
+ ****************************************************************************************************************/
+fsp_err_t uart_print_user_data(uint8_t const *p_data, uint32_t length)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    err = uart_tx_queue_send(&g_uart0_tx_queue, p_data, length);
+    if ((FSP_SUCCESS != err) && (FSP_ERR_INSUFFICIENT_SPACE != err))
+    {
+        APP_ERR_PRINT ("\r\n**  UART0 transmit queue rejected data  **\r\n");
+    }
+    return err;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Queue a line for the talk board without copying it. The line stays owned by the queue until
+ *               p_release is called from the TX complete interrupt.
+ *  @param[in]   p_line       Line bytes
+ *  @param[in]   length       Line length
+ *  @param[in]   p_release    Called when the line buffer is free again
+ *  @param[in]   p_context    Argument passed to p_release
+ *  @retval      FSP_SUCCESS                 Upon success, p_release will be called
+ *  @retval      FSP_ERR_INSUFFICIENT_SPACE  Transmit queue is full, the caller keeps the line
+ *  @retval      Any Other Error code apart from FSP_SUCCESS,  Unsuccessful write operation
+ ****************************************************************************************************************/
+fsp_err_t uart_print_user_line(uint8_t const *p_line, uint32_t length, uart_tx_release_t p_release, void *p_context)
+{
+    fsp_err_t err = FSP_SUCCESS;
 
+    /* Descriptor points at the caller's buffer, TX complete interrupt hands it back */
+    err = uart_tx_queue_send_ref(&g_uart0_tx_queue, p_line, length, p_release, p_context);
     if (FSP_SUCCESS != err)
     {
-        APP_ERR_PRINT ("\r\n**  R_SCI_UART_Write API Failed  **\r\n");
-        return err;
+        APP_ERR_PRINT ("\r\n**  UART0 transmit queue rejected line  **\r\n");
     }
+    return err;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Stop the transmission towards the talk board and discard everything queued for it
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_abort_user_msg(void)
+{
+    uart_tx_queue_abort(&g_uart0_tx_queue);
+}
 
-    /* Check for event transfer complete */
-    while ((UART_EVENT_TX_COMPLETE != g_uart_event) && (--local_timeout))
+/*****************************************************************************************************************
+ *  @brief       Measure the talk board rate. A wake-up carriage return makes the board answer with its prompt,
+ *               the edges of that answer are timed and SCI0 is switched to the measured rate.
+ *  @param[in]   None
+ *  @retval      FSP_SUCCESS     Upon success, uart_ep_autobaud_poll() finishes the measurement
+ *  @retval      Any Other Error code apart from FSP_SUCCESS
+ ****************************************************************************************************************/
+fsp_err_t uart_ep_autobaud_start(void)
+{
+#if UART_EP_AUTOBAUD
+    fsp_err_t err = uart_autobaud_start(&g_uart0_autobaud);
+    if (FSP_SUCCESS != err)
     {
-        /* Check if any error event occurred */
-        if (UART_ERROR_EVENTS == g_uart_event)
-        {
-            APP_ERR_PRINT ("\r\n**  UART Error Event Received  **\r\n");
-            return FSP_ERR_TRANSFER_ABORTED;
-        }
+        return err;
     }
-    if(RESET_VALUE == local_timeout)
+
+    /* The board answers at its own rate, whatever rate this carriage return reaches it at */
+    return uart_print_user_msg((uint8_t *) "\r");
+#else
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*****************************************************************************************************************
+ *  @brief       Finish a running rate measurement. Call from the main loop.
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_ep_autobaud_poll(void)
+{
+#if UART_EP_AUTOBAUD
+    if (uart_autobaud_poll(&g_uart0_autobaud))
     {
-        err = FSP_ERR_TIMEOUT;
+        /* Whatever arrived during the measurement was framed at the old rate */
+        uart_rx_ring_init(&g_uart0_rx_ring, CARRIAGE_ASCII);
+        uart_ep_autobaud_report();
     }
-    return err;
+#endif
+}
+
+/*****************************************************************************************************************
+ *  @brief       Tell whether a rate measurement is running. Talk board bytes, prompts included, are dropped
+ *               meanwhile, so nothing that expects an answer should be sent.
+ *  @param[in]   None
+ *  @retval      true while measuring
+ ****************************************************************************************************************/
+bool uart_ep_autobaud_busy(void)
+{
+#if UART_EP_AUTOBAUD
+    return uart_autobaud_busy(&g_uart0_autobaud);
+#else
+    return false;
+#endif
+}
+
+/*****************************************************************************************************************
+ *  @brief       Print the result of the last rate measurement to the RTT viewer
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_ep_autobaud_report(void)
+{
+#if UART_EP_AUTOBAUD
+    APP_REPLY("\r\nTalk board %d bps (measured %d), detections %d, failures %d\r\n", g_uart0_autobaud.rate,
+              g_uart0_autobaud.measured, g_uart0_autobaud.done_count, g_uart0_autobaud.fail_count);
+#endif
+}
+
+/*****************************************************************************************************************
+ *  @brief       Number of ready prompts received from the talk board since start up
+ *  @param[in]   None
+ *  @retval      Prompt count, compare with a previous value to detect new prompts
+ ****************************************************************************************************************/
+uint32_t uart_ep_ready_count(void)
+{
+    return g_uart0_ready_count;
 }
 
 /*******************************************************************************************************************//**
@@ -169,6 +308,24 @@ void deinit_uart(void)
     }
 }
 
+#if LINE_LATENCY_ENABLED || UART_PC_SPEECH_QUEUE
+/*****************************************************************************************************************
+ *  @brief      A message started on SCI0. Transmit queue start callback, runs in interrupt context or with
+ *              interrupts masked.
+ *  @param[in]  p_context    Context of the message, the line slot for PC lines
+ *  @retval     None
+ ****************************************************************************************************************/
+static void uart_ep_tx_start(void * p_context)
+{
+ #if LINE_LATENCY_ENABLED
+    line_latency_tx_start(p_context);
+ #endif
+ #if UART_PC_SPEECH_QUEUE
+    speech_queue_tx_start(p_context);
+ #endif
+}
+#endif
+
 /*****************************************************************************************************************
  *  @brief      UART user callback
  *  @param[in]  p_args
@@ -176,34 +333,90 @@ void deinit_uart(void)
  ****************************************************************************************************************/
 void user_uart_callback(uart_callback_args_t *p_args)
 {
-    /* Logged the event in global variable */
-    g_uart_event = (uint8_t)p_args->event;
+    PERF_REGION_BEGIN(PERF_REGION_EP_CALLBACK);
+
+#if LINE_LATENCY_ENABLED
+    /* Before the queue starts the next message, the completion is still that of the timed line */
+    if (UART_EVENT_TX_COMPLETE == p_args->event)
+    {
+        line_latency_tx_complete();
+    }
+#endif
 
-    /* Reset g_temp_buffer index if it exceeds than buffer size */
-    if(DATA_LENGTH == g_counter_var)
+    /* Start the next queued message once the previous one is on the wire */
+    uart_tx_queue_event(&g_uart0_tx_queue, p_args->event);
+    if (UART_EVENT_TX_COMPLETE == p_args->event)
     {
-        g_counter_var = RESET_VALUE;
+        /* A line slot may have come back */
+        bridge_event_set(BRIDGE_EVENT_EP);
     }
 
-    if(UART_EVENT_RX_CHAR == p_args->event)
+#if UART_EP_AUTOBAUD
+    /* Bytes sampled at a rate about to be replaced, neither a line nor a prompt */
+    if (uart_autobaud_busy(&g_uart0_autobaud))
     {
-        switch (p_args->data)
+        PERF_REGION_END(PERF_REGION_EP_CALLBACK);
+        return;
+    }
+#endif
+
+    /* Only store the bytes here, the lines are taken out by uart_ep_poll() */
+    if (UART_EVENT_RX_BLOCK == p_args->event)
+    {
+        uart_rx_ring_write(&g_uart0_rx_ring, p_args->p_data, p_args->length);
+
+        /* The driver looks for the prompt, so blocks without one are not scanned again. Prompts while a message is
+         * being sent are not counted, see below. */
+        if (p_args->delimiter_found && uart_tx_queue_idle(&g_uart0_tx_queue))
         {
-            /* If Enter is pressed by user, set flag to process the data */
-            case CARRIAGE_ASCII:
-            {
-                g_counter_var = RESET_VALUE;
-                g_data_received_flag  = true;
-                break;
-            }
-            /* Read all data provided by user until enter button is pressed */
-            default:
+            uint8_t const * p_scan = p_args->p_data;
+            uint8_t const * p_end  = p_args->p_data + p_args->length;
+
+            while ((p_scan < p_end) &&
+                   (NULL != (p_scan = memchr(p_scan, UART_EP_READY_PROMPT, (size_t) (p_end - p_scan)))))
             {
-                g_temp_buffer[g_counter_var++] = (uint8_t ) p_args->data;
-                break;
+                p_scan++;
+                g_uart0_ready_count++;
             }
+#if LINE_LATENCY_ENABLED
+            line_latency_reply();
+#endif
+            bridge_event_set(BRIDGE_EVENT_EP);
         }
     }
+    else if(UART_EVENT_RX_CHAR == p_args->event)
+    {
+        uart_rx_ring_put(&g_uart0_rx_ring, (uint8_t) p_args->data);
+
+        /* The prompt is not followed by a carriage return, so it is caught here rather than as a line. While a
+         * message is still being sent a '>' is a leftover from before it, or noise: the board cannot answer a
+         * phrase it has not fully received. */
+        if ((UART_EP_READY_PROMPT == p_args->data) && uart_tx_queue_idle(&g_uart0_tx_queue))
+        {
+            g_uart0_ready_count++;
+#if LINE_LATENCY_ENABLED
+            line_latency_reply();
+#endif
+            bridge_event_set(BRIDGE_EVENT_EP);
+        }
+    }
+
+    PERF_REGION_END(PERF_REGION_EP_CALLBACK);
+}
+
+/*****************************************************************************************************************
+ *  @brief      Autobaud capture timer callback. Referenced by hal_data.c, so it exists in every configuration.
+ *  @param[in]  p_args
+ *  @retval     None
+ ****************************************************************************************************************/
+void uart_autobaud_callback(timer_callback_args_t *p_args)
+{
+#if UART_EP_AUTOBAUD
+    uart_autobaud_capture(&g_uart0_autobaud, p_args);
+    bridge_event_set(BRIDGE_EVENT_EP);
+#else
+    FSP_PARAMETER_NOT_USED(p_args);
+#endif
 }
 
 /*******************************************************************************************************************//**
@@ -11,19 +11,34 @@
 #ifndef UART_EP_H_
 #define UART_EP_H_
 
+#include "uart_tx_queue.h"
+
 /* Macro definition */
 #define CARRIAGE_ASCII            (13u)     /* Carriage return */
 #define ZERO_ASCII                (48u)     /* ASCII value of zero */
 #define NINE_ASCII                (57u)     /* ASCII value for nine */
 #define DATA_LENGTH               (4u)      /* Expected Input Data length */
 #define MAX_DATA_LENGTH           (255u)    /* Max Input Data length */
+#define UART_EP_READY_PROMPT      ('>')     /* Talk board prompt, sent when it can accept the next phrase */
+#define UART_EP_AUTOBAUD          (0)       /* 1: measure the talk board rate at start up, see uart_autobaud.h.
+                                             *    GTIOC4A is routed to P205, which must be wired to the talk board
+                                             *    TX line, the RXD0 pin. Talk board bytes received during a
+                                             *    measurement are dropped. */
 #define UART_ERROR_EVENTS         (UART_EVENT_BREAK_DETECT | UART_EVENT_ERR_OVERFLOW | UART_EVENT_ERR_FRAMING | \
                                     UART_EVENT_ERR_PARITY)    /* UART Error event bits mapped in registers */
 
 /* Function declaration */
-fsp_err_t uart_ep_voice(void);
+void uart_ep_poll(void);
 fsp_err_t uart_print_user_msg(uint8_t *p_msg);
+fsp_err_t uart_print_user_data(uint8_t const *p_data, uint32_t length);
+fsp_err_t uart_print_user_line(uint8_t const *p_line, uint32_t length, uart_tx_release_t p_release, void *p_context);
 fsp_err_t uart_initialize(void);
+uint32_t uart_ep_ready_count(void);
+void uart_abort_user_msg(void);
+fsp_err_t uart_ep_autobaud_start(void);
+void uart_ep_autobaud_poll(void);
+void uart_ep_autobaud_report(void);
+bool uart_ep_autobaud_busy(void);
 void deinit_uart(void);
 
 #ifndef user_uart_callback
@@ -0,0 +1,359 @@
+/***********************************************************************************************************************
+ * File Name    : uart_frame.c
+ * Description  : Contains the framed protocol of the PC link: frame decoder, encoder and acknowledgement window.
+ **********************************************************************************************************************/
+
+#include <string.h>
+#include "uart_frame.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_frame
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#ifndef RESET_VALUE
+#define RESET_VALUE               (0x00)    /* common_utils.h is not included so the file also builds on the PC */
+#endif
+#define UART_FRAME_CRC_INIT       (0xFFFFu)
+#define UART_FRAME_SEQ_MASK       (0xFFu)
+
+/* CRC-16/CCITT-FALSE (polynomial 0x1021) for one nibble */
+static const uint16_t g_uart_frame_crc_table[16] =
+{
+    0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+    0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu
+};
+
+/*****************************************************************************************************************
+ *  @brief       Initialize a frame decoder. A payload buffer must be set before a frame with payload arrives.
+ *  @param[in]   p_dec    Decoder to initialize
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_frame_decoder_init(uart_frame_decoder_t * p_dec)
+{
+    p_dec->state              = UART_FRAME_STATE_SYNC;
+    p_dec->p_payload          = NULL;
+    p_dec->payload_size       = RESET_VALUE;
+    p_dec->frame_count        = RESET_VALUE;
+    p_dec->crc_error_count    = RESET_VALUE;
+    p_dec->length_error_count = RESET_VALUE;
+    p_dec->skip_count         = RESET_VALUE;
+    p_dec->timeout_count      = RESET_VALUE;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Set where the payload of the next frame goes. Call between frames only, that is after
+ *               initialization or after uart_frame_decode() returned something else than UART_FRAME_STATUS_MORE.
+ *  @param[in]   p_dec           Frame decoder
+ *  @param[in]   p_payload       Payload buffer, NULL to accept frames without payload only
+ *  @param[in]   payload_size    Size of p_payload in bytes
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_frame_decoder_buffer_set(uart_frame_decoder_t * p_dec, uint8_t * p_payload, uint32_t payload_size)
+{
+    p_dec->p_payload    = p_payload;
+    p_dec->payload_size = (NULL == p_payload) ? RESET_VALUE : payload_size;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Run received bytes through the decoder. Stops right after a frame ends so the caller can take the
+ *               payload out before the next frame overwrites it.
+ *  @param[in]   p_dec     Frame decoder
+ *  @param[in]   p_data    Received bytes
+ *  @param[in]   length    Number of bytes
+ *  @param[out]  p_used    Number of bytes consumed
+ *  @retval      UART_FRAME_STATUS_MORE     Every byte consumed, frame not complete yet
+ *  @retval      UART_FRAME_STATUS_FRAME    Frame complete and valid, payload is in the buffer
+ *  @retval      UART_FRAME_STATUS_ERROR    Frame dropped, the decoder looks for the next sync byte
+ ****************************************************************************************************************/
+uart_frame_status_t uart_frame_decode(uart_frame_decoder_t * p_dec, uint8_t const * p_data, uint32_t length,
+                                      uint32_t * p_used)
+{
+    uart_frame_status_t status = UART_FRAME_STATUS_MORE;
+    uint32_t            i      = RESET_VALUE;
+
+    while ((i < length) && (UART_FRAME_STATUS_MORE == status))
+    {
+        uint8_t data = p_data[i];
+
+        switch (p_dec->state)
+        {
+            case UART_FRAME_STATE_SYNC:
+                if (UART_FRAME_SYNC == data)
+                {
+                    p_dec->crc   = UART_FRAME_CRC_INIT;
+                    p_dec->state = UART_FRAME_STATE_TYPE;
+                }
+                else
+                {
+                    p_dec->skip_count++;
+                }
+                i++;
+                break;
+
+            case UART_FRAME_STATE_TYPE:
+                p_dec->type  = data;
+                p_dec->crc   = uart_frame_crc(p_dec->crc, &data, 1u);
+                p_dec->state = UART_FRAME_STATE_SEQ;
+                i++;
+                break;
+
+            case UART_FRAME_STATE_SEQ:
+                p_dec->seq   = data;
+                p_dec->crc   = uart_frame_crc(p_dec->crc, &data, 1u);
+                p_dec->state = UART_FRAME_STATE_LENGTH;
+                i++;
+                break;
+
+            case UART_FRAME_STATE_LENGTH:
+                p_dec->length = data;
+                p_dec->index  = RESET_VALUE;
+                p_dec->crc    = uart_frame_crc(p_dec->crc, &data, 1u);
+                i++;
+
+                if (p_dec->length > p_dec->payload_size)
+                {
+                    /* Either a corrupted length or a false sync byte, look for the next sync byte */
+                    p_dec->length_error_count++;
+                    p_dec->state = UART_FRAME_STATE_SYNC;
+                    status       = UART_FRAME_STATUS_ERROR;
+                }
+                else
+                {
+                    p_dec->state = (RESET_VALUE == p_dec->length) ? UART_FRAME_STATE_CRC_LOW :
+                                                                    UART_FRAME_STATE_PAYLOAD;
+                }
+                break;
+
+            case UART_FRAME_STATE_PAYLOAD:
+            {
+                /* Take as much of the payload as is available in one go */
+                uint32_t chunk = p_dec->length - p_dec->index;
+                if (chunk > (length - i))
+                {
+                    chunk = length - i;
+                }
+
+                memcpy(&p_dec->p_payload[p_dec->index], &p_data[i], chunk);
+                p_dec->crc    = uart_frame_crc(p_dec->crc, &p_data[i], chunk);
+                p_dec->index += chunk;
+                i            += chunk;
+
+                if (p_dec->index == p_dec->length)
+                {
+                    p_dec->state = UART_FRAME_STATE_CRC_LOW;
+                }
+                break;
+            }
+
+            case UART_FRAME_STATE_CRC_LOW:
+                p_dec->crc_received = data;
+                p_dec->state        = UART_FRAME_STATE_CRC_HIGH;
+                i++;
+                break;
+
+            case UART_FRAME_STATE_CRC_HIGH:
+            default:
+                p_dec->crc_received |= (uint16_t) (data << 8);
+                p_dec->state         = UART_FRAME_STATE_SYNC;
+                i++;
+
+                if (p_dec->crc_received == p_dec->crc)
+                {
+                    p_dec->frame_count++;
+                    status = UART_FRAME_STATUS_FRAME;
+                }
+                else
+                {
+                    p_dec->crc_error_count++;
+                    status = UART_FRAME_STATUS_ERROR;
+                }
+                break;
+        }
+    }
+
+    *p_used = i;
+    return status;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Report a receive gap of UART_FRAME_IDLE_MS. A partial frame is dropped, otherwise a lost byte
+ *               would make the decoder take the start of the next frame as the rest of this one. The payload
+ *               buffer stays set.
+ *  @param[in]   p_dec    Frame decoder
+ *  @retval      true when a partial frame was dropped
+ ****************************************************************************************************************/
+bool uart_frame_decoder_idle(uart_frame_decoder_t * p_dec)
+{
+    if (UART_FRAME_STATE_SYNC == p_dec->state)
+    {
+        return false;
+    }
+
+    p_dec->state = UART_FRAME_STATE_SYNC;
+    p_dec->timeout_count++;
+
+    return true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Build a frame
+ *  @param[in]   type         Frame type
+ *  @param[in]   seq          Sequence number
+ *  @param[in]   p_payload    Payload bytes, may be NULL when length is 0
+ *  @param[in]   length       Payload length, UART_FRAME_MAX_PAYLOAD at most
+ *  @param[out]  p_out        Frame buffer of at least UART_FRAME_HEADER_SIZE + length + UART_FRAME_CRC_SIZE bytes
+ *  @retval      Frame length in bytes, 0 when the payload is too long
+ ****************************************************************************************************************/
+uint32_t uart_frame_encode(uint8_t type, uint8_t seq, uint8_t const * p_payload, uint32_t length, uint8_t * p_out)
+{
+    if (length > UART_FRAME_MAX_PAYLOAD)
+    {
+        return RESET_VALUE;
+    }
+
+    p_out[0] = UART_FRAME_SYNC;
+    p_out[1] = type;
+    p_out[2] = seq;
+    p_out[3] = (uint8_t) length;
+    if (RESET_VALUE != length)
+    {
+        memcpy(&p_out[UART_FRAME_HEADER_SIZE], p_payload, length);
+    }
+
+    /* The sync byte is not covered */
+    uint16_t crc = uart_frame_crc(UART_FRAME_CRC_INIT, &p_out[1], (UART_FRAME_HEADER_SIZE - 1u) + length);
+    p_out[UART_FRAME_HEADER_SIZE + length]      = (uint8_t) crc;
+    p_out[UART_FRAME_HEADER_SIZE + length + 1u] = (uint8_t) (crc >> 8);
+
+    return UART_FRAME_HEADER_SIZE + length + UART_FRAME_CRC_SIZE;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Continue a CRC-16/CCITT-FALSE over more bytes, a nibble at a time
+ *  @param[in]   crc       CRC so far, UART_FRAME_CRC_INIT (0xFFFF) to start
+ *  @param[in]   p_data    Bytes to add
+ *  @param[in]   length    Number of bytes
+ *  @retval      Updated CRC
+ ****************************************************************************************************************/
+uint16_t uart_frame_crc(uint16_t crc, uint8_t const * p_data, uint32_t length)
+{
+    for (uint32_t i = RESET_VALUE; i < length; i++)
+    {
+        crc = (uint16_t) ((crc << 4) ^ g_uart_frame_crc_table[(crc >> 12) ^ (p_data[i] >> 4)]);
+        crc = (uint16_t) ((crc << 4) ^ g_uart_frame_crc_table[(crc >> 12) ^ (p_data[i] & 0x0Fu)]);
+    }
+
+    return crc;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Initialize the receive side of the link. The first frame expected is number 0 unless the PC sends
+ *               a reset frame.
+ *  @param[in]   p_link    Link state to initialize
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_frame_link_init(uart_frame_link_t * p_link)
+{
+    p_link->expected           = RESET_VALUE;
+    p_link->ack_pending        = RESET_VALUE;
+    p_link->nak_pending        = false;
+    p_link->nak_sent           = false;
+    p_link->tx_seq             = RESET_VALUE;
+    p_link->duplicate_count    = RESET_VALUE;
+    p_link->out_of_order_count = RESET_VALUE;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Check the sequence number of a valid frame against the window
+ *  @param[in]   p_link    Link state
+ *  @param[in]   type      Frame type
+ *  @param[in]   seq       Frame sequence number
+ *  @retval      true when the frame is a new data frame whose payload must be delivered
+ ****************************************************************************************************************/
+bool uart_frame_link_receive(uart_frame_link_t * p_link, uint8_t type, uint8_t seq)
+{
+    uint8_t distance = (uint8_t) ((seq - p_link->expected) & UART_FRAME_SEQ_MASK);
+
+    if (UART_FRAME_TYPE_RESET == type)
+    {
+        /* Acknowledge at once so the PC can start sending */
+        p_link->expected    = (uint8_t) (seq + 1u);
+        p_link->ack_pending = UART_FRAME_ACK_BATCH;
+        p_link->nak_pending = false;
+        p_link->nak_sent    = false;
+        return false;
+    }
+
+    if (RESET_VALUE == distance)
+    {
+        p_link->expected++;
+        p_link->ack_pending++;
+        p_link->nak_sent = false;
+        return (UART_FRAME_TYPE_DATA == type);
+    }
+
+    if (distance >= (uint8_t) (UART_FRAME_SEQ_MASK + 1u - UART_FRAME_WINDOW))
+    {
+        /* Already delivered, the acknowledgement was lost. Acknowledge again at once. */
+        p_link->duplicate_count++;
+        p_link->ack_pending = UART_FRAME_ACK_BATCH;
+        return false;
+    }
+
+    /* A frame before this one was lost. Everything up to it is resent after the NAK. */
+    p_link->out_of_order_count++;
+    if (!p_link->nak_sent)
+    {
+        p_link->nak_pending = true;
+    }
+    return false;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Report a frame dropped by the decoder. The frame is requested again with a NAK.
+ *  @param[in]   p_link    Link state
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_frame_link_error(uart_frame_link_t * p_link)
+{
+    if (!p_link->nak_sent)
+    {
+        p_link->nak_pending = true;
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Build the acknowledgement frame that is due, if any. A lost reply is recovered by the PC
+ *               resending after its timeout, which is answered by an immediate acknowledgement.
+ *  @param[in]   p_link    Link state
+ *  @param[in]   flush     Acknowledge frames even when fewer than UART_FRAME_ACK_BATCH are waiting
+ *  @param[out]  p_out     Frame buffer of at least UART_FRAME_HEADER_SIZE + UART_FRAME_CRC_SIZE bytes
+ *  @retval      Frame length in bytes, 0 when nothing is due
+ ****************************************************************************************************************/
+uint32_t uart_frame_link_reply(uart_frame_link_t * p_link, bool flush, uint8_t * p_out)
+{
+    if (p_link->nak_pending)
+    {
+        /* A NAK also acknowledges everything before expected */
+        p_link->nak_pending = false;
+        p_link->nak_sent    = true;
+        p_link->ack_pending = RESET_VALUE;
+        return uart_frame_encode(UART_FRAME_TYPE_NAK, p_link->expected, NULL, RESET_VALUE, p_out);
+    }
+
+    if ((p_link->ack_pending >= UART_FRAME_ACK_BATCH) || (flush && (RESET_VALUE != p_link->ack_pending)))
+    {
+        p_link->ack_pending = RESET_VALUE;
+        return uart_frame_encode(UART_FRAME_TYPE_ACK, p_link->expected, NULL, RESET_VALUE, p_out);
+    }
+
+    return RESET_VALUE;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_frame)
+ **********************************************************************************************************************/
@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+ * File Name    : uart_frame.h
+ * Description  : Contains data structures and function declarations of uart_frame.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_FRAME_H_
+#define UART_FRAME_H_
+
+/* Only standard headers here, the framing code also builds on the PC for the host side and for fuzzing */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Macro definition */
+#define UART_FRAME_SYNC           (0xA5u)   /* First byte of every frame */
+#define UART_FRAME_HEADER_SIZE    (4u)      /* Sync, type, sequence number, payload length */
+#define UART_FRAME_CRC_SIZE       (2u)      /* CRC-16/CCITT-FALSE over type to last payload byte, low byte first */
+#define UART_FRAME_MAX_PAYLOAD    (255u)    /* Largest payload the length byte can carry */
+#define UART_FRAME_MAX_SIZE       (UART_FRAME_HEADER_SIZE + UART_FRAME_MAX_PAYLOAD + UART_FRAME_CRC_SIZE)
+#define UART_FRAME_WINDOW         (8u)      /* Frames the PC may send ahead of the last acknowledgement */
+#define UART_FRAME_ACK_BATCH      (4u)      /* Accepted frames acknowledged together at most */
+#define UART_FRAME_IDLE_MS        (50u)     /* A receive gap this long ends a partial frame. The PC sends a frame
+                                             * in one go, so a gap means the rest was lost. */
+
+/* Frame types. The PC sends the first two, the board answers with the others. */
+#define UART_FRAME_TYPE_DATA      (0x01u)   /* Phrase for the talk board, same text as an ASCII line without CR */
+#define UART_FRAME_TYPE_RESET     (0x02u)   /* Restart sequence numbering at the sequence number of this frame */
+#define UART_FRAME_TYPE_ACK       (0x81u)   /* Every frame before the sequence number was received */
+#define UART_FRAME_TYPE_NAK       (0x82u)   /* Resend starting at the sequence number */
+#define UART_FRAME_TYPE_EVENT     (0x83u)   /* Board message to the PC, numbered by the board */
+
+/* Result of feeding bytes to the decoder */
+typedef enum e_uart_frame_status
+{
+    UART_FRAME_STATUS_MORE = 0,             /* All bytes used, no frame completed */
+    UART_FRAME_STATUS_FRAME,                /* A frame passed the CRC check, see type, seq and length */
+    UART_FRAME_STATUS_ERROR,                /* A frame was dropped on a CRC or length error */
+} uart_frame_status_t;
+
+/* Decoder states, one per frame field */
+typedef enum e_uart_frame_state
+{
+    UART_FRAME_STATE_SYNC = 0,
+    UART_FRAME_STATE_TYPE,
+    UART_FRAME_STATE_SEQ,
+    UART_FRAME_STATE_LENGTH,
+    UART_FRAME_STATE_PAYLOAD,
+    UART_FRAME_STATE_CRC_LOW,
+    UART_FRAME_STATE_CRC_HIGH,
+} uart_frame_state_t;
+
+/* Byte-wise frame decoder. The payload goes straight to a buffer supplied by the caller, so a frame is never
+ * scanned twice. Bytes outside a frame are skipped until the next sync byte. */
+typedef struct st_uart_frame_decoder
+{
+    uart_frame_state_t state;               /* Field the next byte belongs to */
+    uint8_t            type;                /* Type of the frame being decoded */
+    uint8_t            seq;                 /* Sequence number of the frame being decoded */
+    uint32_t           length;              /* Payload length of the frame being decoded */
+    uint32_t           index;               /* Payload bytes stored so far */
+    uint16_t           crc;                 /* Running CRC */
+    uint16_t           crc_received;        /* Low byte of the received CRC */
+    uint8_t          * p_payload;           /* Destination of the payload */
+    uint32_t           payload_size;        /* Size of p_payload in bytes */
+    uint32_t           frame_count;         /* Frames passed */
+    uint32_t           crc_error_count;     /* Frames failing the CRC check */
+    uint32_t           length_error_count;  /* Frames longer than p_payload */
+    uint32_t           skip_count;          /* Bytes skipped while looking for a sync byte */
+    uint32_t           timeout_count;       /* Partial frames dropped after a receive gap */
+} uart_frame_decoder_t;
+
+/* Receive side of the link. Frames are accepted in sequence order only (go-back-N). Acknowledgements are
+ * cumulative and sent once per UART_FRAME_ACK_BATCH frames or when the caller flushes them. */
+typedef struct st_uart_frame_link
+{
+    uint8_t            expected;            /* Sequence number of the next frame to accept */
+    uint32_t           ack_pending;         /* Frames received since the last acknowledgement */
+    bool               nak_pending;         /* A NAK must be sent */
+    bool               nak_sent;            /* A NAK for expected is out, do not repeat it */
+    uint8_t            tx_seq;              /* Sequence number of the next event frame */
+    uint32_t           duplicate_count;     /* Frames received again after a lost acknowledgement */
+    uint32_t           out_of_order_count;  /* Frames received after a lost frame */
+} uart_frame_link_t;
+
+/* Function declaration */
+void uart_frame_decoder_init(uart_frame_decoder_t * p_dec);
+void uart_frame_decoder_buffer_set(uart_frame_decoder_t * p_dec, uint8_t * p_payload, uint32_t payload_size);
+uart_frame_status_t uart_frame_decode(uart_frame_decoder_t * p_dec, uint8_t const * p_data, uint32_t length,
+                                      uint32_t * p_used);
+bool uart_frame_decoder_idle(uart_frame_decoder_t * p_dec);
+uint32_t uart_frame_encode(uint8_t type, uint8_t seq, uint8_t const * p_payload, uint32_t length, uint8_t * p_out);
+uint16_t uart_frame_crc(uint16_t crc, uint8_t const * p_data, uint32_t length);
+void uart_frame_link_init(uart_frame_link_t * p_link);
+bool uart_frame_link_receive(uart_frame_link_t * p_link, uint8_t type, uint8_t seq);
+void uart_frame_link_error(uart_frame_link_t * p_link);
+uint32_t uart_frame_link_reply(uart_frame_link_t * p_link, bool flush, uint8_t * p_out);
+
+#endif /* UART_FRAME_H_ */
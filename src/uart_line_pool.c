@@ -0,0 +1,94 @@
+/***********************************************************************************************************************
+ * File Name    : uart_line_pool.c
+ * Description  : Contains the line slot pool used to hand received lines to a transmit queue without copying.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "uart_line_pool.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_line_pool
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define UART_LINE_POOL_MASK       (UART_LINE_POOL_DEPTH - 1u)
+
+/*****************************************************************************************************************
+ *  @brief       Initialize a line pool with every slot free
+ *  @param[in]   p_pool    Pool to initialize
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_line_pool_init(uart_line_pool_t * p_pool)
+{
+    for (uint32_t i = RESET_VALUE; i < UART_LINE_POOL_DEPTH; i++)
+    {
+        p_pool->slot[i].length = RESET_VALUE;
+        p_pool->slot[i].p_pool = p_pool;
+        p_pool->free[i]        = (uint8_t) i;
+    }
+
+    p_pool->free_head       = UART_LINE_POOL_DEPTH;
+    p_pool->free_tail       = RESET_VALUE;
+    p_pool->exhausted_count = RESET_VALUE;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Take a free slot. Call from the main loop only.
+ *  @param[in]   p_pool    Line pool
+ *  @retval      Free slot, or NULL when every slot is still queued for transmission
+ ****************************************************************************************************************/
+uart_line_slot_t * uart_line_pool_acquire(uart_line_pool_t * p_pool)
+{
+    uint32_t free_tail = p_pool->free_tail;
+
+    if (p_pool->free_head == free_tail)
+    {
+        p_pool->exhausted_count++;
+        return NULL;
+    }
+
+    uart_line_slot_t * p_slot = &p_pool->slot[p_pool->free[free_tail & UART_LINE_POOL_MASK]];
+    p_pool->free_tail = free_tail + 1u;
+
+    /* Set again by the receiving side for lines it can time */
+    p_slot->rx_timed = false;
+
+    return p_slot;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Return a slot to its pool. Matches the transmit queue release callback, so it runs from the TX
+ *               complete interrupt as well as from the main loop when a line is not sent.
+ *  @param[in]   p_context    Slot to return
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_line_pool_release(void * p_context)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    uart_line_slot_t * p_slot = (uart_line_slot_t *) p_context;
+    uart_line_pool_t * p_pool = p_slot->p_pool;
+
+    /* Both contexts release, so the index write and publish must not interleave */
+    FSP_CRITICAL_SECTION_ENTER;
+    p_pool->free[p_pool->free_head & UART_LINE_POOL_MASK] = (uint8_t) (p_slot - p_pool->slot);
+    __DMB();
+    p_pool->free_head++;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Number of free slots. Slots released by the TX complete interrupt meanwhile are not counted yet.
+ *  @param[in]   p_pool    Line pool
+ *  @retval      Free slot count
+ ****************************************************************************************************************/
+uint32_t uart_line_pool_free_count(uart_line_pool_t const * p_pool)
+{
+    return p_pool->free_head - p_pool->free_tail;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_line_pool)
+ **********************************************************************************************************************/
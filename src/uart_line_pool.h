@@ -0,0 +1,46 @@
+/***********************************************************************************************************************
+ * File Name    : uart_line_pool.h
+ * Description  : Contains data structures and function declarations of uart_line_pool.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_LINE_POOL_H_
+#define UART_LINE_POOL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bsp_api.h"
+
+/* Macro definition */
+#define UART_LINE_POOL_DEPTH      (8u)      /* Lines in flight between reception and transmission, power of two */
+#define UART_LINE_SLOT_SIZE       (256u)    /* Bytes per line, terminating NUL included */
+
+struct st_uart_line_pool;
+
+/* One line buffer. Filled by the receiving side, then lent to a transmit queue until the line is on the wire. */
+typedef struct st_uart_line_slot
+{
+    uint8_t                    data[UART_LINE_SLOT_SIZE];    /* Line bytes */
+    uint32_t                   length;                       /* Valid bytes in data */
+    uint32_t                   rx_cycles;                    /* Cycle counter when the line ended on the PC channel */
+    bool                       rx_timed;                     /* rx_cycles is set, the line came from the PC */
+    struct st_uart_line_pool * p_pool;                       /* Pool the slot is returned to */
+} uart_line_slot_t;
+
+/* Fixed pool of line slots. Free slots are kept in a ring of indices; the main loop takes them out and the
+ * TX complete interrupt puts them back. */
+typedef struct st_uart_line_pool
+{
+    uart_line_slot_t  slot[UART_LINE_POOL_DEPTH];     /* Line buffers */
+    uint8_t           free[UART_LINE_POOL_DEPTH];     /* Indices of free slots */
+    volatile uint32_t free_head;                      /* Next free index to write (release) */
+    volatile uint32_t free_tail;                      /* Next free index to read (acquire) */
+    volatile uint32_t exhausted_count;                /* Acquires that found no free slot */
+} uart_line_pool_t;
+
+/* Function declaration */
+void uart_line_pool_init(uart_line_pool_t * p_pool);
+uart_line_slot_t * uart_line_pool_acquire(uart_line_pool_t * p_pool);
+void uart_line_pool_release(void * p_context);
+uint32_t uart_line_pool_free_count(uart_line_pool_t const * p_pool);
+
+#endif /* UART_LINE_POOL_H_ */
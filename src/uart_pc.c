@@ -6,72 +6,309 @@
 #include "common_utils.h"
 #include "uart_pc.h"
 #include "uart_ep.h"
+#include "uart_tx_queue.h"
+#include "uart_rx_ring.h"
+#include "uart_line_pool.h"
+#include "uart_cut_through.h"
+#include "uart_frame.h"
+#include "uart_baud.h"
+#include "speech_queue.h"
+#include "uart_rx_dtc.h"
+#include "uart_rx_dmac.h"
+#include "uart_bench.h"
+#include "uart_text.h"
+#include "timer_pwm.h"
+#include "phrase_cache.h"
+#include "speech_script.h"
+#include "bridge_event.h"
+#include "trace.h"
+#include "perf_region.h"
+#include "line_latency.h"
 
 /*******************************************************************************************************************//**
  * @addtogroup r_sci_uart_pc
  * @{
  **********************************************************************************************************************/
 
+/*
+ * Private macro definitions
+ */
+#define UART_PC_FRAME_MAX_PHRASE  (UART_LINE_SLOT_SIZE - 2u)    /* Data frame payload limit, CR and NUL are added */
+#define UART_PC_LINE_MODE         (UART_PC_FRAMED || !UART_PC_CUT_THROUGH)  /* Lines are complete when forwarded */
+#define UART_PC_LF_ASCII          (10u)     /* Line feed */
+#define UART_PC_CACHE_REPLY_SIZE  (16u)     /* "@M", ten hex digits, carriage return and NUL */
+#define UART_PC_SCRIPT_ENABLED    (UART_PC_SCRIPT && UART_PC_SPEECH_QUEUE && UART_PC_LINE_MODE)
+#define UART_PC_SCRIPT_REPLY_SIZE (16u)     /* "@K", sentence count, carriage return and NUL */
+#define UART_PC_LATENCY_ENABLED   (LINE_LATENCY_ENABLED && UART_PC_LINE_MODE)
+#define UART_PC_LATENCY_REPLY_SIZE (64u)    /* "@L", stage, five numbers, carriage return and NUL */
+#if BSP_CFG_SDRAM_ENABLED
+ #define UART_PC_SCRIPT_SIZE      (0x100000u)   /* 1 MB of the SDRAM, power of two */
+#else
+ #define UART_PC_SCRIPT_SIZE      (0x4000u)     /* 16 KB of SRAM without the SDRAM, power of two */
+#endif
+
 /*
  * Private function declarations
 */
+#if UART_PC_LINE_MODE
+static void uart_pc_forward(uart_line_slot_t * p_slot);
+#endif
+#if UART_PC_LINE_MODE && !UART_PC_FRAMED
+static void uart_pc_overflow_drop(uart_line_slot_t * p_slot);
+#endif
+#if UART_PC_FRAMED
+static void uart_pc_frame_poll(void);
+static void uart_pc_frame_reply(bool flush);
+#endif
+static void uart_pc_rtt_command(void);
+static void uart_pc_rx_step(void);
+static void uart_pc_tx_step(void);
+#if UART_PC_SPEECH_QUEUE && UART_PC_LINE_MODE
+static void uart_pc_submit(uart_line_slot_t * p_slot);
+#endif
+#if UART_PC_TEXT_CHECK && UART_PC_LINE_MODE
+static void uart_pc_text_reject(uart_line_slot_t * p_slot, uint32_t text_length);
+#endif
+#if UART_PC_PHRASE_CACHE && UART_PC_LINE_MODE
+static bool uart_pc_cache_play(uart_line_slot_t * p_slot, bool * p_cached);
+#endif
+#if UART_PC_SCRIPT_ENABLED
+static bool uart_pc_script_command(uart_line_slot_t * p_slot);
+static void uart_pc_script_reply(char command, uint32_t count);
+static void uart_pc_script_poll(void);
+#endif
+#if UART_PC_LATENCY_ENABLED
+static bool uart_pc_latency_command(uart_line_slot_t * p_slot);
+#endif
+
 /* uart pc */
-/* Temporary buffer to save data from receive buffer for further processing */
-static uint8_t g_pc_temp_buffer[MAX_DATA_LENGTH] = {RESET_VALUE};
+/* Line slots lent to the talk board transmit queue. A line is taken out of the receive ring into a slot once and
+ * the talk board TX complete interrupt returns the slot, so forwarding never copies or rescans the line.
+ * That one copy is kept on purpose. A slot stays lent until the talk board has the whole phrase, which is seconds
+ * with the utterance queue, while the receive ring must go on taking bytes: lines held in place would pin ring
+ * space, wrap around its end, and stop reception once the oldest line is not spoken yet. In DMAC mode the bytes
+ * are copied once more, landing buffer to ring, since the DMAC writes fixed halves that do not follow line ends
+ * and must be free again before the next half fills. Both copies are at most a line, in the main loop. */
+static uart_line_pool_t g_pc_line_pool;
+#if (!UART_PC_SPEECH_QUEUE) || (!UART_PC_LINE_MODE)
+/* Line received reply, the utterance queue sends its own acknowledgements instead */
 static uint8_t g_pc_reply_buffer[MAX_DATA_LENGTH] = {"\r"};
+#endif
+
+/* Receive ring filled by the RX ISR, DTC or DMAC receive path, drained line by line by uart_pc_com() */
+static uart_rx_ring_t g_pc_rx_ring;
+
+#if (UART_PC_RX_MODE_DTC == UART_PC_RX_MODE)
+/* DTC landing buffer for the PC channel */
+static uart_rx_dtc_t g_pc_rx_dtc;
+#elif (UART_PC_RX_MODE_DMAC == UART_PC_RX_MODE)
+/* DMAC landing buffer for the PC channel */
+static uart_rx_dmac_t g_pc_rx_dmac;
+
+/* SCI2 configuration with the receive FIFO trigger the DMAC needs, set up by uart_pc_init() */
+static sci_b_uart_extended_cfg_t g_pc_rx_dmac_uart_extend;
+static uart_cfg_t g_pc_rx_dmac_uart_cfg;
+#endif
+
+#if UART_PC_FRAMED
+/* Framed protocol state. The decoder writes the payload of the next frame straight into gp_pc_frame_slot. */
+static uart_frame_decoder_t g_pc_frame_decoder;
+static uart_frame_link_t g_pc_frame_link;
+static uart_line_slot_t * gp_pc_frame_slot = NULL;
+static uint32_t g_pc_frame_rx_cycles = RESET_VALUE;    /* Cycle counter when bytes were last decoded */
+#elif UART_PC_CUT_THROUGH
+/* Forwarding state when bytes go to the talk board before the line is complete */
+static uart_cut_through_t g_pc_cut_through;
+#endif
+
+#if UART_PC_SPEECH_QUEUE
+/* Phrases waiting for the talk board */
+static speech_queue_t g_pc_speech_queue;
+#endif
 
-/* Counter to update g_temp_buffer index */
-static volatile uint8_t g_pc_counter_var = RESET_VALUE;
+#if UART_PC_BAUD_NEGOTIATION
+/* Rate switching requested by the PC */
+static uart_baud_t g_pc_baud;
+#endif
 
-/* Flag to check whether data is received or not */
-static volatile uint8_t g_pc_data_received_flag = false;
+#if UART_PC_LINE_MODE && !UART_PC_FRAMED
+/* Line pieces dropped because the receive ring overflowed */
+static uint32_t g_pc_overflow_line_count = RESET_VALUE;
+#endif
+
+#if UART_PC_TEXT_CHECK && UART_PC_LINE_MODE
+/* Lines dropped by the text check, by the classes that failed it */
+static uint32_t g_pc_text_reject_count = RESET_VALUE;
+static uint32_t g_pc_text_reject_classes = RESET_VALUE;
+#endif
+
+#if UART_PC_PHRASE_CACHE && UART_PC_LINE_MODE
+/* Lines the PC sent most often, replayed on "@C<hash><length>" */
+static phrase_cache_t g_pc_phrase_cache;
+#endif
+
+#if UART_PC_SCRIPT_ENABLED
+/* Narration uploaded by the PC. The SDRAM is not cleared at startup, the ring only reads what was stored. */
+static speech_script_t g_pc_script;
+ #if BSP_CFG_SDRAM_ENABLED
+static uint8_t g_pc_script_buffer[UART_PC_SCRIPT_SIZE] BSP_PLACE_IN_SECTION(".sdram");
+ #else
+static uint8_t g_pc_script_buffer[UART_PC_SCRIPT_SIZE];
+ #endif
+#endif
 
 /* Flag for user callback */
 static volatile uint8_t g_pc_uart_event = RESET_VALUE;
 
+/* Transmit queue towards the PC */
+static uart_tx_queue_t g_pc_tx_queue;
+
 /*****************************************************************************************************************
- *  @brief       UART Example project to demonstrate the functionality
+ *  @brief       UART Example project to demonstrate the functionality. The CPU sleeps between passes, the
+ *               interrupts that bring work and the main loop tick wake it.
  *  @param[in]   None
  *  @retval      FSP_SUCCESS     Upon success
  *  @retval      Any Other Error code apart from FSP_SUCCESS
  ****************************************************************************************************************/
 fsp_err_t uart_pc_com(void)
 {
-    fsp_err_t err = FSP_SUCCESS;
     while (true)
     {
-        if(g_pc_data_received_flag)
-        {
-            g_pc_data_received_flag  = false;
-            uint8_t input_length = RESET_VALUE;
+        /* Sleep until an interrupt brings work or the tick polls the timeouts */
+        bridge_event_wait(BRIDGE_EVENT_ALL);
+        TRACE_BEGIN(TRACE_ID_BRIDGE_LOOP);
 
-            /* Calculate g_temp_buffer length */
-            input_length = ((uint8_t)(strlen((char *) &g_pc_temp_buffer)));
+        /* Debug commands from the RTT viewer */
+        uart_pc_rtt_command();
 
-            /* Check if input data length is in limit */
-            if (input_length > 0)
-            {
-                /* send rcv data send to talk board */
-                err = uart_print_pc_msg(g_pc_reply_buffer); // rcv data end reply
-                if (FSP_SUCCESS != err)
-                {
-                    APP_PRINT ("\r\n ** UART0 FAILED *uart0_print_user_msg* \r\n");
-                    deinit_pc_uart();
-                    APP_ERR_TRAP(err);
-                }
+        uart_pc_rx_step();
+        uart_pc_tx_step();
+        TRACE_END(TRACE_ID_BRIDGE_LOOP);
+    }
+}
 
-                err = uart_print_user_msg(g_pc_temp_buffer);// data send to talk board
-                if (FSP_SUCCESS != err)
-                {
-                    APP_PRINT ("\r\n ** UART0 FAILED *uart0_print_user_msg* \r\n");
-                    deinit_pc_uart();
-                    APP_ERR_TRAP(err);
-                }
-            }
+/*****************************************************************************************************************
+ *  @brief       Take in what the PC sent: receive path, line or frame parsing, link commands and the script
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_pc_rx_step(void)
+{
+    TRACE_BEGIN(TRACE_ID_PC_RX_STEP);
+    PERF_REGION_BEGIN(PERF_REGION_PC_RX_STEP);
+
+#if (UART_PC_RX_MODE_DTC == UART_PC_RX_MODE)
+    /* Move the bytes the DTC received into the line ring */
+    uart_rx_dtc_poll(&g_pc_rx_dtc, &g_pc_rx_ring);
+#elif (UART_PC_RX_MODE_DMAC == UART_PC_RX_MODE)
+    /* Move the bytes the DMAC received into the line ring on a half/full event or idle line */
+    uart_rx_dmac_poll(&g_pc_rx_dmac, &g_pc_rx_ring);
+#endif
+
+#if UART_PC_FRAMED
+    /* Decode frames straight out of the receive ring and acknowledge them */
+    uart_pc_frame_poll();
+#elif UART_PC_CUT_THROUGH
+    /* Bytes are already on their way to the talk board, only acknowledge completed lines to the PC */
+    uint32_t line_count = uart_cut_through_poll(&g_pc_cut_through);
+
+    while (line_count--)
+    {
+        fsp_err_t err = uart_print_pc_msg(g_pc_reply_buffer); // rcv data end reply
+        if ((FSP_SUCCESS != err) && (FSP_ERR_INSUFFICIENT_SPACE != err))
+        {
+            APP_PRINT ("\r\n ** UART2 FAILED *uart_print_pc_msg* \r\n");
+            deinit_pc_uart();
+            APP_ERR_TRAP(err);
         }
     }
+#else
+    /* Drain every line completed since the last pass */
+    uint32_t line_count = uart_rx_ring_lines_available(&g_pc_rx_ring);
+
+    while (line_count--)
+    {
+        /* Every slot is still queued for the talk board, leave the line in the ring for the next pass */
+        uart_line_slot_t * p_slot = uart_line_pool_acquire(&g_pc_line_pool);
+        if (NULL == p_slot)
+        {
+            break;
+        }
+
+        /* Take the line out of the ring, carriage return included. Its latency counts from the carriage return. */
+        bool overflow = uart_rx_ring_line_overflow(&g_pc_rx_ring);
+        p_slot->rx_cycles = uart_rx_ring_line_cycles(&g_pc_rx_ring);
+        p_slot->rx_timed  = true;
+        if (FSP_ERR_OVERFLOW == uart_rx_ring_line_get(&g_pc_rx_ring, p_slot->data, sizeof(p_slot->data),
+                                                      &p_slot->length))
+        {
+            /* Longer than a slot, only its start and its carriage return were kept */
+            overflow = true;
+        }
+        if (overflow)
+        {
+            /* Part of the line was lost, it must not be spoken */
+            uart_pc_overflow_drop(p_slot);
+            continue;
+        }
+        uart_pc_forward(p_slot);
+    }
+#endif
+
+#if UART_PC_SCRIPT_ENABLED
+    /* Keep the next sentence of the narration waiting in the utterance queue */
+    uart_pc_script_poll();
+#endif
+
+#if UART_PC_BAUD_NEGOTIATION
+    /* Switch the rate once the acknowledgement is out, fall back if the probe does not follow */
+    uart_baud_poll(&g_pc_baud);
+#endif
+    PERF_REGION_END(PERF_REGION_PC_RX_STEP);
+    TRACE_END(TRACE_ID_PC_RX_STEP);
 }
 
+/*****************************************************************************************************************
+ *  @brief       Feed the talk board: utterance queue and rate measurement
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_pc_tx_step(void)
+{
+    TRACE_BEGIN(TRACE_ID_PC_TX_STEP);
+    PERF_REGION_BEGIN(PERF_REGION_PC_TX_STEP);
+
+#if UART_PC_SPEECH_QUEUE && UART_PC_LINE_MODE
+    /* Send the next phrase once the talk board shows its prompt */
+    speech_queue_poll(&g_pc_speech_queue, uart_ep_ready_count());
+#endif
+
+    /* Its reply lines carry nothing the bridge uses */
+    uart_ep_poll();
+
+#if UART_EP_AUTOBAUD
+    /* Apply the talk board rate once its answer is measured */
+    uart_ep_autobaud_poll();
+#endif
+    PERF_REGION_END(PERF_REGION_PC_TX_STEP);
+    TRACE_END(TRACE_ID_PC_TX_STEP);
+}
+
+#if UART_PC_SPEECH_QUEUE && UART_PC_LINE_MODE
+/*****************************************************************************************************************
+ *  @brief       Pass a line on to the utterance queue, which acknowledges it to the PC
+ *  @param[in]   p_slot    Line slot, owned by the queue once accepted, released here otherwise
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_pc_submit(uart_line_slot_t * p_slot)
+{
+    if (FSP_SUCCESS != speech_queue_submit(&g_pc_speech_queue, p_slot))
+    {
+        uart_line_pool_release(p_slot);
+    }
+}
+#endif
+
 /*******************************************************************************************************************//**
  * @brief       Initialize  UART.
  * @param[in]   None
@@ -82,65 +319,119 @@ fsp_err_t uart_pc_init(void)
 {
     fsp_err_t err = FSP_SUCCESS;
 
+    /* Receive ring must be ready before the first RX interrupt */
+    uart_line_pool_init(&g_pc_line_pool);
+#if UART_PC_FRAMED
+    /* Frames are binary, the ring must not look for line ends */
+    uart_rx_ring_init(&g_pc_rx_ring, UART_RX_NO_DELIMITER);
+    uart_frame_decoder_init(&g_pc_frame_decoder);
+    uart_frame_link_init(&g_pc_frame_link);
+    gp_pc_frame_slot = NULL;
+    g_pc_frame_rx_cycles = bridge_event_cycles();
+#else
+    uart_rx_ring_init(&g_pc_rx_ring, CARRIAGE_ASCII);
+#endif
+#if UART_PC_CUT_THROUGH && !UART_PC_FRAMED
+    uart_cut_through_init(&g_pc_cut_through, &g_pc_rx_ring);
+#endif
+#if UART_PC_SPEECH_QUEUE
+    speech_queue_init(&g_pc_speech_queue, uart_ep_ready_count());
+#endif
+#if UART_PC_PHRASE_CACHE && UART_PC_LINE_MODE
+    phrase_cache_init(&g_pc_phrase_cache);
+#endif
+#if UART_PC_SCRIPT_ENABLED
+    speech_script_init(&g_pc_script, g_pc_script_buffer, UART_PC_SCRIPT_SIZE);
+#endif
+
+    uart_cfg_t const * p_uart_cfg = &g_uart2_cfg;
+#if (UART_PC_RX_MODE_DMAC == UART_PC_RX_MODE)
+    /* The DMAC moves one byte per RXI, so the receive FIFO must raise RXI for every byte. The SCI driver already
+     * does that when a receive transfer instance is linked, the trigger is set here so the mode does not rely on
+     * one being there. */
+    g_pc_rx_dmac_uart_extend                 = g_uart2_cfg_extend;
+    g_pc_rx_dmac_uart_extend.rx_fifo_trigger = SCI_B_UART_RX_FIFO_TRIGGER_1;
+    g_pc_rx_dmac_uart_cfg                    = g_uart2_cfg;
+    g_pc_rx_dmac_uart_cfg.p_extend           = &g_pc_rx_dmac_uart_extend;
+    p_uart_cfg                               = &g_pc_rx_dmac_uart_cfg;
+#endif
+
     /* Initialize UART channel with baud rate 115200 */
 #if defined (BOARD_RA6T2_MCK) || defined (BOARD_RA8M1_EK)
-    err = R_SCI_B_UART_Open (&g_uart2_ctrl, &g_uart2_cfg);
+    err = R_SCI_B_UART_Open (&g_uart2_ctrl, p_uart_cfg);
 #else
-    err = R_SCI_UART_Open (&g_uart2_ctrl, &g_uart2_cfg);
+    err = R_SCI_UART_Open (&g_uart2_ctrl, p_uart_cfg);
 #endif
     if (FSP_SUCCESS != err)
     {
         APP_ERR_PRINT ("\r\n**  R_SCI2_UART_Open API failed  **\r\n");
+        return err;
     }
+
+#if (UART_PC_RX_MODE_DTC == UART_PC_RX_MODE)
+    /* Reception is handled by the DTC from here on, RXI no longer reaches the CPU */
+    err = uart_rx_dtc_start(&g_pc_rx_dtc, &g_transfer_uart2_rx);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n**  UART2 DTC receive start failed  **\r\n");
+        return err;
+    }
+#elif (UART_PC_RX_MODE_DMAC == UART_PC_RX_MODE)
+    /* Reception is handled by the DMAC from here on. RXI only triggers the DMAC through its event link, the CPU
+     * is interrupted once per half buffer instead of once per FIFO fill. */
+    R_BSP_IrqDisable(VECTOR_NUMBER_SCI2_RXI);
+    err = uart_rx_dmac_start(&g_pc_rx_dmac, &g_transfer_dmac_uart2_rx);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n**  UART2 DMAC receive start failed  **\r\n");
+        return err;
+    }
+#elif SCI_B_UART_CFG_RX_BLOCK_ENABLE
+    /* One callback per receive FIFO drain, the ring finds the line ends itself */
+    err = R_SCI_B_UART_RxBlockSet(&g_uart2_ctrl, true, SCI_B_UART_RX_BLOCK_NO_DELIMITER);
+    if (FSP_SUCCESS != err)
+    {
+        APP_ERR_PRINT ("\r\n**  R_SCI_B_UART_RxBlockSet API failed  **\r\n");
+        return err;
+    }
+#endif
+
+    /* Transmission is driven by the TX interrupts from here on */
+    err = uart_tx_queue_init(&g_pc_tx_queue, &g_uart2_ctrl);
+#if UART_PC_BAUD_NEGOTIATION
+    uart_baud_init(&g_pc_baud, &g_uart2_ctrl, &g_pc_tx_queue);
+#endif
     return err;
 }
 
 /*****************************************************************************************************************
- *  @brief       print user message to terminal
+ *  @brief       Queue message for the PC. Returns without waiting for the transmission.
  *  @param[in]   p_msg
- *  @retval      FSP_SUCCESS                Upon success
- *  @retval      FSP_ERR_TRANSFER_ABORTED   Upon event failure
+ *  @retval      FSP_SUCCESS                 Upon success
+ *  @retval      FSP_ERR_INSUFFICIENT_SPACE  Transmit queue is full
  *  @retval      Any Other Error code apart from FSP_SUCCESS,  Unsuccessful write operation
  ****************************************************************************************************************/
 fsp_err_t uart_print_pc_msg(uint8_t *p_msg)
 {
     fsp_err_t err   = FSP_SUCCESS;
-    uint8_t msg_len = RESET_VALUE;
-    uint32_t local_timeout = (DATA_LENGTH * UINT16_MAX);
-    uint8_t *p_temp_ptr = (uint8_t *)p_msg;
+    uint32_t msg_len = RESET_VALUE;
 
     /* Calculate length of message received */
-    msg_len = ((uint8_t)(strlen((char *)p_temp_ptr)));
-
-    /* Reset callback capture variable */
-    g_pc_uart_event = RESET_VALUE;
+    msg_len = ((uint32_t)(strlen((char *)p_msg)));
 
-    /* Writing to terminal */
-#if defined (BOARD_RA6T2_MCK) || defined (BOARD_RA8M1_EK)
-    err = R_SCI_B_UART_Write (&g_uart2_ctrl, p_msg, msg_len);
+#if UART_PC_FRAMED
+    /* Board messages travel as event frames. A message the queue rejects still uses up its sequence number, so
+     * the PC sees the gap. */
+    uint8_t frame[UART_FRAME_MAX_SIZE];
+    uint32_t frame_len = uart_frame_encode(UART_FRAME_TYPE_EVENT, g_pc_frame_link.tx_seq++, p_msg, msg_len, frame);
+    err = uart_tx_queue_send(&g_pc_tx_queue, frame, frame_len);
 #else
-    err = R_SCI_UART_Write (&g_uart2_ctrl, p_msg, msg_len);
+    /* Writing to terminal, TX complete interrupt advances the queue */
+    err = uart_tx_queue_send(&g_pc_tx_queue, p_msg, msg_len);
 #endif
-
     if (FSP_SUCCESS != err)
     {
-        APP_ERR_PRINT ("\r\n**  R_SCI_UART_Write API Failed  **\r\n");
-        return err;
-    }
-
-    /* Check for event transfer complete */
-    while ((UART_EVENT_TX_COMPLETE != g_pc_uart_event) && (--local_timeout))
-    {
-        /* Check if any error event occurred */
-        if (UART_PC_ERROR_EVENTS == g_pc_uart_event)
-        {
-            APP_ERR_PRINT ("\r\n**  UART Error Event Received  **\r\n");
-            return FSP_ERR_TRANSFER_ABORTED;
-        }
-    }
-    if(RESET_VALUE == local_timeout)
-    {
-        err = FSP_ERR_TIMEOUT;
+        APP_ERR_PRINT ("\r\n**  UART2 transmit queue rejected message  **\r\n");
     }
     return err;
 }
@@ -189,44 +480,633 @@ void uart_pc_close(void)
     }
 }
 
+#if UART_PC_TEXT_CHECK && UART_PC_LINE_MODE
 /*****************************************************************************************************************
- *  @brief      UART PC callback
- *  @param[in]  p_args
- *  @retval     None
+ *  @brief       Drop a line that failed the text check and tell the PC. The classes are only looked at here, the
+ *               check itself is the cheaper printable scan.
+ *  @param[in]   p_slot         Line slot, released here
+ *  @param[in]   text_length    Bytes before the first line end
+ *  @retval      None
  ****************************************************************************************************************/
-void uart_pc_callback(uart_callback_args_t *p_args)
+static void uart_pc_text_reject(uart_line_slot_t * p_slot, uint32_t text_length)
 {
-    /* Logged the event in global variable */
-    g_pc_uart_event = (uint8_t)p_args->event;
+    g_pc_text_reject_count++;
+    g_pc_text_reject_classes |= uart_text_classify(p_slot->data, p_slot->length - 1u);
+    if (text_length != (p_slot->length - 1u))
+    {
+        g_pc_text_reject_classes |= UART_TEXT_CLASS_EOL;
+    }
 
-    /* Reset g_temp_buffer index if it exceeds than buffer size */
-    if(DATA_LENGTH == g_pc_counter_var)
+    uart_line_pool_release(p_slot);
+    uart_print_pc_msg((uint8_t *) UART_PC_TEXT_REJECT);
+}
+#endif
+
+#if UART_PC_LINE_MODE && !UART_PC_FRAMED
+/*****************************************************************************************************************
+ *  @brief       Drop a line that lost bytes in the receive ring. The ring closes the bytes it holds as a line when
+ *               it fills up, the rest follows as a second line, so the PC is answered once: on the piece that
+ *               carries its carriage return.
+ *  @param[in]   p_slot    Line slot, released here
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_pc_overflow_drop(uart_line_slot_t * p_slot)
+{
+    bool line_end = (RESET_VALUE != p_slot->length) && (CARRIAGE_ASCII == p_slot->data[p_slot->length - 1u]);
+
+    g_pc_overflow_line_count++;
+    uart_line_pool_release(p_slot);
+    if (line_end)
+    {
+        uart_print_pc_msg((uint8_t *) UART_PC_OVERFLOW_REJECT);
+    }
+}
+#endif
+
+#if UART_PC_PHRASE_CACHE && UART_PC_LINE_MODE
+/*****************************************************************************************************************
+ *  @brief       Replace a play command with the cached line. A line that is not cached is answered with
+ *               "@M<hash><length>" so the PC sends the text.
+ *  @param[in]   p_slot    Line slot, carriage return included. Released when the line is not cached.
+ *  @param[out]  p_cached  Set when the slot now holds a cached line
+ *  @retval      true when the slot holds a line to forward
+ ****************************************************************************************************************/
+static bool uart_pc_cache_play(uart_line_slot_t * p_slot, bool * p_cached)
+{
+    uint32_t hash   = RESET_VALUE;
+    uint32_t length = RESET_VALUE;
+
+    if (!phrase_cache_command(p_slot->data, p_slot->length, &hash, &length))
+    {
+        return true;
+    }
+
+    phrase_cache_entry_t const * p_entry = phrase_cache_lookup(&g_pc_phrase_cache, hash, length);
+    if (NULL == p_entry)
+    {
+        char reply[UART_PC_CACHE_REPLY_SIZE] = {RESET_VALUE};
+
+        uart_line_pool_release(p_slot);
+        snprintf(reply, sizeof(reply), "%c%c%08lX%02X\r", PHRASE_CACHE_COMMAND_PREFIX, PHRASE_CACHE_MISS,
+                 (unsigned long) hash, (unsigned) (uint8_t) length);
+        uart_print_pc_msg((uint8_t *) reply);
+        return false;
+    }
+
+    /* Cached lines passed the text check when they were learnt */
+    memcpy(p_slot->data, p_entry->text, p_entry->length);
+    p_slot->length                 = p_entry->length;
+    p_slot->data[p_slot->length++] = CARRIAGE_ASCII;
+    p_slot->data[p_slot->length]   = RESET_VALUE;
+    *p_cached                      = true;
+    return true;
+}
+#endif
+
+#if UART_PC_SCRIPT_ENABLED
+/*****************************************************************************************************************
+ *  @brief       Handle the script commands, and store the lines that arrive during an upload. Other link commands
+ *               keep working during an upload. The first line the full ring cannot take is answered with
+ *               "@O<sentence>", the rest of the upload is dropped and "@E" reports the sentences stored.
+ *  @param[in]   p_slot    Line slot, carriage return included. Released when the line is taken.
+ *  @retval      true when the line was taken here
+ ****************************************************************************************************************/
+static bool uart_pc_script_command(uart_line_slot_t * p_slot)
+{
+    bool command = (3u == p_slot->length) && (SPEECH_SCRIPT_COMMAND_PREFIX == p_slot->data[0]);
+
+    if (command && (SPEECH_SCRIPT_BEGIN == p_slot->data[1]))
+    {
+        speech_script_clear(&g_pc_script);
+        g_pc_script.state = SPEECH_SCRIPT_STATE_UPLOAD;
+    }
+    else if (command && (SPEECH_SCRIPT_END == p_slot->data[1]))
+    {
+        if (SPEECH_SCRIPT_STATE_UPLOAD == g_pc_script.state)
+        {
+            g_pc_script.state = SPEECH_SCRIPT_STATE_PLAY;
+        }
+        uart_pc_script_reply(SPEECH_SCRIPT_ACCEPT, g_pc_script.stored_count);
+    }
+    else if (command && (SPEECH_SCRIPT_CANCEL == p_slot->data[1]))
+    {
+        speech_script_clear(&g_pc_script);
+    }
+    else if ((SPEECH_SCRIPT_STATE_UPLOAD == g_pc_script.state) && (SPEECH_SCRIPT_COMMAND_PREFIX != p_slot->data[0]))
+    {
+        /* Stored without the carriage return, speech_script_next() puts it back */
+        if ((FSP_SUCCESS != speech_script_append(&g_pc_script, p_slot->data, p_slot->length - 1u)) &&
+            (1u == g_pc_script.full_count))
+        {
+            uart_pc_script_reply(SPEECH_SCRIPT_FULL, g_pc_script.stored_count + 1u);
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    uart_line_pool_release(p_slot);
+    return true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Send a script answer to the PC
+ *  @param[in]   command   Answer letter
+ *  @param[in]   count     Sentence number or count
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_pc_script_reply(char command, uint32_t count)
+{
+    char reply[UART_PC_SCRIPT_REPLY_SIZE] = {RESET_VALUE};
+
+    snprintf(reply, sizeof(reply), "%c%c%lu\r", SPEECH_SCRIPT_COMMAND_PREFIX, command, (unsigned long) count);
+    uart_print_pc_msg((uint8_t *) reply);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Move the next stored sentence into the utterance queue once it has nothing waiting. One sentence
+ *               is always ready when the talk board shows its prompt, the rest stays in the ring so PC lines can
+ *               still get in between. The queue acknowledges every sentence like a line sent by the PC.
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_pc_script_poll(void)
+{
+    if ((SPEECH_SCRIPT_STATE_IDLE == g_pc_script.state) ||
+        (RESET_VALUE != speech_queue_pending(&g_pc_speech_queue)))
     {
-        g_pc_counter_var = RESET_VALUE;
+        return;
     }
 
-    if(UART_EVENT_RX_CHAR == p_args->event)
+    if (g_pc_script.head == g_pc_script.tail)
     {
-        switch (p_args->data)
+        /* Ran dry. During an upload more sentences follow, after it the narration is over. */
+        if (SPEECH_SCRIPT_STATE_PLAY == g_pc_script.state)
         {
-            /* If Enter is pressed by user, set flag to process the data */
-            case CARRIAGE_ASCII:
+            g_pc_script.state = SPEECH_SCRIPT_STATE_IDLE;
+            uart_pc_script_reply(SPEECH_SCRIPT_DONE, g_pc_script.spoken_count);
+        }
+        return;
+    }
+
+    /* Without a free slot the sentence waits for the next pass */
+    uart_line_slot_t * p_slot = uart_line_pool_acquire(&g_pc_line_pool);
+    if (NULL == p_slot)
+    {
+        return;
+    }
+
+    p_slot->length               = speech_script_next(&g_pc_script, p_slot->data, UART_LINE_SLOT_SIZE - 1u);
+    p_slot->data[p_slot->length] = RESET_VALUE;
+    uart_pc_submit(p_slot);
+}
+#endif
+
+#if UART_PC_LATENCY_ENABLED
+/*****************************************************************************************************************
+ *  @brief       Answer "@L" with one line per stage, "@L<stage><lines>,<p50>,<p99>,<p99.9>,<max>" in microseconds
+ *               from the carriage return. "@L0" clears the histograms first, to start a measurement.
+ *  @param[in]   p_slot    Line slot, carriage return included. Released when the line is taken.
+ *  @retval      true when the line was taken here
+ ****************************************************************************************************************/
+static bool uart_pc_latency_command(uart_line_slot_t * p_slot)
+{
+    char     reply[UART_PC_LATENCY_REPLY_SIZE] = {RESET_VALUE};
+    uint32_t count                             = RESET_VALUE;
+    uint32_t us[LINE_LATENCY_VALUES]           = {RESET_VALUE};
+
+    if ((p_slot->length < 3u) || (LINE_LATENCY_COMMAND_PREFIX != p_slot->data[0]) ||
+        (LINE_LATENCY_COMMAND != p_slot->data[1]))
+    {
+        return false;
+    }
+    if ((4u == p_slot->length) && (LINE_LATENCY_CLEAR == p_slot->data[2]))
+    {
+        line_latency_reset();
+    }
+    else if (3u != p_slot->length)
+    {
+        return false;
+    }
+    uart_line_pool_release(p_slot);
+
+    for (uint32_t i = RESET_VALUE; i < LINE_LATENCY_STAGE_COUNT; i++)
+    {
+        line_latency_percentiles((line_latency_stage_t) i, &count, us);
+        snprintf(reply, sizeof(reply), "%c%c%c%lu,%lu,%lu,%lu,%lu\r", LINE_LATENCY_COMMAND_PREFIX,
+                 LINE_LATENCY_COMMAND, LINE_LATENCY_STAGE_TAGS[i], (unsigned long) count, (unsigned long) us[0],
+                 (unsigned long) us[1], (unsigned long) us[2], (unsigned long) us[3]);
+        uart_print_pc_msg((uint8_t *) reply);
+    }
+    return true;
+}
+#endif
+
+#if UART_PC_LINE_MODE
+/*****************************************************************************************************************
+ *  @brief       Hand a line received from the PC on to the talk board, to the utterance queue when enabled
+ *  @param[in]   p_slot    Line slot, carriage return included. Owned by this function from here on.
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_pc_forward(uart_line_slot_t * p_slot)
+{
+    /* Check if input data length is in limit */
+    if (p_slot->length <= 1u)
+    {
+        uart_line_pool_release(p_slot);
+        return;
+    }
+
+#if UART_PC_TEXT_CHECK
+    /* A terminal sending CR LF leaves the LF at the start of the next line */
+    if (UART_PC_LF_ASCII == p_slot->data[0])
+    {
+        p_slot->length--;
+        memmove(p_slot->data, &p_slot->data[1], p_slot->length + 1u);    /* NUL terminator included */
+        if (p_slot->length <= 1u)
+        {
+            uart_line_pool_release(p_slot);
+            return;
+        }
+    }
+
+    /* The text must run up to the final carriage return and hold nothing the talk board cannot speak */
+    uint32_t text_length = uart_text_find_eol(p_slot->data, p_slot->length);
+    if ((RESET_VALUE == text_length) || ((text_length + 1u) != p_slot->length) ||
+        !uart_text_printable(p_slot->data, text_length))
+    {
+        uart_pc_text_reject(p_slot, text_length);
+        return;
+    }
+#endif
+
+#if UART_PC_PHRASE_CACHE
+    /* A play command is replaced by the cached line, or answered here when the line is not cached */
+    bool cached = false;
+    if (!uart_pc_cache_play(p_slot, &cached))
+    {
+        return;
+    }
+#endif
+
+#if UART_PC_SCRIPT_ENABLED
+    /* Script commands and the lines of an upload go to the script */
+    if (uart_pc_script_command(p_slot))
+    {
+        return;
+    }
+#endif
+
+#if UART_PC_LATENCY_ENABLED
+    /* Latency queries are answered here */
+    if (uart_pc_latency_command(p_slot))
+    {
+        return;
+    }
+#endif
+
+#if UART_PC_BAUD_NEGOTIATION
+    /* Link commands are answered here and never reach the talk board */
+    if (uart_baud_command(&g_pc_baud, p_slot->data, p_slot->length))
+    {
+        uart_line_pool_release(p_slot);
+        return;
+    }
+#endif
+
+#if UART_PC_PHRASE_CACHE
+    /* The lookup already counted a replayed line */
+    if (!cached)
+    {
+        phrase_cache_learn(&g_pc_phrase_cache, p_slot->data, p_slot->length - 1u);
+    }
+#endif
+
+#if UART_PC_SPEECH_QUEUE
+    /* The queue acknowledges the line to the PC and owns the slot once it is accepted */
+    uart_pc_submit(p_slot);
+#else
+    /* send rcv data send to talk board */
+    fsp_err_t err = uart_print_pc_msg(g_pc_reply_buffer); // rcv data end reply
+    if (FSP_ERR_INSUFFICIENT_SPACE == err)
+    {
+        /* Queue is full, drop this line and keep accepting the next ones */
+        uart_line_pool_release(p_slot);
+        return;
+    }
+    if (FSP_SUCCESS != err)
+    {
+        APP_PRINT ("\r\n ** UART0 FAILED *uart0_print_user_msg* \r\n");
+        deinit_pc_uart();
+        APP_ERR_TRAP(err);
+    }
+
+    /* Lend the slot to the talk board queue, its TX complete interrupt returns it to the pool */
+ #if LINE_LATENCY_ENABLED
+    line_latency_begin(p_slot);
+ #endif
+    err = uart_print_user_line(p_slot->data, p_slot->length, uart_line_pool_release, p_slot);
+    if (FSP_ERR_INSUFFICIENT_SPACE == err)
+    {
+        uart_line_pool_release(p_slot);
+        return;
+    }
+    if (FSP_SUCCESS != err)
+    {
+        APP_PRINT ("\r\n ** UART0 FAILED *uart0_print_user_msg* \r\n");
+        deinit_pc_uart();
+        APP_ERR_TRAP(err);
+    }
+#endif
+}
+#endif
+
+#if UART_PC_FRAMED
+/*****************************************************************************************************************
+ *  @brief       Decode the frames waiting in the receive ring. Data frames are turned into the same line as in
+ *               ASCII mode and forwarded. Without a free line slot the bytes stay in the ring, so the PC stalls
+ *               on its window instead of losing frames.
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_pc_frame_poll(void)
+{
+    uint8_t const * p_data = NULL;
+    uint32_t        length = RESET_VALUE;
+    uint32_t        used   = RESET_VALUE;
+
+    /* The gap is seen from here, so it is measured up to one loop period long, the receive mode delay included */
+    if ((RESET_VALUE == uart_rx_ring_peek(&g_pc_rx_ring, &p_data)) &&
+        ((bridge_event_cycles() - g_pc_frame_rx_cycles) >= ((SystemCoreClock / 1000u) * UART_FRAME_IDLE_MS)) &&
+        uart_frame_decoder_idle(&g_pc_frame_decoder))
+    {
+        uart_frame_link_error(&g_pc_frame_link);
+    }
+
+    while ((length = uart_rx_ring_peek(&g_pc_rx_ring, &p_data)) > RESET_VALUE)
+    {
+        if (NULL == gp_pc_frame_slot)
+        {
+            gp_pc_frame_slot = uart_line_pool_acquire(&g_pc_line_pool);
+            if (NULL == gp_pc_frame_slot)
             {
-                g_pc_counter_var = RESET_VALUE;
-                g_pc_data_received_flag  = true;
-                // rcv data end then send to talk board
                 break;
             }
-            /* Read all data provided by user until enter button is pressed */
+
+            /* Leave room for the carriage return and the NUL appended below */
+            uart_frame_decoder_buffer_set(&g_pc_frame_decoder, gp_pc_frame_slot->data, UART_PC_FRAME_MAX_PHRASE);
+        }
+
+        uart_frame_status_t status = uart_frame_decode(&g_pc_frame_decoder, p_data, length, &used);
+        uart_rx_ring_consume(&g_pc_rx_ring, used);
+        g_pc_frame_rx_cycles = bridge_event_cycles();
+
+        if (UART_FRAME_STATUS_ERROR == status)
+        {
+            uart_frame_link_error(&g_pc_frame_link);
+        }
+        else if ((UART_FRAME_STATUS_FRAME == status) &&
+                 uart_frame_link_receive(&g_pc_frame_link, g_pc_frame_decoder.type, g_pc_frame_decoder.seq))
+        {
+            uart_line_slot_t * p_slot = gp_pc_frame_slot;
+            gp_pc_frame_slot = NULL;
+
+            p_slot->length                 = g_pc_frame_decoder.length;
+            p_slot->data[p_slot->length++] = CARRIAGE_ASCII;
+            p_slot->data[p_slot->length]   = RESET_VALUE;
+            p_slot->rx_cycles              = bridge_event_cycles();
+            p_slot->rx_timed               = true;
+            uart_pc_forward(p_slot);
+        }
+        else
+        {
+            /* Frame not complete, or nothing to deliver. The slot stays with the decoder. */
+        }
+
+        uart_pc_frame_reply(false);
+    }
+
+    /* Nothing more to read for now, acknowledge the frames of a batch that is not full */
+    uart_pc_frame_reply(true);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Send the acknowledgement that is due. A full transmit queue loses it, the PC recovers by resending
+ *               after its timeout.
+ *  @param[in]   flush    Acknowledge a batch that is not full yet
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_pc_frame_reply(bool flush)
+{
+    uint8_t  reply[UART_FRAME_HEADER_SIZE + UART_FRAME_CRC_SIZE];
+    uint32_t length = uart_frame_link_reply(&g_pc_frame_link, flush, reply);
+
+    if (RESET_VALUE != length)
+    {
+        uart_tx_queue_send(&g_pc_tx_queue, reply, length);
+    }
+}
+#endif
+
+/*****************************************************************************************************************
+ *  @brief      Handle a single key command from the RTT viewer
+ *              'r' opens a new benchmark window and clears the urgent speech statistics, the region counts and the
+ *              line latency histograms,
+ *              'b' prints the UART interrupt load since then and the lines lost to receive overflows,
+ *              'q' prints the utterance queue state and the urgent speech latency,
+ *              'f' prints the framed protocol error counters, 'u' prints the PC link rate,
+ *              'a' measures the talk board rate again, 'A' prints the last measurement,
+ *              't' compares the Helium text kernels with their scalar versions and prints the text check counters,
+ *              'p' plays the chime on the PWM-DAC audio output, 'P' prints the audio output state,
+ *              'c' prints the phrase cache counters, 's' prints the narration script state,
+ *              'l' prints the deferred log records and trace events dropped, 'm' prints the PMU counts of the
+ *              measured regions, 'h' prints the line latency percentiles
+ *  @param[in]  None
+ *  @retval     None
+ ****************************************************************************************************************/
+static void uart_pc_rtt_command(void)
+{
+    if (APP_CHECK_DATA)
+    {
+        switch (SEGGER_RTT_GetKey())
+        {
+            case 'r':
+                uart_bench_reset();
+#if UART_PC_SPEECH_QUEUE
+                speech_queue_stats_reset(&g_pc_speech_queue);
+#endif
+#if PERF_REGION_ENABLED
+                perf_region_reset();
+#endif
+#if UART_PC_LATENCY_ENABLED
+                line_latency_reset();
+#endif
+                APP_REPLY("\r\nUART benchmark window reset\r\n");
+                break;
+            case 'b':
+                uart_bench_report();
+#if UART_PC_LINE_MODE && !UART_PC_FRAMED
+                APP_REPLY("Receive ring overflows %d, lines dropped %d\r\n", g_pc_rx_ring.overflow_count,
+                          g_pc_overflow_line_count);
+#endif
+                break;
+            case 't':
+                uart_bench_text();
+#if UART_PC_TEXT_CHECK && UART_PC_LINE_MODE
+                APP_REPLY("Lines dropped %d, classes 0x%02x\r\n", g_pc_text_reject_count, g_pc_text_reject_classes);
+#endif
+                break;
+#if UART_PC_SPEECH_QUEUE
+            case 'q':
+                speech_queue_report(&g_pc_speech_queue);
+                break;
+#endif
+#if UART_PC_BAUD_NEGOTIATION
+            case 'u':
+                APP_REPLY("\r\nPC link %d bps, switches %d, fallbacks %d\r\n", uart_baud_rate(&g_pc_baud),
+                          g_pc_baud.switch_count, g_pc_baud.fallback_count);
+                break;
+#endif
+#if UART_EP_AUTOBAUD
+            case 'a':
+ #if UART_PC_SPEECH_QUEUE
+                /* The prompt of the phrase being spoken would be dropped during the measurement */
+                if (!g_pc_speech_queue.board_ready)
+                {
+                    APP_REPLY("\r\nTalk board busy, rate measurement not started\r\n");
+                    break;
+                }
+ #endif
+                if (FSP_SUCCESS != uart_ep_autobaud_start())
+                {
+                    APP_REPLY("\r\nTalk board rate measurement not started\r\n");
+                }
+                break;
+            case 'A':
+                uart_ep_autobaud_report();
+                break;
+#endif
+#if TIMER_PWM_AUDIO
+            case 'p':
+                if (FSP_SUCCESS != audio_chime())
+                {
+                    APP_REPLY("\r\nAudio queue full\r\n");
+                }
+                break;
+            case 'P':
+                audio_report();
+                break;
+#endif
+#if UART_PC_PHRASE_CACHE && UART_PC_LINE_MODE
+            case 'c':
+                APP_REPLY("\r\nPhrase cache hits %d, misses %d, inserts %d, evictions %d, bytes saved %d\r\n",
+                          g_pc_phrase_cache.hit_count, g_pc_phrase_cache.miss_count, g_pc_phrase_cache.insert_count,
+                          g_pc_phrase_cache.evict_count, g_pc_phrase_cache.saved_bytes);
+                break;
+#endif
+#if UART_PC_SCRIPT_ENABLED
+            case 's':
+                APP_REPLY("\r\nScript state %d, stored %d, spoken %d, lost %d, %d of %d bytes used\r\n",
+                          g_pc_script.state, g_pc_script.stored_count, g_pc_script.spoken_count,
+                          g_pc_script.full_count, g_pc_script.head - g_pc_script.tail, g_pc_script.size);
+                break;
+#endif
+#if APP_LOG_DEFERRED
+            case 'l':
+                APP_REPLY("\r\nLog records dropped %d\r\n", app_log_dropped());
+ #if TRACE_ENABLED
+                APP_REPLY("Trace events dropped %d\r\n", trace_dropped());
+ #endif
+                break;
+#endif
+#if PERF_REGION_ENABLED
+            case 'm':
+                perf_region_report();
+                break;
+#endif
+#if UART_PC_LATENCY_ENABLED
+            case 'h':
+                line_latency_report();
+                break;
+#endif
+#if UART_PC_FRAMED
+            case 'f':
+                APP_REPLY("\r\nFrames %d, CRC errors %d, length errors %d, timeouts %d, skipped bytes %d\r\n",
+                          g_pc_frame_decoder.frame_count, g_pc_frame_decoder.crc_error_count,
+                          g_pc_frame_decoder.length_error_count, g_pc_frame_decoder.timeout_count,
+                          g_pc_frame_decoder.skip_count);
+                APP_REPLY("Duplicates %d, out of order %d, ring overflows %d\r\n", g_pc_frame_link.duplicate_count,
+                          g_pc_frame_link.out_of_order_count, g_pc_rx_ring.overflow_count);
+                break;
+#endif
             default:
-            {
-                g_pc_temp_buffer[g_pc_counter_var++] = (uint8_t ) p_args->data;
                 break;
-            }
         }
     }
 }
 
+/*****************************************************************************************************************
+ *  @brief      UART PC callback
+ *  @param[in]  p_args
+ *  @retval     None
+ ****************************************************************************************************************/
+void uart_pc_callback(uart_callback_args_t *p_args)
+{
+    PERF_REGION_BEGIN(PERF_REGION_PC_CALLBACK);
+
+    /* Logged the event in global variable */
+    g_pc_uart_event = (uint8_t)p_args->event;
+
+    /* Start the next queued message once the previous one is on the wire */
+    uart_tx_queue_event(&g_pc_tx_queue, p_args->event);
+
+    /* Only store the bytes here, line handling happens in uart_pc_com() */
+    if (UART_EVENT_RX_BLOCK == p_args->event)
+    {
+        uart_rx_ring_write(&g_pc_rx_ring, p_args->p_data, p_args->length);
+        bridge_event_set(BRIDGE_EVENT_PC_RX);
+    }
+    else if(UART_EVENT_RX_CHAR == p_args->event)
+    {
+        uart_rx_ring_put(&g_pc_rx_ring, (uint8_t) p_args->data);
+        bridge_event_set(BRIDGE_EVENT_PC_RX);
+    }
+
+#if UART_PC_CUT_THROUGH && !UART_PC_FRAMED
+    /* Part of the line may already be at the talk board, have it cancelled */
+    if (RESET_VALUE != (p_args->event & UART_PC_ERROR_EVENTS))
+    {
+        uart_cut_through_error(&g_pc_cut_through);
+    }
+#endif
+
+#if UART_PC_BAUD_NEGOTIATION
+    /* Framing errors right after a switch mean the two sides disagree on the rate */
+    if (RESET_VALUE != (p_args->event & UART_PC_ERROR_EVENTS))
+    {
+        uart_baud_error(&g_pc_baud);
+    }
+#endif
+
+    PERF_REGION_END(PERF_REGION_PC_CALLBACK);
+}
+
+/*****************************************************************************************************************
+ *  @brief      DMAC callback for the PC channel, raised at every half of the landing buffer
+ *  @param[in]  p_args
+ *  @retval     None
+ ****************************************************************************************************************/
+void uart_pc_rx_dmac_callback(transfer_callback_args_t *p_args)
+{
+    FSP_PARAMETER_NOT_USED(p_args);
+
+#if (UART_PC_RX_MODE_DMAC == UART_PC_RX_MODE)
+    uart_rx_dmac_event(&g_pc_rx_dmac);
+    bridge_event_set(BRIDGE_EVENT_PC_RX);
+#endif
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup r_sci_uart_pc)
  **********************************************************************************************************************/
@@ -18,6 +18,33 @@
 #define NINE_ASCII                (57u)     /* ASCII value for nine */
 #define DATA_LENGTH               (4u)      /* Expected Input Data length */
 #define MAX_RCVLENGTH             (8u)
+#define UART_PC_RX_MODE_ISR       (0)       /* RXI interrupt per FIFO fill */
+#define UART_PC_RX_MODE_DTC       (1)       /* DTC copies received bytes, main loop follows the destination */
+#define UART_PC_RX_MODE_DMAC      (2)       /* DMAC circular buffer with half/full events and idle timeout */
+/* Receive path of the PC channel. In the DMAC mode:
+ * - The DMAC moves one byte per SCI2 RXI, so uart_pc_init() opens SCI2 with a receive FIFO trigger of one byte,
+ *   whatever the configuration sets for the other modes.
+ * - There is no idle interrupt. A line shorter than half the landing buffer is handed over when the main loop
+ *   sees the DMAC position still for UART_RX_DMAC_IDLE_US, measured with the cycle counter. The main loop
+ *   sleeps between its passes and the bytes do not wake it, the BRIDGE_EVENT_TICK_US tick does. A line is
+ *   therefore handed over at the latest two ticks after its last byte. */
+#define UART_PC_RX_MODE           (UART_PC_RX_MODE_DMAC)
+#define UART_PC_CUT_THROUGH       (0)       /* 1: forward bytes to the talk board before the carriage return */
+#define UART_PC_SPEECH_QUEUE      (1)       /* 1: queue phrases until the talk board prompt, ignored with cut-through */
+#define UART_PC_FRAMED            (0)       /* 1: length, sequence number and CRC framed protocol instead of CR
+                                             *    terminated lines, see uart_frame.h. Overrides cut-through. */
+#define UART_PC_BAUD_NEGOTIATION  (1)       /* 1: "@B<rate>" lines switch the PC channel rate, see uart_baud.h.
+                                             *    Not available with cut-through. */
+#define UART_PC_TEXT_CHECK        (1)       /* 1: drop lines holding control or non-ASCII bytes, see uart_text.h */
+#define UART_PC_TEXT_REJECT       ("T\r")   /* Answer to a line dropped on its text, not worth sending again.
+                                             * Distinct from the 'R' of a full queue, which is. */
+#define UART_PC_OVERFLOW_REJECT   ("R\r")   /* Answer to a line cut by a receive overflow or longer than a slot */
+#define UART_PC_PHRASE_CACHE      (1)       /* 1: learn the lines sent and speak them again on "@C<hash><len>", see
+                                             *    phrase_cache.h. Not available with cut-through. */
+#define UART_PC_SCRIPT            (1)       /* 1: "@S" ... "@E" uploads a narration that is spoken sentence by
+                                             *    sentence, see speech_script.h. Needs the utterance queue, not
+                                             *    available with cut-through. The ring is 16 KB of SRAM, or 1 MB
+                                             *    of the SDRAM on a board that has one and BSP_CFG_SDRAM_ENABLED. */
 #define UART_PC_ERROR_EVENTS      ( UART_EVENT_BREAK_DETECT | \
                                     UART_EVENT_ERR_OVERFLOW | \
                                     UART_EVENT_ERR_FRAMING  | \
@@ -0,0 +1,174 @@
+/***********************************************************************************************************************
+ * File Name    : uart_rx_dmac.c
+ * Description  : Contains the DMAC driven UART receive path.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "uart_rx_dmac.h"
+#include "bridge_event.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_rx_dmac
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define UART_RX_DMAC_MASK           (UART_RX_DMAC_SIZE - 1u)
+#define UART_RX_DMAC_CYCLES_PER_US  (SystemCoreClock / 1000000u)
+
+/*
+ * Private function declarations
+ */
+static uint32_t uart_rx_dmac_head(uart_rx_dmac_t * p_rx);
+
+/*****************************************************************************************************************
+ *  @brief       Open the DMAC instance and start filling the landing buffer. The instance must be configured for
+ *               repeat mode from the channel RDR with UART_RX_DMAC_HALF transfers per repeat.
+ *  @param[in]   p_rx          Receive path to start
+ *  @param[in]   p_transfer    DMAC instance linked to the channel RXI
+ *  @retval      FSP_SUCCESS   Upon success
+ *  @retval      Any Other Error code apart from FSP_SUCCESS  Unsuccessful open or reset
+ ****************************************************************************************************************/
+fsp_err_t uart_rx_dmac_start(uart_rx_dmac_t * p_rx, transfer_instance_t const * p_transfer)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    p_rx->p_transfer  = p_transfer;
+    p_rx->event_count = RESET_VALUE;
+    p_rx->seen_events = RESET_VALUE;
+    p_rx->tail        = RESET_VALUE;
+    p_rx->last_head   = RESET_VALUE;
+
+    /* The idle timeout is measured with the DWT cycle counter */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+    p_rx->idle_cycles = UART_RX_DMAC_IDLE_US * UART_RX_DMAC_CYCLES_PER_US;
+    p_rx->last_move   = bridge_event_cycles();
+
+    err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+    if (FSP_SUCCESS != err)
+    {
+        return err;
+    }
+
+    /* Point the channel at the landing buffer and enable it */
+    return p_transfer->p_api->reset(p_transfer->p_ctrl, NULL, p_rx->buffer, UART_RX_DMAC_REPEATS);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Record a half or full buffer event. Call from the DMAC callback. After the last repeat the channel
+ *               stops, so it is pointed back at the start of the landing buffer here.
+ *  @param[in]   p_rx      Receive path
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_rx_dmac_event(uart_rx_dmac_t * p_rx)
+{
+    transfer_properties_t info = {RESET_VALUE};
+
+    p_rx->event_count++;
+
+    p_rx->p_transfer->p_api->infoGet(p_rx->p_transfer->p_ctrl, &info);
+    if (RESET_VALUE == info.block_count_remaining)
+    {
+        /* Transfer end. Requests raised meanwhile stay latched in the DMAC and the SCI FIFO holds the bytes. */
+        p_rx->p_transfer->p_api->reset(p_rx->p_transfer->p_ctrl, NULL, p_rx->buffer, UART_RX_DMAC_REPEATS);
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Hand the bytes the DMAC stored to a receive ring when a half or full event was raised or the line
+ *               has been idle for UART_RX_DMAC_IDLE_US. When UART_RX_DMAC_SIZE bytes or more arrived since the last
+ *               hand over, the DMAC has written over bytes not handed over yet: they are all dropped and counted as
+ *               a ring overflow.
+ *  @param[in]   p_rx      Receive path
+ *  @param[in]   p_ring    Ring the bytes are written to
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_rx_dmac_poll(uart_rx_dmac_t * p_rx, uart_rx_ring_t * p_ring)
+{
+    /* Events first: every event counted has its half already behind the position read next */
+    uint32_t events = p_rx->event_count;
+    uint32_t head   = uart_rx_dmac_head(p_rx);
+    uint32_t now    = bridge_event_cycles();
+    uint32_t tail   = p_rx->tail;
+
+    if (head != p_rx->last_head)
+    {
+        /* Still receiving, restart the idle timeout */
+        p_rx->last_head = head;
+        p_rx->last_move = now;
+    }
+
+    if ((events == p_rx->seen_events) && ((now - p_rx->last_move) < p_rx->idle_cycles))
+    {
+        return;
+    }
+
+    /* The new bytes cross this many half boundaries, each one raises an event. An event more means the DMAC went
+     * round the buffer at least once since the last hand over, which the offsets alone cannot show. One event may
+     * still be pending when the DMAC has just crossed a boundary, so up to one less is normal. */
+    uint32_t length    = (head - tail) & UART_RX_DMAC_MASK;
+    uint32_t crossed   = ((tail & (UART_RX_DMAC_HALF - 1u)) + length) / UART_RX_DMAC_HALF;
+    int32_t  excess    = (int32_t) (events - p_rx->seen_events - crossed);
+    uint32_t lost_laps = (excess > 0) ? (((uint32_t) excess + 1u) / 2u) : RESET_VALUE;
+
+    /* Count the events of the laps too, a pending one is then taken as already counted */
+    p_rx->seen_events += crossed + (lost_laps * UART_RX_DMAC_REPEATS);
+    if (RESET_VALUE != lost_laps)
+    {
+        /* What the buffer holds is not what followed the last hand over */
+        uart_rx_ring_drop(p_ring, (lost_laps * UART_RX_DMAC_SIZE) + length);
+        p_rx->tail = head & UART_RX_DMAC_MASK;
+        return;
+    }
+
+    if (RESET_VALUE == length)
+    {
+        return;
+    }
+
+    /* The lines are stamped with the poll that last saw the DMAC move, not with the handover, which comes
+     * UART_RX_DMAC_IDLE_US later for a line that ends a burst */
+    if (head < tail)
+    {
+        /* Wrapped, hand over the end of the buffer first */
+        uart_rx_ring_write_at(p_ring, &p_rx->buffer[tail], UART_RX_DMAC_SIZE - tail, p_rx->last_move);
+        tail = RESET_VALUE;
+    }
+
+    uart_rx_ring_write_at(p_ring, &p_rx->buffer[tail], head - tail, p_rx->last_move);
+    p_rx->tail = head & UART_RX_DMAC_MASK;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Work out how far into the landing buffer the DMAC has written.
+ *  @param[in]   p_rx      Receive path
+ *  @retval      Offset of the next byte the DMAC writes, UART_RX_DMAC_SIZE once the last repeat has ended
+ ****************************************************************************************************************/
+static uint32_t uart_rx_dmac_head(uart_rx_dmac_t * p_rx)
+{
+    transfer_properties_t first  = {RESET_VALUE};
+    transfer_properties_t second = {RESET_VALUE};
+
+    /* The repeat count and the count within the repeat are separate registers. A repeat end between the two reads
+     * shows as a changed repeat count in the second sample, so read again until both agree. */
+    do
+    {
+        p_rx->p_transfer->p_api->infoGet(p_rx->p_transfer->p_ctrl, &first);
+        p_rx->p_transfer->p_api->infoGet(p_rx->p_transfer->p_ctrl, &second);
+    } while (first.block_count_remaining != second.block_count_remaining);
+
+    if (RESET_VALUE == first.block_count_remaining)
+    {
+        return UART_RX_DMAC_SIZE;
+    }
+
+    return ((UART_RX_DMAC_REPEATS - first.block_count_remaining) * UART_RX_DMAC_HALF) +
+           (UART_RX_DMAC_HALF - first.transfer_length_remaining);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_rx_dmac)
+ **********************************************************************************************************************/
@@ -0,0 +1,39 @@
+/***********************************************************************************************************************
+ * File Name    : uart_rx_dmac.h
+ * Description  : Contains data structures and function declarations of uart_rx_dmac.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_RX_DMAC_H_
+#define UART_RX_DMAC_H_
+
+#include "hal_data.h"
+#include "uart_rx_ring.h"
+
+/* Macro definition */
+#define UART_RX_DMAC_SIZE         (1024u)   /* Circular landing buffer, power of two */
+#define UART_RX_DMAC_HALF         (UART_RX_DMAC_SIZE / 2u)    /* DMAC repeat size, one event per half */
+#define UART_RX_DMAC_REPEATS      (2u)      /* Repeats until the transfer end event re-arms the channel */
+#define UART_RX_DMAC_IDLE_US      (200u)    /* Quiet time after which a partial half is handed over */
+
+/* Receive path where the DMAC copies every byte from RDR into a circular buffer. The DMAC interrupts the CPU once
+ * per half buffer. The main loop hands new bytes to a receive ring on those events, or when the line has been quiet
+ * for UART_RX_DMAC_IDLE_US, so short commands are not held back until a half fills. The quiet time is polled, no
+ * interrupt marks it; see UART_PC_RX_MODE for what that means for the latency. */
+typedef struct st_uart_rx_dmac
+{
+    transfer_instance_t const * p_transfer;                   /* DMAC instance linked to the channel RXI */
+    uint8_t                     buffer[UART_RX_DMAC_SIZE];    /* Landing buffer filled by the DMAC */
+    volatile uint32_t           event_count;                  /* Half and full events raised by the DMAC */
+    uint32_t                    seen_events;                  /* Events of the bytes handed over or dropped */
+    uint32_t                    tail;                         /* Next landing buffer offset to hand over */
+    uint32_t                    last_head;                    /* DMAC position seen by the previous poll */
+    uint32_t                    last_move;                    /* Cycle counter when the position last changed */
+    uint32_t                    idle_cycles;                  /* UART_RX_DMAC_IDLE_US in CPU cycles */
+} uart_rx_dmac_t;
+
+/* Function declaration */
+fsp_err_t uart_rx_dmac_start(uart_rx_dmac_t * p_rx, transfer_instance_t const * p_transfer);
+void uart_rx_dmac_event(uart_rx_dmac_t * p_rx);
+void uart_rx_dmac_poll(uart_rx_dmac_t * p_rx, uart_rx_ring_t * p_ring);
+
+#endif /* UART_RX_DMAC_H_ */
@@ -0,0 +1,138 @@
+/***********************************************************************************************************************
+ * File Name    : uart_rx_dtc.c
+ * Description  : Contains the DTC driven UART receive path.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "uart_rx_dtc.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_rx_dtc
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define UART_RX_DTC_MASK          (UART_RX_DTC_SIZE - 1u)
+#define UART_RX_DTC_RECEIVE       (0u)      /* Transfer index of the receive transfer */
+#define UART_RX_DTC_LAP           (1u)      /* Transfer index of the lap count transfer */
+
+/* Repeat transfer from the fixed RDR address into the landing buffer. The destination wraps after
+ * UART_RX_DTC_SIZE bytes and the DTC never interrupts the CPU. Every time the repeat count runs out, at the
+ * wrap, the lap count transfer is chained. */
+#define UART_RX_DTC_SETTINGS      ((TRANSFER_MODE_REPEAT << TRANSFER_SETTINGS_MODE_BITS) |                 \
+                                   (TRANSFER_SIZE_1_BYTE << TRANSFER_SETTINGS_SIZE_BITS) |                 \
+                                   (TRANSFER_ADDR_MODE_FIXED << TRANSFER_SETTINGS_SRC_ADDR_BITS) |         \
+                                   (TRANSFER_CHAIN_MODE_END << TRANSFER_SETTINGS_CHAIN_MODE_BITS) |        \
+                                   (TRANSFER_IRQ_END << TRANSFER_SETTINGS_IRQ_BITS) |                      \
+                                   (TRANSFER_REPEAT_AREA_DESTINATION << TRANSFER_SETTINGS_REPEAT_AREA_BITS) | \
+                                   (TRANSFER_ADDR_MODE_INCREMENTED << TRANSFER_SETTINGS_DEST_ADDR_BITS))
+
+/* Lap count transfer. It moves one byte per wrap and its source walks through a UART_RX_DTC_SIZE byte area, so
+ * the source offset the DTC writes back counts the laps. Any readable area does, the landing buffer is used. */
+#define UART_RX_DTC_LAP_SETTINGS  ((TRANSFER_MODE_REPEAT << TRANSFER_SETTINGS_MODE_BITS) |                 \
+                                   (TRANSFER_SIZE_1_BYTE << TRANSFER_SETTINGS_SIZE_BITS) |                 \
+                                   (TRANSFER_ADDR_MODE_INCREMENTED << TRANSFER_SETTINGS_SRC_ADDR_BITS) |   \
+                                   (TRANSFER_IRQ_END << TRANSFER_SETTINGS_IRQ_BITS) |                      \
+                                   (TRANSFER_REPEAT_AREA_SOURCE << TRANSFER_SETTINGS_REPEAT_AREA_BITS) |   \
+                                   (TRANSFER_ADDR_MODE_FIXED << TRANSFER_SETTINGS_DEST_ADDR_BITS))
+
+/*****************************************************************************************************************
+ *  @brief       Switch an opened UART channel to DTC reception. The SCI driver must have opened the transfer instance
+ *               given as p_transfer_rx, so the source already points to the channel RDR.
+ *  @param[in]   p_rx          Receive path to start
+ *  @param[in]   p_transfer    DTC instance hooked to the channel RXI
+ *  @retval      FSP_SUCCESS   Upon success
+ *  @retval      Any Other Error code apart from FSP_SUCCESS  Unsuccessful reconfigure
+ ****************************************************************************************************************/
+fsp_err_t uart_rx_dtc_start(uart_rx_dtc_t * p_rx, transfer_instance_t const * p_transfer)
+{
+    transfer_info_t * p_receive = &p_rx->info[UART_RX_DTC_RECEIVE];
+    transfer_info_t * p_lap     = &p_rx->info[UART_RX_DTC_LAP];
+
+    p_rx->p_transfer = p_transfer;
+    p_rx->tail       = RESET_VALUE;
+    p_rx->lap        = RESET_VALUE;
+
+    p_receive->transfer_settings_word = UART_RX_DTC_SETTINGS;
+    p_receive->p_src                  = p_transfer->p_cfg->p_info->p_src;
+    p_receive->p_dest                 = p_rx->buffer;
+    p_receive->num_blocks             = RESET_VALUE;
+    p_receive->length                 = UART_RX_DTC_SIZE;
+
+    p_lap->transfer_settings_word = UART_RX_DTC_LAP_SETTINGS;
+    p_lap->p_src                  = p_rx->buffer;
+    p_lap->p_dest                 = &p_rx->lap_sink;
+    p_lap->num_blocks             = RESET_VALUE;
+    p_lap->length                 = UART_RX_DTC_SIZE;
+
+    /* Replaces the normal mode transfer set up by the SCI driver and enables it */
+    return p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_rx->info);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Hand the bytes the DTC stored since the last call to a receive ring. When UART_RX_DTC_SIZE bytes or
+ *               more arrived since the last call, the DTC has written over bytes not handed over yet: they are all
+ *               dropped and counted as a ring overflow.
+ *  @param[in]   p_rx      Receive path
+ *  @param[in]   p_ring    Ring the bytes are written to
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_rx_dtc_poll(uart_rx_dtc_t * p_rx, uart_rx_ring_t * p_ring)
+{
+    /* The DTC writes the pointers back after every transfer, they must be read from memory every time */
+    transfer_info_t volatile const * p_info = p_rx->info;
+    uint8_t const * p_lap_src = NULL;
+    uint8_t const * p_dest    = NULL;
+
+    /* A wrap writes the receive destination back, then the chained lap count. The two belong together when the
+     * lap count did not move while the destination was read. At the buffer start the lap count of the wrap may
+     * still be on its way, the DTC is left to finish first. */
+    do
+    {
+        p_lap_src = p_info[UART_RX_DTC_LAP].p_src;
+        __DMB();
+        p_dest = p_info[UART_RX_DTC_RECEIVE].p_dest;
+        if (p_dest == p_rx->buffer)
+        {
+            FSP_HARDWARE_REGISTER_WAIT(R_DTC->DTCSTS_b.ACT, 0U);
+        }
+        __DMB();
+    } while (p_lap_src != p_info[UART_RX_DTC_LAP].p_src);
+
+    uint32_t head  = (uint32_t) (p_dest - p_rx->buffer) & UART_RX_DTC_MASK;
+    uint32_t lap   = (uint32_t) (p_lap_src - p_rx->buffer) & UART_RX_DTC_MASK;
+    uint32_t tail  = p_rx->tail;
+    uint32_t wraps = (head < tail) ? 1u : 0u;
+
+    /* Laps beyond the wrap the offsets show */
+    uint32_t lost_laps = (lap - p_rx->lap - wraps) & UART_RX_DTC_MASK;
+    p_rx->lap = lap;
+    if (RESET_VALUE != lost_laps)
+    {
+        /* The buffer went round at least once more, what it holds is not what followed the last call */
+        uart_rx_ring_drop(p_ring, (lost_laps * UART_RX_DTC_SIZE) + ((head - tail) & UART_RX_DTC_MASK));
+        p_rx->tail = head;
+        return;
+    }
+
+    if (head == tail)
+    {
+        return;
+    }
+
+    if (head < tail)
+    {
+        /* Wrapped, hand over the end of the buffer first */
+        uart_rx_ring_write(p_ring, &p_rx->buffer[tail], UART_RX_DTC_SIZE - tail);
+        tail = RESET_VALUE;
+    }
+
+    uart_rx_ring_write(p_ring, &p_rx->buffer[tail], head - tail);
+    p_rx->tail = head;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_rx_dtc)
+ **********************************************************************************************************************/
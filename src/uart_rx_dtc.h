@@ -0,0 +1,33 @@
+/***********************************************************************************************************************
+ * File Name    : uart_rx_dtc.h
+ * Description  : Contains data structures and function declarations of uart_rx_dtc.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_RX_DTC_H_
+#define UART_RX_DTC_H_
+
+#include "hal_data.h"
+#include "uart_rx_ring.h"
+
+/* Macro definition */
+#define UART_RX_DTC_SIZE          (256u)    /* Circular landing buffer, limited by the 8-bit DTC repeat count */
+
+/* Receive path where the DTC copies every byte from RDR into a circular buffer without CPU involvement.
+ * The main loop follows the DTC destination pointer and hands new bytes to a receive ring. A second transfer,
+ * chained at every wrap of the buffer, counts the laps so a poll that comes too late is detected. */
+typedef struct st_uart_rx_dtc
+{
+    transfer_instance_t const * p_transfer;                   /* DTC instance on the channel RXI */
+    transfer_info_t             info[2];                      /* Receive and lap count transfers, written back by
+                                                               * the DTC */
+    uint8_t                     buffer[UART_RX_DTC_SIZE];     /* Landing buffer filled by the DTC */
+    uint8_t                     lap_sink;                     /* Destination of the lap count transfer */
+    uint32_t                    tail;                         /* Next landing buffer offset to hand over */
+    uint32_t                    lap;                          /* Wraps of the buffer handed over, modulo its size */
+} uart_rx_dtc_t;
+
+/* Function declaration */
+fsp_err_t uart_rx_dtc_start(uart_rx_dtc_t * p_rx, transfer_instance_t const * p_transfer);
+void uart_rx_dtc_poll(uart_rx_dtc_t * p_rx, uart_rx_ring_t * p_ring);
+
+#endif /* UART_RX_DTC_H_ */
@@ -0,0 +1,356 @@
+/***********************************************************************************************************************
+ * File Name    : uart_rx_ring.c
+ * Description  : Contains the lock-free UART receive ring with line indexing.
+ **********************************************************************************************************************/
+
+#include <string.h>
+#include "uart_rx_ring.h"
+#include "bridge_event.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_rx_ring
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#ifndef RESET_VALUE
+#define RESET_VALUE               (0x00)    /* common_utils.h is not included so the file also builds on the PC */
+#endif
+#define UART_RX_RING_MASK         (UART_RX_RING_SIZE - 1u)
+#define UART_RX_LINE_MASK         (UART_RX_LINE_DEPTH - 1u)
+
+/* Indices shared between the ISR and the main loop are published with release and observed with acquire */
+#define UART_RX_LOAD_ACQUIRE(x)       (__atomic_load_n(&(x), __ATOMIC_ACQUIRE))
+#define UART_RX_STORE_RELEASE(x, v)   (__atomic_store_n(&(x), (v), __ATOMIC_RELEASE))
+
+/*
+ * Private function declarations
+ */
+static void uart_rx_ring_store(uart_rx_ring_t * p_ring, uint8_t data, uint32_t cycles);
+static void uart_rx_ring_line_publish(uart_rx_ring_t * p_ring, uint32_t line_head, uint32_t end, bool overflow,
+                                      uint32_t cycles);
+
+/*****************************************************************************************************************
+ *  @brief       Initialize a receive ring
+ *  @param[in]   p_ring       Ring to initialize
+ *  @param[in]   delimiter    Byte that terminates a line, UART_RX_NO_DELIMITER when the ring carries no lines
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_rx_ring_init(uart_rx_ring_t * p_ring, uint32_t delimiter)
+{
+    p_ring->head             = RESET_VALUE;
+    p_ring->tail             = RESET_VALUE;
+    p_ring->line_head        = RESET_VALUE;
+    p_ring->line_tail        = RESET_VALUE;
+    p_ring->overflow_count   = RESET_VALUE;
+    p_ring->delimiter        = delimiter;
+    p_ring->overflow_pending = false;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Store one received byte. Producer side, call from the RX ISR callback only.
+ *  @param[in]   p_ring    Receive ring
+ *  @param[in]   data      Received byte
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_rx_ring_put(uart_rx_ring_t * p_ring, uint8_t data)
+{
+    uart_rx_ring_store(p_ring, data, bridge_event_cycles());
+}
+
+/*****************************************************************************************************************
+ *  @brief       Store a block of received bytes. Producer side, for producers that receive in bulk and for
+ *               UART_EVENT_RX_BLOCK callbacks.
+ *  @param[in]   p_ring    Receive ring
+ *  @param[in]   p_data    Received bytes
+ *  @param[in]   length    Number of bytes
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_rx_ring_write(uart_rx_ring_t * p_ring, uint8_t const * p_data, uint32_t length)
+{
+    uart_rx_ring_write_at(p_ring, p_data, length, bridge_event_cycles());
+}
+
+/*****************************************************************************************************************
+ *  @brief       Store a block of received bytes that arrived before it is handed over, as a DMAC buffer drained
+ *               once the line went idle. Producer side only.
+ *  @param[in]   p_ring    Receive ring
+ *  @param[in]   p_data    Received bytes
+ *  @param[in]   length    Number of bytes
+ *  @param[in]   cycles    bridge_event_cycles() when the last byte arrived, stamped on the lines of the block
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_rx_ring_write_at(uart_rx_ring_t * p_ring, uint8_t const * p_data, uint32_t length, uint32_t cycles)
+{
+    uint32_t head      = p_ring->head;
+    uint32_t line_head = p_ring->line_head;
+    uint32_t ring_free = UART_RX_RING_SIZE - (head - UART_RX_LOAD_ACQUIRE(p_ring->tail));
+    uint32_t line_free = UART_RX_LINE_DEPTH - (line_head - UART_RX_LOAD_ACQUIRE(p_ring->line_tail));
+    uint32_t line_end[UART_RX_LINE_DEPTH];
+    uint32_t lines     = RESET_VALUE;
+
+    /* Find the delimiters with memchr. The block goes in with one copy when the ring and the line table take all
+     * of it, leaving one line entry spare so a full table never drops the bytes after the last delimiter. */
+    if ((length <= ring_free) && (UART_RX_NO_DELIMITER != p_ring->delimiter))
+    {
+        uint8_t const * p_scan = p_data;
+        uint8_t const * p_end  = p_data + length;
+
+        while ((lines < line_free) && (p_scan < p_end) &&
+               (NULL != (p_scan = memchr(p_scan, (int) p_ring->delimiter, (size_t) (p_end - p_scan)))))
+        {
+            p_scan++;
+            line_end[lines++] = head + (uint32_t) (p_scan - p_data);
+        }
+    }
+
+    if ((length > ring_free) || (lines >= line_free))
+    {
+        /* Overflow handling is done per byte */
+        for (uint32_t i = RESET_VALUE; i < length; i++)
+        {
+            uart_rx_ring_store(p_ring, p_data[i], cycles);
+        }
+        return;
+    }
+
+    uint32_t index = head & UART_RX_RING_MASK;
+    uint32_t first = ((UART_RX_RING_SIZE - index) < length) ? (UART_RX_RING_SIZE - index) : length;
+
+    memcpy(&p_ring->buffer[index], p_data, first);
+    memcpy(&p_ring->buffer[0], p_data + first, length - first);
+    UART_RX_STORE_RELEASE(p_ring->head, head + length);
+
+    /* Lines are published after their bytes, as in uart_rx_ring_put(). The block arrived at once, its lines
+     * share one time stamp. */
+    for (uint32_t i = RESET_VALUE; i < lines; i++)
+    {
+        p_ring->line_end[(line_head + i) & UART_RX_LINE_MASK]      = line_end[i];
+        p_ring->line_cycles[(line_head + i) & UART_RX_LINE_MASK]   = cycles;
+        p_ring->line_overflow[(line_head + i) & UART_RX_LINE_MASK] = false;
+    }
+    if (RESET_VALUE != lines)
+    {
+        /* Only the first line can hold bytes from before a loss */
+        p_ring->line_overflow[line_head & UART_RX_LINE_MASK] = p_ring->overflow_pending;
+        p_ring->overflow_pending = false;
+    }
+    UART_RX_STORE_RELEASE(p_ring->line_head, line_head + lines);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Count bytes lost before they reached the ring, by a producer that receives in bulk. The line being
+ *               received is marked as overflowed. Producer side only.
+ *  @param[in]   p_ring    Receive ring
+ *  @param[in]   length    Number of bytes lost
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_rx_ring_drop(uart_rx_ring_t * p_ring, uint32_t length)
+{
+    p_ring->overflow_count  += length;
+    p_ring->overflow_pending = true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Number of complete lines waiting for the consumer
+ *  @param[in]   p_ring    Receive ring
+ *  @retval      Line count
+ ****************************************************************************************************************/
+uint32_t uart_rx_ring_lines_available(uart_rx_ring_t const * p_ring)
+{
+    return UART_RX_LOAD_ACQUIRE(p_ring->line_head) - p_ring->line_tail;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Time the delimiter of the oldest complete line was stored. Consumer side only, call before
+ *               uart_rx_ring_line_get() while uart_rx_ring_lines_available() is not 0.
+ *  @param[in]   p_ring    Receive ring
+ *  @retval      DWT cycle count
+ ****************************************************************************************************************/
+uint32_t uart_rx_ring_line_cycles(uart_rx_ring_t const * p_ring)
+{
+    return p_ring->line_cycles[p_ring->line_tail & UART_RX_LINE_MASK];
+}
+
+/*****************************************************************************************************************
+ *  @brief       Whether the oldest complete line lost bytes to a full ring or line table. Such a line is a piece of
+ *               what was sent, closed early or missing its start. Consumer side only, call before
+ *               uart_rx_ring_line_get() while uart_rx_ring_lines_available() is not 0.
+ *  @param[in]   p_ring    Receive ring
+ *  @retval      true when the line is incomplete
+ ****************************************************************************************************************/
+bool uart_rx_ring_line_overflow(uart_rx_ring_t const * p_ring)
+{
+    return p_ring->line_overflow[p_ring->line_tail & UART_RX_LINE_MASK];
+}
+
+/*****************************************************************************************************************
+ *  @brief       Copy the oldest complete line, delimiter included, and release it. Consumer side only.
+ *               A line longer than dest_size - 1 is cut in the middle: its start and its last byte are copied, so
+ *               the delimiter is kept. The copy is NUL terminated. Copying frees the ring space right away, whatever
+ *               the destination is then used for; see g_pc_line_pool in uart_pc.c.
+ *  @param[in]   p_ring       Receive ring
+ *  @param[out]  p_dest       Destination buffer, at least 2 bytes
+ *  @param[in]   dest_size    Destination buffer size in bytes
+ *  @param[out]  p_length     Number of bytes copied, terminator excluded
+ *  @retval      FSP_SUCCESS            A line was copied
+ *  @retval      FSP_ERR_OVERFLOW       A line was copied cut, it does not fit the destination
+ *  @retval      FSP_ERR_BUFFER_EMPTY   No complete line is available
+ ****************************************************************************************************************/
+fsp_err_t uart_rx_ring_line_get(uart_rx_ring_t * p_ring, uint8_t * p_dest, uint32_t dest_size, uint32_t * p_length)
+{
+    uint32_t line_tail = p_ring->line_tail;
+
+    if (UART_RX_LOAD_ACQUIRE(p_ring->line_head) == line_tail)
+    {
+        return FSP_ERR_BUFFER_EMPTY;
+    }
+
+    uint32_t  tail   = p_ring->tail;
+    uint32_t  end    = p_ring->line_end[line_tail & UART_RX_LINE_MASK];
+    uint32_t  length = end - tail;
+    fsp_err_t err    = FSP_SUCCESS;
+
+    if (length > (dest_size - 1u))
+    {
+        /* Keep room for the last byte, the caller tells a line that ended from a piece by it */
+        length = dest_size - 2u;
+        p_dest[length] = p_ring->buffer[(end - 1u) & UART_RX_RING_MASK];
+        err = FSP_ERR_OVERFLOW;
+    }
+
+    /* Copy in at most two pieces around the wrap point */
+    uint32_t offset = tail & UART_RX_RING_MASK;
+    uint32_t first  = UART_RX_RING_SIZE - offset;
+    if (first > length)
+    {
+        first = length;
+    }
+    memcpy(p_dest, &p_ring->buffer[offset], first);
+    memcpy(&p_dest[first], &p_ring->buffer[0], length - first);
+    if (FSP_ERR_OVERFLOW == err)
+    {
+        length++;
+    }
+    p_dest[length] = RESET_VALUE;
+
+    /* Release the whole line, truncated bytes included */
+    UART_RX_STORE_RELEASE(p_ring->tail, end);
+    UART_RX_STORE_RELEASE(p_ring->line_tail, line_tail + 1u);
+
+    *p_length = length;
+    return err;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Get the received bytes from the read position up to the wrap point, complete line or not.
+ *               Consumer side only. The bytes stay in the ring until uart_rx_ring_consume() is called.
+ *  @param[in]   p_ring     Receive ring
+ *  @param[out]  pp_data    First unread byte
+ *  @retval      Number of contiguous bytes readable at *pp_data
+ ****************************************************************************************************************/
+uint32_t uart_rx_ring_peek(uart_rx_ring_t const * p_ring, uint8_t const ** pp_data)
+{
+    uint32_t tail   = p_ring->tail;
+    uint32_t length = UART_RX_LOAD_ACQUIRE(p_ring->head) - tail;
+    uint32_t offset = tail & UART_RX_RING_MASK;
+
+    if (length > (UART_RX_RING_SIZE - offset))
+    {
+        length = UART_RX_RING_SIZE - offset;
+    }
+
+    *pp_data = &p_ring->buffer[offset];
+    return length;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Release bytes returned by uart_rx_ring_peek(). Lines that end inside the released bytes are
+ *               released with them. Consumer side only.
+ *  @param[in]   p_ring     Receive ring
+ *  @param[in]   length     Number of bytes to release
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_rx_ring_consume(uart_rx_ring_t * p_ring, uint32_t length)
+{
+    uint32_t tail      = p_ring->tail + length;
+    uint32_t line_tail = p_ring->line_tail;
+    uint32_t line_head = UART_RX_LOAD_ACQUIRE(p_ring->line_head);
+
+    while ((line_tail != line_head) && ((int32_t) (p_ring->line_end[line_tail & UART_RX_LINE_MASK] - tail) <= 0))
+    {
+        line_tail++;
+    }
+
+    UART_RX_STORE_RELEASE(p_ring->tail, tail);
+    UART_RX_STORE_RELEASE(p_ring->line_tail, line_tail);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Store one received byte. Producer side only.
+ *  @param[in]   p_ring    Receive ring
+ *  @param[in]   data      Received byte
+ *  @param[in]   cycles    Time stamp of the line the byte ends
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_rx_ring_store(uart_rx_ring_t * p_ring, uint8_t data, uint32_t cycles)
+{
+    uint32_t head      = p_ring->head;
+    uint32_t line_head = p_ring->line_head;
+    uint32_t line_tail = UART_RX_LOAD_ACQUIRE(p_ring->line_tail);
+
+    if ((line_head - line_tail) >= UART_RX_LINE_DEPTH)
+    {
+        /* Line table is full, the consumer has not caught up. The line being received loses this byte. */
+        p_ring->overflow_count++;
+        p_ring->overflow_pending = true;
+        return;
+    }
+
+    if ((head - UART_RX_LOAD_ACQUIRE(p_ring->tail)) >= UART_RX_RING_SIZE)
+    {
+        /* Ring is full. If it holds no complete line, close the pending bytes as one so the consumer can drain.
+         * Both that piece and the rest of the line, once its delimiter arrives, are marked as overflowed.
+         * A byte stream is drained with peek and needs no line. */
+        if ((UART_RX_NO_DELIMITER != p_ring->delimiter) && (line_head == line_tail))
+        {
+            uart_rx_ring_line_publish(p_ring, line_head, head, true, cycles);
+        }
+        p_ring->overflow_count++;
+        p_ring->overflow_pending = true;
+        return;
+    }
+
+    p_ring->buffer[head & UART_RX_RING_MASK] = data;
+    UART_RX_STORE_RELEASE(p_ring->head, head + 1u);
+
+    if (p_ring->delimiter == data)
+    {
+        uart_rx_ring_line_publish(p_ring, line_head, head + 1u, p_ring->overflow_pending, cycles);
+        p_ring->overflow_pending = false;
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Publish a line end. Producer side only.
+ *  @param[in]   p_ring       Receive ring
+ *  @param[in]   line_head    Line entry to fill
+ *  @param[in]   end          Ring index one past the last byte of the line
+ *  @param[in]   overflow     Bytes of the line were dropped
+ *  @param[in]   cycles       Time stamp of the line
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_rx_ring_line_publish(uart_rx_ring_t * p_ring, uint32_t line_head, uint32_t end, bool overflow,
+                                      uint32_t cycles)
+{
+    p_ring->line_end[line_head & UART_RX_LINE_MASK]      = end;
+    p_ring->line_cycles[line_head & UART_RX_LINE_MASK]   = cycles;
+    p_ring->line_overflow[line_head & UART_RX_LINE_MASK] = overflow;
+    UART_RX_STORE_RELEASE(p_ring->line_head, line_head + 1u);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_rx_ring)
+ **********************************************************************************************************************/
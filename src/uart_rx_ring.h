@@ -0,0 +1,48 @@
+/***********************************************************************************************************************
+ * File Name    : uart_rx_ring.h
+ * Description  : Contains data structures and function declarations of uart_rx_ring.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_RX_RING_H_
+#define UART_RX_RING_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bsp_api.h"
+
+/* Macro definition */
+#define UART_RX_RING_SIZE         (1024u)   /* Receive bytes buffered per channel, must be a power of two */
+#define UART_RX_LINE_DEPTH        (16u)     /* Complete lines buffered per channel, must be a power of two */
+#define UART_RX_NO_DELIMITER      (0x100u)  /* Delimiter that matches no byte, for byte streams read with peek */
+
+/* Single producer (RX ISR) / single consumer (main loop) receive ring with a side table of line ends.
+ * Indices run freely and are masked on access. */
+typedef struct st_uart_rx_ring
+{
+    uint8_t           buffer[UART_RX_RING_SIZE];      /* Received bytes */
+    uint32_t          line_end[UART_RX_LINE_DEPTH];   /* Ring index one past each delimiter */
+    uint32_t          line_cycles[UART_RX_LINE_DEPTH]; /* Cycle counter when each delimiter was stored */
+    bool              line_overflow[UART_RX_LINE_DEPTH]; /* Bytes of the line were dropped, or it was cut short */
+    volatile uint32_t head;                           /* Next byte to write (producer) */
+    volatile uint32_t tail;                           /* Next byte to read (consumer) */
+    volatile uint32_t line_head;                      /* Next line end to write (producer) */
+    volatile uint32_t line_tail;                      /* Next line end to read (consumer) */
+    volatile uint32_t overflow_count;                 /* Bytes dropped because the ring or line table was full */
+    uint32_t          delimiter;                      /* Byte that terminates a line, or UART_RX_NO_DELIMITER */
+    bool              overflow_pending;               /* Line being received lost bytes (producer) */
+} uart_rx_ring_t;
+
+/* Function declaration */
+void uart_rx_ring_init(uart_rx_ring_t * p_ring, uint32_t delimiter);
+void uart_rx_ring_put(uart_rx_ring_t * p_ring, uint8_t data);
+void uart_rx_ring_write(uart_rx_ring_t * p_ring, uint8_t const * p_data, uint32_t length);
+void uart_rx_ring_write_at(uart_rx_ring_t * p_ring, uint8_t const * p_data, uint32_t length, uint32_t cycles);
+void uart_rx_ring_drop(uart_rx_ring_t * p_ring, uint32_t length);
+uint32_t uart_rx_ring_lines_available(uart_rx_ring_t const * p_ring);
+uint32_t uart_rx_ring_line_cycles(uart_rx_ring_t const * p_ring);
+bool uart_rx_ring_line_overflow(uart_rx_ring_t const * p_ring);
+fsp_err_t uart_rx_ring_line_get(uart_rx_ring_t * p_ring, uint8_t * p_dest, uint32_t dest_size, uint32_t * p_length);
+uint32_t uart_rx_ring_peek(uart_rx_ring_t const * p_ring, uint8_t const ** pp_data);
+void uart_rx_ring_consume(uart_rx_ring_t * p_ring, uint32_t length);
+
+#endif /* UART_RX_RING_H_ */
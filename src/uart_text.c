@@ -0,0 +1,240 @@
+/***********************************************************************************************************************
+ * File Name    : uart_text.c
+ * Description  : Contains the text kernels of the bridge parser, Helium (MVE) with a scalar fallback.
+ **********************************************************************************************************************/
+
+#include "uart_text.h"
+
+#if UART_TEXT_USE_MVE
+ #include <arm_mve.h>
+#endif
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_text
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#ifndef RESET_VALUE
+ #define RESET_VALUE              (0x00)
+#endif
+#define UART_TEXT_CR              (0x0Du)
+#define UART_TEXT_LF              (0x0Au)
+#define UART_TEXT_FIRST_PRINTABLE (0x20u)
+#define UART_TEXT_LAST_PRINTABLE  (0x7Eu)
+#define UART_TEXT_DEL             (0x7Fu)
+#define UART_TEXT_FIRST_HIGH      (0x80u)
+#define UART_TEXT_LANES           (16u)     /* Bytes per Helium vector */
+
+/*
+ * Private function declarations
+ */
+static uint32_t uart_text_class_of(uint8_t data);
+
+/*****************************************************************************************************************
+ *  @brief       Find the first carriage return or line feed
+ *  @param[in]   p_data    Text to search
+ *  @param[in]   length    Number of bytes
+ *  @retval      Index of the first CR or LF, length when there is none
+ ****************************************************************************************************************/
+uint32_t uart_text_find_eol(uint8_t const * p_data, uint32_t length)
+{
+#if UART_TEXT_USE_MVE
+    for (uint32_t i = RESET_VALUE; i < length; i += UART_TEXT_LANES)
+    {
+        /* The tail predicate keeps the last load inside the buffer */
+        mve_pred16_t active = vctp8q(length - i);
+        uint8x16_t   text   = vldrbq_z_u8(&p_data[i], active);
+        mve_pred16_t hit    = (mve_pred16_t) ((vcmpeqq_n_u8(text, UART_TEXT_CR) | vcmpeqq_n_u8(text, UART_TEXT_LF)) &
+                                              active);
+
+        if (RESET_VALUE != hit)
+        {
+            /* One predicate bit per byte lane */
+            return i + (uint32_t) __builtin_ctz(hit);
+        }
+    }
+    return length;
+#else
+    return uart_text_find_eol_scalar(p_data, length);
+#endif
+}
+
+/*****************************************************************************************************************
+ *  @brief       Check that every byte is printable ASCII, 0x20 to 0x7E
+ *  @param[in]   p_data    Text to check, without its line end
+ *  @param[in]   length    Number of bytes
+ *  @retval      true when all bytes are printable
+ ****************************************************************************************************************/
+bool uart_text_printable(uint8_t const * p_data, uint32_t length)
+{
+#if UART_TEXT_USE_MVE
+    for (uint32_t i = RESET_VALUE; i < length; i += UART_TEXT_LANES)
+    {
+        mve_pred16_t active = vctp8q(length - i);
+        uint8x16_t   text   = vldrbq_z_u8(&p_data[i], active);
+
+        /* One unsigned compare covers both ends of the range */
+        uint8x16_t   offset = vsubq_n_u8(text, UART_TEXT_FIRST_PRINTABLE);
+        mve_pred16_t bad    = (mve_pred16_t) (vcmphiq_n_u8(offset, UART_TEXT_LAST_PRINTABLE - UART_TEXT_FIRST_PRINTABLE) &
+                                              active);
+
+        if (RESET_VALUE != bad)
+        {
+            return false;
+        }
+    }
+    return true;
+#else
+    return uart_text_printable_scalar(p_data, length);
+#endif
+}
+
+/*****************************************************************************************************************
+ *  @brief       Collect the character classes present in a text
+ *  @param[in]   p_data    Text to classify
+ *  @param[in]   length    Number of bytes
+ *  @retval      UART_TEXT_CLASS_x bits of every class found
+ ****************************************************************************************************************/
+uint32_t uart_text_classify(uint8_t const * p_data, uint32_t length)
+{
+#if UART_TEXT_USE_MVE
+    uint32_t lower   = RESET_VALUE;
+    uint32_t upper   = RESET_VALUE;
+    uint32_t digit   = RESET_VALUE;
+    uint32_t space   = RESET_VALUE;
+    uint32_t symbol  = RESET_VALUE;
+    uint32_t eol     = RESET_VALUE;
+    uint32_t control = RESET_VALUE;
+    uint32_t high    = RESET_VALUE;
+
+    /* Lane masks are only merged inside the loop, the class bits are built once at the end */
+    for (uint32_t i = RESET_VALUE; i < length; i += UART_TEXT_LANES)
+    {
+        uint32_t   active = vctp8q(length - i);
+        uint8x16_t text   = vldrbq_z_u8(&p_data[i], (mve_pred16_t) active);
+
+        uint32_t is_lower = ~(uint32_t) vcmpcsq_n_u8(vsubq_n_u8(text, 'a'), 26u) & active;
+        uint32_t is_upper = ~(uint32_t) vcmpcsq_n_u8(vsubq_n_u8(text, 'A'), 26u) & active;
+        uint32_t is_digit = ~(uint32_t) vcmpcsq_n_u8(vsubq_n_u8(text, '0'), 10u) & active;
+        uint32_t is_space = (uint32_t) vcmpeqq_n_u8(text, ' ') & active;
+        uint32_t is_eol   = (uint32_t) (vcmpeqq_n_u8(text, UART_TEXT_CR) | vcmpeqq_n_u8(text, UART_TEXT_LF)) & active;
+        uint32_t is_low   = ~(uint32_t) vcmpcsq_n_u8(text, UART_TEXT_FIRST_PRINTABLE) & active;
+        uint32_t is_del   = (uint32_t) vcmpeqq_n_u8(text, UART_TEXT_DEL) & active;
+        uint32_t is_high  = (uint32_t) vcmpcsq_n_u8(text, UART_TEXT_FIRST_HIGH) & active;
+
+        lower   |= is_lower;
+        upper   |= is_upper;
+        digit   |= is_digit;
+        space   |= is_space;
+        eol     |= is_eol;
+        control |= (is_low & ~is_eol) | is_del;
+        high    |= is_high;
+        symbol  |= active & ~(is_lower | is_upper | is_digit | is_space | is_low | is_del | is_high);
+    }
+
+    return (lower ? UART_TEXT_CLASS_LOWER : 0u) | (upper ? UART_TEXT_CLASS_UPPER : 0u) |
+           (digit ? UART_TEXT_CLASS_DIGIT : 0u) | (space ? UART_TEXT_CLASS_SPACE : 0u) |
+           (symbol ? UART_TEXT_CLASS_SYMBOL : 0u) | (eol ? UART_TEXT_CLASS_EOL : 0u) |
+           (control ? UART_TEXT_CLASS_CONTROL : 0u) | (high ? UART_TEXT_CLASS_HIGH : 0u);
+#else
+    return uart_text_classify_scalar(p_data, length);
+#endif
+}
+
+/*****************************************************************************************************************
+ *  @brief       Scalar uart_text_find_eol(), the fallback and the reference for benchmarks
+ *  @param[in]   p_data    Text to search
+ *  @param[in]   length    Number of bytes
+ *  @retval      Index of the first CR or LF, length when there is none
+ ****************************************************************************************************************/
+uint32_t uart_text_find_eol_scalar(uint8_t const * p_data, uint32_t length)
+{
+    for (uint32_t i = RESET_VALUE; i < length; i++)
+    {
+        if ((UART_TEXT_CR == p_data[i]) || (UART_TEXT_LF == p_data[i]))
+        {
+            return i;
+        }
+    }
+    return length;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Scalar uart_text_printable(), the fallback and the reference for benchmarks
+ *  @param[in]   p_data    Text to check, without its line end
+ *  @param[in]   length    Number of bytes
+ *  @retval      true when all bytes are printable
+ ****************************************************************************************************************/
+bool uart_text_printable_scalar(uint8_t const * p_data, uint32_t length)
+{
+    for (uint32_t i = RESET_VALUE; i < length; i++)
+    {
+        if ((uint8_t) (p_data[i] - UART_TEXT_FIRST_PRINTABLE) > (UART_TEXT_LAST_PRINTABLE - UART_TEXT_FIRST_PRINTABLE))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Scalar uart_text_classify(), the fallback and the reference for benchmarks
+ *  @param[in]   p_data    Text to classify
+ *  @param[in]   length    Number of bytes
+ *  @retval      UART_TEXT_CLASS_x bits of every class found
+ ****************************************************************************************************************/
+uint32_t uart_text_classify_scalar(uint8_t const * p_data, uint32_t length)
+{
+    uint32_t classes = RESET_VALUE;
+
+    for (uint32_t i = RESET_VALUE; i < length; i++)
+    {
+        classes |= uart_text_class_of(p_data[i]);
+    }
+    return classes;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Class of one byte
+ *  @param[in]   data    Byte to classify
+ *  @retval      One UART_TEXT_CLASS_x bit
+ ****************************************************************************************************************/
+static uint32_t uart_text_class_of(uint8_t data)
+{
+    if ((data >= 'a') && (data <= 'z'))
+    {
+        return UART_TEXT_CLASS_LOWER;
+    }
+    if ((data >= 'A') && (data <= 'Z'))
+    {
+        return UART_TEXT_CLASS_UPPER;
+    }
+    if ((data >= '0') && (data <= '9'))
+    {
+        return UART_TEXT_CLASS_DIGIT;
+    }
+    if (' ' == data)
+    {
+        return UART_TEXT_CLASS_SPACE;
+    }
+    if ((UART_TEXT_CR == data) || (UART_TEXT_LF == data))
+    {
+        return UART_TEXT_CLASS_EOL;
+    }
+    if (data >= UART_TEXT_FIRST_HIGH)
+    {
+        return UART_TEXT_CLASS_HIGH;
+    }
+    if ((data < UART_TEXT_FIRST_PRINTABLE) || (UART_TEXT_DEL == data))
+    {
+        return UART_TEXT_CLASS_CONTROL;
+    }
+    return UART_TEXT_CLASS_SYMBOL;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_text)
+ **********************************************************************************************************************/
@@ -0,0 +1,41 @@
+/***********************************************************************************************************************
+ * File Name    : uart_text.h
+ * Description  : Contains data structures and function declarations of uart_text.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_TEXT_H_
+#define UART_TEXT_H_
+
+/* Only standard headers here, the text kernels also build on the PC to compare against the scalar versions */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Macro definition */
+#ifndef UART_TEXT_USE_MVE
+ #if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+  #define UART_TEXT_USE_MVE       (1)       /* Helium integer instructions available, see -march=...+mve */
+ #else
+  #define UART_TEXT_USE_MVE       (0)
+ #endif
+#endif
+
+/* Character classes reported by uart_text_classify(), one bit each */
+#define UART_TEXT_CLASS_LOWER     (1u << 0) /* 'a' to 'z', romaji for the talk board */
+#define UART_TEXT_CLASS_UPPER     (1u << 1) /* 'A' to 'Z' */
+#define UART_TEXT_CLASS_DIGIT     (1u << 2) /* '0' to '9' */
+#define UART_TEXT_CLASS_SPACE     (1u << 3) /* ' ' */
+#define UART_TEXT_CLASS_SYMBOL    (1u << 4) /* Other printable ASCII, punctuation, accents and tags */
+#define UART_TEXT_CLASS_EOL       (1u << 5) /* Carriage return or line feed */
+#define UART_TEXT_CLASS_CONTROL   (1u << 6) /* Other bytes below 0x20, and DEL */
+#define UART_TEXT_CLASS_HIGH      (1u << 7) /* 0x80 and above, not ASCII */
+#define UART_TEXT_CLASS_INVALID   (UART_TEXT_CLASS_CONTROL | UART_TEXT_CLASS_HIGH)  /* Never sent to the talk board */
+
+/* Function declaration */
+uint32_t uart_text_find_eol(uint8_t const * p_data, uint32_t length);
+bool uart_text_printable(uint8_t const * p_data, uint32_t length);
+uint32_t uart_text_classify(uint8_t const * p_data, uint32_t length);
+uint32_t uart_text_find_eol_scalar(uint8_t const * p_data, uint32_t length);
+bool uart_text_printable_scalar(uint8_t const * p_data, uint32_t length);
+uint32_t uart_text_classify_scalar(uint8_t const * p_data, uint32_t length);
+
+#endif /* UART_TEXT_H_ */
@@ -0,0 +1,316 @@
+/***********************************************************************************************************************
+ * File Name    : uart_tx_queue.c
+ * Description  : Contains the interrupt driven UART transmit queue.
+ **********************************************************************************************************************/
+
+#include "common_utils.h"
+#include "uart_tx_queue.h"
+
+/*******************************************************************************************************************//**
+ * @addtogroup uart_tx_queue
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Private macro definitions
+ */
+#define UART_TX_DESC_MASK         (UART_TX_QUEUE_DEPTH - 1u)
+#define UART_TX_POOL_MASK         (UART_TX_POOL_SIZE - 1u)
+
+/*
+ * Private function declarations
+ */
+static void uart_tx_queue_start(uart_tx_queue_t * p_queue);
+static void uart_tx_queue_push(uart_tx_queue_t * p_queue);
+static void uart_tx_queue_retire(uart_tx_queue_t * p_queue);
+
+/*****************************************************************************************************************
+ *  @brief       Initialize a transmit queue for a UART channel
+ *  @param[in]   p_queue        Queue to initialize
+ *  @param[in]   p_uart_ctrl    Opened SCI control block the queue writes to
+ *  @retval      FSP_SUCCESS    Upon success
+ ****************************************************************************************************************/
+fsp_err_t uart_tx_queue_init(uart_tx_queue_t * p_queue, uart_ctrl_t * p_uart_ctrl)
+{
+    p_queue->p_uart_ctrl    = p_uart_ctrl;
+    p_queue->desc_head      = RESET_VALUE;
+    p_queue->desc_tail      = RESET_VALUE;
+    p_queue->pool_head      = RESET_VALUE;
+    p_queue->pool_tail      = RESET_VALUE;
+    p_queue->busy           = false;
+    p_queue->aborting       = false;
+    p_queue->complete_count = RESET_VALUE;
+    p_queue->error_count    = RESET_VALUE;
+    p_queue->abort_count    = RESET_VALUE;
+    p_queue->p_start        = NULL;
+
+    return FSP_SUCCESS;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Have a function called as each message starts on the wire, for timing. It runs from the TX
+ *               complete interrupt or with interrupts masked, and gets the p_context of uart_tx_queue_send_ref(),
+ *               NULL for copied messages.
+ *  @param[in]   p_queue    Transmit queue
+ *  @param[in]   p_start    Function to call, NULL for none
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_tx_queue_start_callback_set(uart_tx_queue_t * p_queue, uart_tx_release_t p_start)
+{
+    p_queue->p_start = p_start;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Copy a message into the queue and start transmission if the channel is idle. Returns immediately.
+ *  @param[in]   p_queue    Transmit queue
+ *  @param[in]   p_data     Message bytes
+ *  @param[in]   length     Message length
+ *  @retval      FSP_SUCCESS                 Message queued
+ *  @retval      FSP_ERR_INVALID_SIZE        Message is empty or larger than the byte pool
+ *  @retval      FSP_ERR_INSUFFICIENT_SPACE  No free descriptor or pool space, message dropped
+ ****************************************************************************************************************/
+fsp_err_t uart_tx_queue_send(uart_tx_queue_t * p_queue, uint8_t const * p_data, uint32_t length)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    if ((RESET_VALUE == length) || (length > UART_TX_POOL_SIZE))
+    {
+        return FSP_ERR_INVALID_SIZE;
+    }
+
+    /* Bridge tasks of different priorities send to the same queue, claim and fill must not interleave */
+    FSP_CRITICAL_SECTION_ENTER;
+
+    /* Check for a free descriptor */
+    if ((p_queue->desc_head - p_queue->desc_tail) >= UART_TX_QUEUE_DEPTH)
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+        return FSP_ERR_INSUFFICIENT_SPACE;
+    }
+
+    /* Messages are stored contiguously, skip the end of the pool if the message does not fit there */
+    uint32_t offset  = p_queue->pool_head & UART_TX_POOL_MASK;
+    uint32_t padding = ((offset + length) > UART_TX_POOL_SIZE) ? (UART_TX_POOL_SIZE - offset) : RESET_VALUE;
+    uint32_t used    = p_queue->pool_head - p_queue->pool_tail;
+
+    if ((used + padding + length) > UART_TX_POOL_SIZE)
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+        return FSP_ERR_INSUFFICIENT_SPACE;
+    }
+
+    uint8_t * p_dest = &p_queue->pool[(offset + padding) & UART_TX_POOL_MASK];
+    memcpy(p_dest, p_data, length);
+
+    uart_tx_desc_t * p_desc = &p_queue->desc[p_queue->desc_head & UART_TX_DESC_MASK];
+    p_desc->p_data     = p_dest;
+    p_desc->length     = (uint16_t) length;
+    p_desc->pool_bytes = (uint16_t) (padding + length);
+    p_desc->p_release  = NULL;
+    p_desc->p_context  = NULL;
+    p_queue->pool_head += padding + length;
+
+    uart_tx_queue_push(p_queue);
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Queue a message without copying it and start transmission if the channel is idle. The bytes must
+ *               stay untouched until p_release is called, which happens from the TX complete interrupt once the
+ *               message is on the wire, or earlier if the write could not start. On error p_release is not called
+ *               and the caller keeps ownership.
+ *  @param[in]   p_queue      Transmit queue
+ *  @param[in]   p_data       Message bytes
+ *  @param[in]   length       Message length
+ *  @param[in]   p_release    Called when the queue no longer needs the bytes
+ *  @param[in]   p_context    Argument passed to p_release
+ *  @retval      FSP_SUCCESS                 Message queued
+ *  @retval      FSP_ERR_INVALID_SIZE        Message is empty or longer than a descriptor can hold
+ *  @retval      FSP_ERR_INSUFFICIENT_SPACE  No free descriptor
+ ****************************************************************************************************************/
+fsp_err_t uart_tx_queue_send_ref(uart_tx_queue_t * p_queue, uint8_t const * p_data, uint32_t length,
+                                 uart_tx_release_t p_release, void * p_context)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    if ((RESET_VALUE == length) || (length > UINT16_MAX))
+    {
+        return FSP_ERR_INVALID_SIZE;
+    }
+
+    /* Same as uart_tx_queue_send(), the descriptor claim must not interleave with another sender */
+    FSP_CRITICAL_SECTION_ENTER;
+
+    /* Check for a free descriptor */
+    if ((p_queue->desc_head - p_queue->desc_tail) >= UART_TX_QUEUE_DEPTH)
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+        return FSP_ERR_INSUFFICIENT_SPACE;
+    }
+
+    uart_tx_desc_t * p_desc = &p_queue->desc[p_queue->desc_head & UART_TX_DESC_MASK];
+    p_desc->p_data     = p_data;
+    p_desc->length     = (uint16_t) length;
+    p_desc->pool_bytes = RESET_VALUE;
+    p_desc->p_release  = p_release;
+    p_desc->p_context  = p_context;
+
+    uart_tx_queue_push(p_queue);
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Advance the queue on UART events. Call from the channel callback in interrupt context.
+ *  @param[in]   p_queue    Transmit queue
+ *  @param[in]   event      Event reported by the SCI driver
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_tx_queue_event(uart_tx_queue_t * p_queue, uart_event_t event)
+{
+    if ((UART_EVENT_TX_COMPLETE == event) && p_queue->busy)
+    {
+        /* Last stop bit is on the wire, release the message and start the next one */
+        uart_tx_queue_retire(p_queue);
+        p_queue->complete_count++;
+
+        uart_tx_queue_start(p_queue);
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Stop the message on the wire and discard every queued message. Owners of messages queued by
+ *               reference get their release callback. Returns once the transmitter has stopped, which takes up to
+ *               the transmit FIFO contents at the channel baud rate.
+ *  @param[in]   p_queue    Transmit queue
+ *  @retval      None
+ ****************************************************************************************************************/
+void uart_tx_queue_abort(uart_tx_queue_t * p_queue)
+{
+    bool busy = false;
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    /* Keep the TX complete callback and other senders from starting the next message meanwhile */
+    FSP_CRITICAL_SECTION_ENTER;
+    p_queue->aborting = true;
+    busy              = p_queue->busy;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    /* Waits for the transmitter to stop, with the other interrupts running. A TX complete in between finds
+     * nothing to start. */
+    if (busy)
+    {
+#if defined (BOARD_RA6T2_MCK) || defined (BOARD_RA8M1_EK)
+        R_SCI_B_UART_Abort (p_queue->p_uart_ctrl, UART_DIR_TX);
+#else
+        R_SCI_UART_Abort (p_queue->p_uart_ctrl, UART_DIR_TX);
+#endif
+    }
+
+    FSP_CRITICAL_SECTION_ENTER;
+    p_queue->busy = false;
+    while (p_queue->desc_tail != p_queue->desc_head)
+    {
+        uart_tx_queue_retire(p_queue);
+        p_queue->abort_count++;
+    }
+    p_queue->aborting = false;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Check whether all queued messages have been transmitted
+ *  @param[in]   p_queue    Transmit queue
+ *  @retval      true when nothing is queued or on the wire
+ ****************************************************************************************************************/
+bool uart_tx_queue_idle(uart_tx_queue_t const * p_queue)
+{
+    return (!p_queue->busy) && (p_queue->desc_head == p_queue->desc_tail);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Write the oldest queued descriptor. Must run with the TX interrupts unable to preempt.
+ *  @param[in]   p_queue    Transmit queue
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_tx_queue_start(uart_tx_queue_t * p_queue)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    /* uart_tx_queue_abort() discards what is queued once the transmitter has stopped */
+    while ((!p_queue->aborting) && (p_queue->desc_tail != p_queue->desc_head))
+    {
+        uart_tx_desc_t * p_desc = &p_queue->desc[p_queue->desc_tail & UART_TX_DESC_MASK];
+
+#if defined (BOARD_RA6T2_MCK) || defined (BOARD_RA8M1_EK)
+        err = R_SCI_B_UART_Write (p_queue->p_uart_ctrl, p_desc->p_data, p_desc->length);
+#else
+        err = R_SCI_UART_Write (p_queue->p_uart_ctrl, p_desc->p_data, p_desc->length);
+#endif
+        if (FSP_SUCCESS == err)
+        {
+            p_queue->busy = true;
+            if (NULL != p_queue->p_start)
+            {
+                p_queue->p_start(p_desc->p_context);
+            }
+            return;
+        }
+
+        /* Drop the message rather than stall the queue */
+        uart_tx_queue_retire(p_queue);
+        p_queue->error_count++;
+    }
+
+    p_queue->busy = false;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Publish the descriptor at desc_head and kick the channel if it is idle
+ *  @param[in]   p_queue    Transmit queue
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_tx_queue_push(uart_tx_queue_t * p_queue)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    /* Publish the descriptor only after its contents are visible to the ISR */
+    __DMB();
+    p_queue->desc_head++;
+
+    /* The TX complete callback keeps the channel running otherwise */
+    FSP_CRITICAL_SECTION_ENTER;
+    if (!p_queue->busy)
+    {
+        uart_tx_queue_start(p_queue);
+    }
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Remove the oldest descriptor and hand its bytes back to the pool or to their owner
+ *  @param[in]   p_queue    Transmit queue
+ *  @retval      None
+ ****************************************************************************************************************/
+static void uart_tx_queue_retire(uart_tx_queue_t * p_queue)
+{
+    uart_tx_desc_t  * p_desc    = &p_queue->desc[p_queue->desc_tail & UART_TX_DESC_MASK];
+    uart_tx_release_t p_release = p_desc->p_release;
+    void            * p_context = p_desc->p_context;
+
+    /* The descriptor may be reused as soon as desc_tail moves, take the owner first */
+    p_queue->pool_tail += p_desc->pool_bytes;
+    p_queue->desc_tail++;
+
+    if (NULL != p_release)
+    {
+        p_release(p_context);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup uart_tx_queue)
+ **********************************************************************************************************************/
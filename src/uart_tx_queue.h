@@ -0,0 +1,60 @@
+/***********************************************************************************************************************
+ * File Name    : uart_tx_queue.h
+ * Description  : Contains data structures and function declarations of uart_tx_queue.c.
+ **********************************************************************************************************************/
+
+#ifndef UART_TX_QUEUE_H_
+#define UART_TX_QUEUE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bsp_api.h"
+#include "r_uart_api.h"
+
+/* Macro definition */
+#define UART_TX_QUEUE_DEPTH       (8u)      /* Messages queued per channel, must be a power of two */
+#define UART_TX_POOL_SIZE         (1024u)   /* Byte pool per channel, must be a power of two */
+
+/* Called when a message queued by reference has left the queue, sent or dropped */
+typedef void (* uart_tx_release_t)(void * p_context);
+
+/* Transmit descriptor. Points at the bytes of one queued message. */
+typedef struct st_uart_tx_desc
+{
+    uint8_t const   * p_data;               /* First byte of the message */
+    uint16_t          length;               /* Message length in bytes */
+    uint16_t          pool_bytes;           /* Pool bytes to release on completion, wrap padding included */
+    uart_tx_release_t p_release;            /* Owner callback for messages queued by reference, else NULL */
+    void            * p_context;            /* Argument passed to p_release */
+} uart_tx_desc_t;
+
+/* Transmit queue of one UART channel. The main loop or the bridge tasks enqueue, the TX ISR callback dequeues. */
+typedef struct st_uart_tx_queue
+{
+    uart_ctrl_t       * p_uart_ctrl;                  /* SCI control block the queue drains into */
+    uart_tx_desc_t      desc[UART_TX_QUEUE_DEPTH];    /* Descriptor ring */
+    uint8_t             pool[UART_TX_POOL_SIZE];      /* Byte pool the descriptors point into */
+    volatile uint32_t   desc_head;                    /* Next descriptor to fill (main loop) */
+    volatile uint32_t   desc_tail;                    /* Descriptor being transmitted (ISR) */
+    uint32_t            pool_head;                    /* Next free pool byte (main loop) */
+    volatile uint32_t   pool_tail;                    /* Oldest pool byte still in use (ISR) */
+    volatile bool       busy;                         /* A descriptor is on the wire */
+    volatile bool       aborting;                     /* uart_tx_queue_abort() is stopping the transmitter */
+    volatile uint32_t   complete_count;               /* Messages fully transmitted */
+    volatile uint32_t   error_count;                  /* Messages dropped because the write could not start */
+    volatile uint32_t   abort_count;                  /* Messages discarded by uart_tx_queue_abort() */
+    uart_tx_release_t   p_start;                      /* Called with the context of each message as its write
+                                                       * starts, or NULL */
+} uart_tx_queue_t;
+
+/* Function declaration */
+fsp_err_t uart_tx_queue_init(uart_tx_queue_t * p_queue, uart_ctrl_t * p_uart_ctrl);
+fsp_err_t uart_tx_queue_send(uart_tx_queue_t * p_queue, uint8_t const * p_data, uint32_t length);
+fsp_err_t uart_tx_queue_send_ref(uart_tx_queue_t * p_queue, uint8_t const * p_data, uint32_t length,
+                                 uart_tx_release_t p_release, void * p_context);
+void uart_tx_queue_start_callback_set(uart_tx_queue_t * p_queue, uart_tx_release_t p_start);
+void uart_tx_queue_event(uart_tx_queue_t * p_queue, uart_event_t event);
+void uart_tx_queue_abort(uart_tx_queue_t * p_queue);
+bool uart_tx_queue_idle(uart_tx_queue_t const * p_queue);
+
+#endif /* UART_TX_QUEUE_H_ */
@@ -0,0 +1,157 @@
+/***********************************************************************************************************************
+ * File Name    : bench_latency_hist.c
+ * Description  : Contains the host benchmark of the latency histogram, src/latency_hist.c. A synthetic load of line
+ *                latencies is recorded, p50, p99 and p99.9 are compared with the exact values of the sorted samples,
+ *                and the record and percentile calls are timed.
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "latency_hist.h"
+#include "bench_time.h"
+
+/*
+ * Private macro definitions
+ */
+#define BENCH_SAMPLES             (1000000u)
+#define BENCH_CYCLES_PER_US       (480u)    /* RA8M1 CPU clock, the histograms count DWT cycles */
+#define BENCH_SERVICE_US          (2800u)   /* 32 bytes to the talk board at 115200 baud */
+#define BENCH_JITTER_US           (250u)    /* Main loop pass and tick, uniform */
+#define BENCH_TAIL_PER_100K       (2000u)   /* Lines that wait behind another phrase */
+#define BENCH_TAIL_MEAN_US        (40000u)  /* Mean of that wait, exponential */
+#define BENCH_QUERIES             (10000u)
+
+/*
+ * Private function declarations
+ */
+static uint32_t bench_latency(void);
+static uint32_t bench_random(void);
+static int bench_compare(void const * p_a, void const * p_b);
+
+/* Percentiles the line latency report prints, in thousandths of a percent */
+static const uint32_t g_bench_percentiles[] = {50000u, 99000u, 99900u};
+
+static latency_hist_t g_bench_hist;
+static uint32_t g_bench_samples[BENCH_SAMPLES];
+static uint32_t g_bench_random = 0x13579BDFu;
+static volatile uint32_t g_bench_sink;
+
+/*****************************************************************************************************************
+ *  @brief       Record the load, print the percentiles against the exact ones and the call times
+ *  @param[in]   None
+ *  @retval      0 when every percentile is within the bucket resolution, 1 otherwise
+ ****************************************************************************************************************/
+int main(void)
+{
+    uint32_t failures  = 0u;
+    uint64_t record_ns = UINT64_MAX;
+    uint64_t query_ns  = UINT64_MAX;
+
+    for (uint32_t i = 0u; i < BENCH_SAMPLES; i++)
+    {
+        g_bench_samples[i] = bench_latency();
+    }
+
+    for (uint32_t pass = 0u; pass < BENCH_PASSES; pass++)
+    {
+        latency_hist_reset(&g_bench_hist);
+
+        uint64_t start = bench_time_ns();
+        for (uint32_t i = 0u; i < BENCH_SAMPLES; i++)
+        {
+            latency_hist_record(&g_bench_hist, g_bench_samples[i]);
+        }
+        uint64_t ns = bench_time_ns() - start;
+        record_ns = (ns < record_ns) ? ns : record_ns;
+
+        start = bench_time_ns();
+        for (uint32_t i = 0u; i < BENCH_QUERIES; i++)
+        {
+            g_bench_sink = latency_hist_percentile(&g_bench_hist, g_bench_percentiles[i % 3u]);
+        }
+        ns       = bench_time_ns() - start;
+        query_ns = (ns < query_ns) ? ns : query_ns;
+    }
+
+    qsort(g_bench_samples, BENCH_SAMPLES, sizeof(g_bench_samples[0]), bench_compare);
+
+    printf("latency_hist: %u synthetic line latencies, cycles at %u MHz\n", (unsigned) BENCH_SAMPLES,
+           (unsigned) BENCH_CYCLES_PER_US);
+    printf("  %6s  %12s  %12s  %8s\n", "", "exact", "histogram", "error");
+    for (uint32_t p = 0u; p < (sizeof(g_bench_percentiles) / sizeof(g_bench_percentiles[0])); p++)
+    {
+        /* Same rank as latency_hist_percentile(), rounded up and at least the first sample */
+        uint64_t rank = (((uint64_t) BENCH_SAMPLES * g_bench_percentiles[p]) + LATENCY_HIST_PER_100K - 1u) /
+                        LATENCY_HIST_PER_100K;
+        uint32_t exact = g_bench_samples[(0u == rank) ? 0u : (rank - 1u)];
+        uint32_t hist  = latency_hist_percentile(&g_bench_hist, g_bench_percentiles[p]);
+
+        /* The bucket holding the exact value ends at most 1 / LATENCY_HIST_SUB_COUNT above it */
+        uint64_t error_ppm = (((uint64_t) (hist - exact)) * 1000000u) / exact;
+        failures += ((hist < exact) || ((error_ppm * LATENCY_HIST_SUB_COUNT) > 1000000u)) ? 1u : 0u;
+
+        printf("  p%2u.%u  %12u  %12u  %5u.%02u%%\n", (unsigned) (g_bench_percentiles[p] / 1000u),
+               (unsigned) ((g_bench_percentiles[p] % 1000u) / 100u), (unsigned) exact, (unsigned) hist,
+               (unsigned) (error_ppm / 10000u), (unsigned) ((error_ppm % 10000u) / 100u));
+    }
+
+    printf("  latency_hist_record %u ns, latency_hist_percentile %u ns\n",
+           (unsigned) (record_ns / BENCH_SAMPLES), (unsigned) (query_ns / BENCH_QUERIES));
+
+    if (0u != failures)
+    {
+        printf("latency_hist: %u percentiles outside the bucket resolution\n", (unsigned) failures);
+    }
+
+    return (0u == failures) ? 0 : 1;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Next latency of the synthetic load: the service time with uniform jitter, and for a few lines an
+ *               exponential wait behind a phrase already playing
+ *  @param[in]   None
+ *  @retval      Latency in cycles
+ ****************************************************************************************************************/
+static uint32_t bench_latency(void)
+{
+    uint32_t us = BENCH_SERVICE_US + (bench_random() % BENCH_JITTER_US);
+
+    if ((bench_random() % LATENCY_HIST_PER_100K) < BENCH_TAIL_PER_100K)
+    {
+        /* Uniform in (0, 1], never zero for the logarithm */
+        double uniform = ((double) (bench_random() >> 8) + 1.0) / (double) (1u << 24);
+        us += (uint32_t) (-log(uniform) * BENCH_TAIL_MEAN_US);
+    }
+
+    return us * BENCH_CYCLES_PER_US;
+}
+
+/*****************************************************************************************************************
+ *  @brief       xorshift32, the same load on every run
+ *  @param[in]   None
+ *  @retval      Next random value
+ ****************************************************************************************************************/
+static uint32_t bench_random(void)
+{
+    g_bench_random ^= g_bench_random << 13;
+    g_bench_random ^= g_bench_random >> 17;
+    g_bench_random ^= g_bench_random << 5;
+
+    return g_bench_random;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Ascending order of two samples, for qsort()
+ *  @param[in]   p_a    First sample
+ *  @param[in]   p_b    Second sample
+ *  @retval      Negative, zero or positive as for qsort()
+ ****************************************************************************************************************/
+static int bench_compare(void const * p_a, void const * p_b)
+{
+    uint32_t a = *(uint32_t const *) p_a;
+    uint32_t b = *(uint32_t const *) p_b;
+
+    return (a > b) - (a < b);
+}
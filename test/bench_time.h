@@ -0,0 +1,24 @@
+/***********************************************************************************************************************
+ * File Name    : bench_time.h
+ * Description  : Contains the clock of the host benchmarks.
+ **********************************************************************************************************************/
+
+#ifndef BENCH_TIME_H_
+#define BENCH_TIME_H_
+
+#include <stdint.h>
+#include <time.h>
+
+/* Macro definition */
+#define BENCH_PASSES              (9u)      /* Runs per measurement, the fastest one is reported as uart_bench does */
+
+/* Monotonic time in nanoseconds */
+static inline uint64_t bench_time_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t) now.tv_sec * 1000000000u) + (uint64_t) now.tv_nsec;
+}
+
+#endif /* BENCH_TIME_H_ */
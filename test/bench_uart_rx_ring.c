@@ -0,0 +1,247 @@
+/***********************************************************************************************************************
+ * File Name    : bench_uart_rx_ring.c
+ * Description  : Contains the host benchmark of the receive path, src/uart_rx_ring.c. PC lines are fed in the pieces
+ *                the SCI_B receive FIFO hands over at each RX trigger level, the RXI entries per KB are counted and
+ *                every line must come out of the ring whole. The time per byte the RXI handler spends storing into
+ *                the ring is measured for each piece size.
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include "uart_rx_ring.h"
+#include "bridge_event.h"
+#include "bench_time.h"
+
+/*
+ * Private macro definitions
+ */
+#define BENCH_CR                  (0x0Du)
+#define BENCH_KB                  (1024u)
+#define BENCH_STREAM_SIZE         (64u * BENCH_KB)  /* Bytes received per measurement */
+#define BENCH_FIFO_DEPTH          (16u)     /* BSP_FEATURE_SCI_UART_FIFO_DEPTH */
+#define BENCH_LINE_MAX            (255u)    /* Longest line a PC slot takes, without the terminator */
+#define BENCH_MIXED               (0u)      /* Line length 0: lengths from 4 to 80 bytes, as typed phrases */
+#define BENCH_STORE_LINE          (32u)     /* Line length of the store timing */
+#define BENCH_STORE_BATCH         (12u * BENCH_STORE_LINE)  /* Bytes stored per timed batch, below the line table */
+
+/*
+ * Private function declarations
+ */
+static uint32_t bench_entries_per_kb(uint32_t trigger, uint32_t line_length, bool gaps);
+static uint32_t bench_line_length(uint32_t line_length);
+static uint64_t bench_store_ns(uint32_t trigger);
+
+/* Receive FIFO trigger levels of the bridge channels, 1 is the FIFO off, 15 is SCI_B_UART_RX_FIFO_TRIGGER_MAX */
+static const uint32_t g_bench_triggers[] = {1u, 4u, 8u, 12u, 15u};
+
+/* Line lengths including the carriage return */
+static const uint32_t g_bench_lengths[] = {8u, 32u, 128u, BENCH_MIXED};
+
+static uart_rx_ring_t g_bench_ring;
+static uint8_t g_bench_stream[BENCH_STREAM_SIZE];
+static uint32_t g_bench_random = 0x2468ACE1u;
+static uint32_t g_bench_failures = 0u;
+
+/*****************************************************************************************************************
+ *  @brief       Time base of the ring time stamps, not used by the benchmark
+ *  @param[in]   None
+ *  @retval      0
+ ****************************************************************************************************************/
+uint32_t bridge_event_cycles(void)
+{
+    return 0u;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Print the RXI entries per KB for each trigger level and line length
+ *  @param[in]   None
+ *  @retval      0 when every line came out whole, 1 otherwise
+ ****************************************************************************************************************/
+int main(void)
+{
+    printf("uart_rx_ring: RXI entries per KB, lines sent with a pause (back to back in brackets)\n");
+    printf("  trigger  %11s  %11s  %11s  %11s\n", "line 8", "line 32", "line 128", "mixed");
+    for (uint32_t t = 0u; t < (sizeof(g_bench_triggers) / sizeof(g_bench_triggers[0])); t++)
+    {
+        printf("  %7u", (unsigned) g_bench_triggers[t]);
+        for (uint32_t l = 0u; l < (sizeof(g_bench_lengths) / sizeof(g_bench_lengths[0])); l++)
+        {
+            uint32_t paused = bench_entries_per_kb(g_bench_triggers[t], g_bench_lengths[l], true);
+            uint32_t stream = bench_entries_per_kb(g_bench_triggers[t], g_bench_lengths[l], false);
+            printf("  %4u (%4u)", (unsigned) paused, (unsigned) stream);
+        }
+        printf("\n");
+    }
+
+    /* Lines of BENCH_STORE_LINE bytes, printable with the carriage return last */
+    for (uint32_t i = 0u; i < BENCH_STREAM_SIZE; i++)
+    {
+        g_bench_stream[i] = ((BENCH_STORE_LINE - 1u) == (i % BENCH_STORE_LINE)) ? BENCH_CR :
+                            (uint8_t) ('a' + (i % 26u));
+    }
+
+    printf("uart_rx_ring: store time per byte in the RXI handler, %u byte lines\n", (unsigned) BENCH_STORE_LINE);
+    printf("  trigger  ns per byte\n");
+    for (uint32_t t = 0u; t < (sizeof(g_bench_triggers) / sizeof(g_bench_triggers[0])); t++)
+    {
+        uint64_t ns = UINT64_MAX;
+
+        for (uint32_t pass = 0u; pass < BENCH_PASSES; pass++)
+        {
+            uint64_t pass_ns = bench_store_ns(g_bench_triggers[t]);
+            ns = (pass_ns < ns) ? pass_ns : ns;
+        }
+
+        /* Hundredths of a nanosecond */
+        uint64_t per_byte = (ns * 100u) / BENCH_STREAM_SIZE;
+        printf("  %7u  %8u.%02u\n", (unsigned) g_bench_triggers[t], (unsigned) (per_byte / 100u),
+               (unsigned) (per_byte % 100u));
+    }
+
+    if (0u != g_bench_failures)
+    {
+        printf("uart_rx_ring: %u lines lost or cut\n", (unsigned) g_bench_failures);
+    }
+
+    return (0u == g_bench_failures) ? 0 : 1;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Receive BENCH_STREAM_SIZE bytes of lines as the RXI handler gets them and count its entries. An entry
+ *               drains the FIFO when it reaches the trigger level. Below the level the bytes wait for the receive
+ *               timeout, 15 bit times after the last byte, which ends every line followed by a pause. With the FIFO
+ *               off each byte is an entry of its own.
+ *  @param[in]   trigger        RX FIFO trigger level, 1 for the FIFO off
+ *  @param[in]   line_length    Bytes per line including the carriage return, BENCH_MIXED for a mix
+ *  @param[in]   gaps           The PC pauses after each line
+ *  @retval      RXI entries per KB received
+ ****************************************************************************************************************/
+static uint32_t bench_entries_per_kb(uint32_t trigger, uint32_t line_length, bool gaps)
+{
+    uint8_t  fifo[BENCH_FIFO_DEPTH];
+    uint8_t  dest[BENCH_LINE_MAX + 1u];
+    uint32_t fifo_count = 0u;
+    uint32_t entries    = 0u;
+    uint32_t received   = 0u;
+
+    uart_rx_ring_init(&g_bench_ring, BENCH_CR);
+    while (received < BENCH_STREAM_SIZE)
+    {
+        uint32_t length = bench_line_length(line_length);
+
+        for (uint32_t i = 0u; i < length; i++)
+        {
+            fifo[fifo_count++] = (i == (length - 1u)) ? BENCH_CR : (uint8_t) ('a' + (i % 26u));
+
+            /* Trigger level reached, the handler hands the FIFO contents over in one UART_EVENT_RX_BLOCK */
+            if (fifo_count == trigger)
+            {
+                entries++;
+                uart_rx_ring_write(&g_bench_ring, fifo, fifo_count);
+                fifo_count = 0u;
+            }
+        }
+        received += length;
+
+        /* Receive timeout during the pause */
+        if (gaps && (fifo_count > 0u))
+        {
+            entries++;
+            uart_rx_ring_write(&g_bench_ring, fifo, fifo_count);
+            fifo_count = 0u;
+        }
+
+        /* The main loop takes every complete line */
+        while (uart_rx_ring_lines_available(&g_bench_ring) > 0u)
+        {
+            uint32_t got = 0u;
+
+            if ((FSP_SUCCESS != uart_rx_ring_line_get(&g_bench_ring, dest, sizeof(dest), &got)) ||
+                (BENCH_CR != dest[got - 1u]))
+            {
+                g_bench_failures++;
+            }
+        }
+    }
+
+    if (0u != g_bench_ring.overflow_count)
+    {
+        g_bench_failures++;
+    }
+
+    return (uint32_t) (((uint64_t) entries * BENCH_KB) / received);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Store the stream into the ring as the RXI handler does: UART_EVENT_RX_CHAR with uart_rx_ring_put() for
+ *               the FIFO off, one UART_EVENT_RX_BLOCK with uart_rx_ring_write() per trigger level otherwise. Only the
+ *               stores are timed, the main loop empties the ring between the batches.
+ *  @param[in]   trigger    RX FIFO trigger level, 1 for the FIFO off
+ *  @retval      Nanoseconds spent storing BENCH_STREAM_SIZE bytes
+ ****************************************************************************************************************/
+static uint64_t bench_store_ns(uint32_t trigger)
+{
+    uint8_t  dest[BENCH_LINE_MAX + 1u];
+    uint64_t ns = 0u;
+
+    uart_rx_ring_init(&g_bench_ring, BENCH_CR);
+    for (uint32_t batch = 0u; batch < BENCH_STREAM_SIZE; batch += BENCH_STORE_BATCH)
+    {
+        uint32_t end   = ((BENCH_STREAM_SIZE - batch) < BENCH_STORE_BATCH) ? BENCH_STREAM_SIZE :
+                         (batch + BENCH_STORE_BATCH);
+        uint64_t start = bench_time_ns();
+
+        if (1u == trigger)
+        {
+            for (uint32_t i = batch; i < end; i++)
+            {
+                uart_rx_ring_put(&g_bench_ring, g_bench_stream[i]);
+            }
+        }
+        else
+        {
+            for (uint32_t i = batch; i < end; i += trigger)
+            {
+                uart_rx_ring_write(&g_bench_ring, &g_bench_stream[i], ((end - i) < trigger) ? (end - i) : trigger);
+            }
+        }
+        ns += bench_time_ns() - start;
+
+        while (uart_rx_ring_lines_available(&g_bench_ring) > 0u)
+        {
+            uint32_t got = 0u;
+
+            if (FSP_SUCCESS != uart_rx_ring_line_get(&g_bench_ring, dest, sizeof(dest), &got))
+            {
+                g_bench_failures++;
+            }
+        }
+    }
+
+    if (0u != g_bench_ring.overflow_count)
+    {
+        g_bench_failures++;
+    }
+
+    return ns;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Length of the next line
+ *  @param[in]   line_length    Fixed length, or BENCH_MIXED
+ *  @retval      Bytes including the carriage return
+ ****************************************************************************************************************/
+static uint32_t bench_line_length(uint32_t line_length)
+{
+    if (BENCH_MIXED != line_length)
+    {
+        return line_length;
+    }
+
+    /* xorshift32, the same mix on every run */
+    g_bench_random ^= g_bench_random << 13;
+    g_bench_random ^= g_bench_random >> 17;
+    g_bench_random ^= g_bench_random << 5;
+
+    return 4u + (g_bench_random % 77u);
+}
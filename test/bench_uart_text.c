@@ -0,0 +1,165 @@
+/***********************************************************************************************************************
+ * File Name    : bench_uart_text.c
+ * Description  : Contains the host benchmark of the text kernels, src/uart_text.c, for 16 B to 4 KB of text. The
+ *                layout follows uart_bench_text() on the target, with nanoseconds in place of cycles and memchr() of
+ *                the C library as a reference for the line end search.
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "uart_text.h"
+#include "bench_time.h"
+
+/*
+ * Private macro definitions
+ */
+#define BENCH_TEXT_MIN            (16u)     /* Smallest input, quadrupled up to the largest */
+#define BENCH_TEXT_MAX            (4096u)
+#define BENCH_BYTES_PER_RUN       (256u * 1024u)    /* Bytes scanned per timed run, the kernel is repeated */
+#define BENCH_KERNELS             (3u)
+
+/*
+ * Private function declarations
+ */
+static uint64_t bench_kernel_ps(uint32_t kernel, bool scalar, uint32_t length, uint32_t * p_result);
+static uint32_t bench_kernel(uint32_t kernel, bool scalar, uint32_t length);
+static uint64_t bench_memchr_ps(uint32_t length);
+
+/* Input as on the target: printable romaji with the line end in the last byte, so every kernel reads all of it */
+static uint8_t g_bench_text[BENCH_TEXT_MAX];
+
+static volatile uint32_t g_bench_sink;
+static uint32_t g_bench_failures = 0u;
+
+/*****************************************************************************************************************
+ *  @brief       Print the time per byte of each kernel and of its scalar version for every size
+ *  @param[in]   None
+ *  @retval      0 when the kernels and the scalar versions agree, 1 otherwise
+ ****************************************************************************************************************/
+int main(void)
+{
+    static char const * const kernel_name[BENCH_KERNELS] = {"find_eol", "printable", "classify"};
+    static uint8_t const      romaji[]                   = "konnichiha, tenki ga yoi desune. ";
+
+    for (uint32_t i = 0u; i < BENCH_TEXT_MAX; i++)
+    {
+        g_bench_text[i] = romaji[i % (sizeof(romaji) - 1u)];
+    }
+
+    printf("uart_text (%s): ns per byte, scalar / kernel, memchr for the line end search\n",
+           UART_TEXT_USE_MVE ? "MVE" : "no MVE, the kernels are the scalar versions");
+    printf("  %6s  %15s  %15s  %15s  %6s\n", "size", kernel_name[0], kernel_name[1], kernel_name[2], "memchr");
+
+    for (uint32_t length = BENCH_TEXT_MIN; length <= BENCH_TEXT_MAX; length *= 4u)
+    {
+        g_bench_text[length - 1u] = '\r';
+
+        printf("  %4u B", (unsigned) length);
+        for (uint32_t kernel = 0u; kernel < BENCH_KERNELS; kernel++)
+        {
+            uint32_t scalar_result = 0u;
+            uint32_t kernel_result = 0u;
+            uint64_t scalar_ps     = bench_kernel_ps(kernel, true, length, &scalar_result);
+            uint64_t kernel_ps     = bench_kernel_ps(kernel, false, length, &kernel_result);
+
+            /* Picoseconds per byte */
+            printf("  %2u.%03u / %2u.%03u%s", (unsigned) (scalar_ps / 1000u), (unsigned) (scalar_ps % 1000u),
+                   (unsigned) (kernel_ps / 1000u), (unsigned) (kernel_ps % 1000u),
+                   (scalar_result == kernel_result) ? "" : " DIFFERS");
+            g_bench_failures += (scalar_result == kernel_result) ? 0u : 1u;
+        }
+
+        uint64_t memchr_ps = bench_memchr_ps(length);
+        printf("  %2u.%03u\n", (unsigned) (memchr_ps / 1000u), (unsigned) (memchr_ps % 1000u));
+
+        g_bench_text[length - 1u] = romaji[(length - 1u) % (sizeof(romaji) - 1u)];
+    }
+
+    return (0u == g_bench_failures) ? 0 : 1;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Time a kernel, the fastest of BENCH_PASSES runs
+ *  @param[in]   kernel      0 find_eol, 1 printable, 2 classify
+ *  @param[in]   scalar      Time the scalar version
+ *  @param[in]   length      Bytes of g_bench_text to scan
+ *  @param[out]  p_result    Kernel result
+ *  @retval      Picoseconds per byte
+ ****************************************************************************************************************/
+static uint64_t bench_kernel_ps(uint32_t kernel, bool scalar, uint32_t length, uint32_t * p_result)
+{
+    uint32_t runs = BENCH_BYTES_PER_RUN / length;
+    uint64_t best = UINT64_MAX;
+
+    for (uint32_t pass = 0u; pass < BENCH_PASSES; pass++)
+    {
+        uint64_t start = bench_time_ns();
+
+        for (uint32_t run = 0u; run < runs; run++)
+        {
+            *p_result = bench_kernel(kernel, scalar, length);
+        }
+
+        uint64_t ns = bench_time_ns() - start;
+        best = (ns < best) ? ns : best;
+    }
+
+    return (best * 1000u) / ((uint64_t) runs * length);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Run a kernel once. The result goes through a volatile so the call is not hoisted out of the loop.
+ *  @param[in]   kernel    0 find_eol, 1 printable, 2 classify
+ *  @param[in]   scalar    Run the scalar version
+ *  @param[in]   length    Bytes of g_bench_text to scan
+ *  @retval      Kernel result
+ ****************************************************************************************************************/
+static uint32_t bench_kernel(uint32_t kernel, bool scalar, uint32_t length)
+{
+    uint8_t const * volatile p_text = g_bench_text;
+    uint32_t                 result;
+
+    if (0u == kernel)
+    {
+        result = scalar ? uart_text_find_eol_scalar(p_text, length) : uart_text_find_eol(p_text, length);
+    }
+    else if (1u == kernel)
+    {
+        result = scalar ? uart_text_printable_scalar(p_text, length) : uart_text_printable(p_text, length);
+    }
+    else
+    {
+        result = scalar ? uart_text_classify_scalar(p_text, length) : uart_text_classify(p_text, length);
+    }
+    g_bench_sink = result;
+
+    return result;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Time memchr() for the carriage return, the fastest of BENCH_PASSES runs
+ *  @param[in]   length    Bytes of g_bench_text to scan
+ *  @retval      Picoseconds per byte
+ ****************************************************************************************************************/
+static uint64_t bench_memchr_ps(uint32_t length)
+{
+    uint32_t runs = BENCH_BYTES_PER_RUN / length;
+    uint64_t best = UINT64_MAX;
+
+    for (uint32_t pass = 0u; pass < BENCH_PASSES; pass++)
+    {
+        uint64_t start = bench_time_ns();
+
+        for (uint32_t run = 0u; run < runs; run++)
+        {
+            uint8_t const * volatile p_text = g_bench_text;
+            g_bench_sink = (uint32_t) ((uint8_t const *) memchr(p_text, '\r', length) - p_text);
+        }
+
+        uint64_t ns = bench_time_ns() - start;
+        best = (ns < best) ? ns : best;
+    }
+
+    return (best * 1000u) / ((uint64_t) runs * length);
+}
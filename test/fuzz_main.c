@@ -0,0 +1,122 @@
+/***********************************************************************************************************************
+ * File Name    : fuzz_main.c
+ * Description  : Contains a replay driver for the fuzz harnesses, for compilers without libFuzzer.
+ **********************************************************************************************************************/
+
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+/*
+ * Private macro definitions
+ */
+#define FUZZ_PATH_SIZE            (1024u)
+
+/*
+ * Private function declarations
+ */
+static int fuzz_run_path(char const * p_path);
+static int fuzz_run_file(char const * p_path);
+
+int LLVMFuzzerTestOneInput(uint8_t const * p_data, size_t size);
+
+/*****************************************************************************************************************
+ *  @brief       Run every file named on the command line, and every file in the directories named, through the
+ *               harness once. A failed check aborts, as under libFuzzer.
+ *  @param[in]   argc    Argument count
+ *  @param[in]   argv    Files or corpus directories
+ *  @retval      0 when every input ran, 1 when an input could not be read
+ ****************************************************************************************************************/
+int main(int argc, char ** argv)
+{
+    int failed = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        failed |= fuzz_run_path(argv[i]);
+    }
+
+    return failed;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Run a file, or the files of a directory
+ *  @param[in]   p_path    File or directory
+ *  @retval      0 on success, 1 when something could not be read
+ ****************************************************************************************************************/
+static int fuzz_run_path(char const * p_path)
+{
+    struct stat info;
+
+    if (0 != stat(p_path, &info))
+    {
+        fprintf(stderr, "%s: cannot stat\n", p_path);
+        return 1;
+    }
+
+    if (!S_ISDIR(info.st_mode))
+    {
+        return fuzz_run_file(p_path);
+    }
+
+    DIR * p_dir = opendir(p_path);
+    if (NULL == p_dir)
+    {
+        fprintf(stderr, "%s: cannot open\n", p_path);
+        return 1;
+    }
+
+    int             failed  = 0;
+    struct dirent * p_entry = NULL;
+    while (NULL != (p_entry = readdir(p_dir)))
+    {
+        char path[FUZZ_PATH_SIZE];
+
+        if ('.' == p_entry->d_name[0])
+        {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s", p_path, p_entry->d_name);
+        failed |= fuzz_run_path(path);
+    }
+    closedir(p_dir);
+
+    return failed;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Run one file through the harness
+ *  @param[in]   p_path    Input file
+ *  @retval      0 on success, 1 when the file could not be read
+ ****************************************************************************************************************/
+static int fuzz_run_file(char const * p_path)
+{
+    FILE * p_file = fopen(p_path, "rb");
+    if (NULL == p_file)
+    {
+        fprintf(stderr, "%s: cannot open\n", p_path);
+        return 1;
+    }
+
+    fseek(p_file, 0, SEEK_END);
+    long size = ftell(p_file);
+    fseek(p_file, 0, SEEK_SET);
+
+    uint8_t * p_data = malloc((size > 0) ? (size_t) size : 1u);
+    if ((NULL == p_data) || (size < 0) || ((size_t) size != fread(p_data, 1u, (size_t) size, p_file)))
+    {
+        fprintf(stderr, "%s: cannot read\n", p_path);
+        free(p_data);
+        fclose(p_file);
+        return 1;
+    }
+    fclose(p_file);
+
+    LLVMFuzzerTestOneInput(p_data, (size_t) size);
+    free(p_data);
+
+    return 0;
+}
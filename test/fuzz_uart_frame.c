@@ -0,0 +1,153 @@
+/***********************************************************************************************************************
+ * File Name    : fuzz_uart_frame.c
+ * Description  : Contains the libFuzzer harness of the PC link frame decoder, src/uart_frame.c.
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "uart_frame.h"
+
+/*
+ * Private macro definitions
+ */
+#define FUZZ_CHECK(condition)     do { if (!(condition)) { abort(); } } while (0)
+#define FUZZ_CONTROL_SIZE         (2u)      /* Leading input bytes that select the buffer size and the chunking */
+
+/*
+ * Private function declarations
+ */
+static void fuzz_check_frame(uart_frame_decoder_t const * p_dec, uint8_t const * p_payload);
+static void fuzz_round_trip(uint8_t const * p_data, uint32_t length);
+
+int LLVMFuzzerTestOneInput(uint8_t const * p_data, size_t size);
+
+/*****************************************************************************************************************
+ *  @brief       Feed one input to the decoder the way the PC channel does: in chunks, with the payload buffer sized
+ *               by the input and receive gaps between chunks. Aborts on a broken decoder invariant. The payload
+ *               buffer is allocated to its exact size, so a sanitizer catches any write past it.
+ *  @param[in]   p_data    Input. Byte 0 is the payload buffer size, byte 1 the chunk size, bit 7 of byte 1 a receive
+ *                         gap after every chunk. The rest is the received byte stream.
+ *  @param[in]   size      Input length
+ *  @retval      0
+ ****************************************************************************************************************/
+int LLVMFuzzerTestOneInput(uint8_t const * p_data, size_t size)
+{
+    uart_frame_decoder_t dec;
+    uart_frame_link_t    link;
+    uint8_t              reply[UART_FRAME_HEADER_SIZE + UART_FRAME_CRC_SIZE];
+
+    if (size < FUZZ_CONTROL_SIZE)
+    {
+        return 0;
+    }
+
+    uint32_t  payload_size = p_data[0];
+    uint32_t  chunk_size   = (p_data[1] & 0x7Fu) + 1u;
+    int       idle_gaps    = (0 != (p_data[1] & 0x80u));
+    uint8_t * p_payload    = (0u == payload_size) ? NULL : malloc(payload_size);
+
+    p_data += FUZZ_CONTROL_SIZE;
+    size   -= FUZZ_CONTROL_SIZE;
+
+    uart_frame_decoder_init(&dec);
+    uart_frame_decoder_buffer_set(&dec, p_payload, payload_size);
+    uart_frame_link_init(&link);
+
+    size_t offset = 0u;
+    while (offset < size)
+    {
+        uint32_t length = (uint32_t) (((size - offset) < chunk_size) ? (size - offset) : chunk_size);
+        uint32_t used   = 0u;
+
+        uart_frame_status_t status = uart_frame_decode(&dec, &p_data[offset], length, &used);
+
+        /* Every call makes progress and never reads past the chunk */
+        FUZZ_CHECK((used > 0u) && (used <= length));
+        FUZZ_CHECK((UART_FRAME_STATUS_MORE != status) || (used == length));
+        offset += used;
+
+        if (UART_FRAME_STATUS_FRAME == status)
+        {
+            fuzz_check_frame(&dec, p_payload);
+            (void) uart_frame_link_receive(&link, dec.type, dec.seq);
+        }
+        else if (UART_FRAME_STATUS_ERROR == status)
+        {
+            uart_frame_link_error(&link);
+        }
+        else if (idle_gaps && uart_frame_decoder_idle(&dec))
+        {
+            uart_frame_link_error(&link);
+        }
+        else
+        {
+            /* Frame continues in the next chunk */
+        }
+
+        uint32_t reply_length = uart_frame_link_reply(&link, false, reply);
+        FUZZ_CHECK((0u == reply_length) || ((UART_FRAME_HEADER_SIZE + UART_FRAME_CRC_SIZE) == reply_length));
+    }
+
+    FUZZ_CHECK(dec.frame_count + dec.crc_error_count + dec.length_error_count + dec.timeout_count <= size);
+
+    fuzz_round_trip(p_data, (uint32_t) size);
+    free(p_payload);
+
+    return 0;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Check a frame the decoder accepted: its length fits the buffer and its CRC is that of its bytes
+ *  @param[in]   p_dec        Decoder that returned UART_FRAME_STATUS_FRAME
+ *  @param[in]   p_payload    Payload buffer of the decoder
+ *  @retval      None
+ ****************************************************************************************************************/
+static void fuzz_check_frame(uart_frame_decoder_t const * p_dec, uint8_t const * p_payload)
+{
+    uint8_t header[UART_FRAME_HEADER_SIZE - 1u] = {p_dec->type, p_dec->seq, (uint8_t) p_dec->length};
+
+    FUZZ_CHECK(p_dec->length <= p_dec->payload_size);
+    FUZZ_CHECK(p_dec->index == p_dec->length);
+
+    uint16_t crc = uart_frame_crc(0xFFFFu, header, sizeof(header));
+    crc = uart_frame_crc(crc, p_payload, p_dec->length);
+    FUZZ_CHECK(crc == p_dec->crc_received);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Encode the input as a payload and decode it again byte by byte
+ *  @param[in]   p_data    Payload, cut to UART_FRAME_MAX_PAYLOAD
+ *  @param[in]   length    Payload length
+ *  @retval      None
+ ****************************************************************************************************************/
+static void fuzz_round_trip(uint8_t const * p_data, uint32_t length)
+{
+    static uint8_t       frame[UART_FRAME_MAX_SIZE];
+    static uint8_t       payload[UART_FRAME_MAX_PAYLOAD];
+    uart_frame_decoder_t dec;
+    uart_frame_status_t  status = UART_FRAME_STATUS_MORE;
+
+    if (length > UART_FRAME_MAX_PAYLOAD)
+    {
+        length = UART_FRAME_MAX_PAYLOAD;
+    }
+
+    uint32_t frame_length = uart_frame_encode(UART_FRAME_TYPE_DATA, (uint8_t) length, p_data, length, frame);
+    FUZZ_CHECK((UART_FRAME_HEADER_SIZE + length + UART_FRAME_CRC_SIZE) == frame_length);
+
+    uart_frame_decoder_init(&dec);
+    uart_frame_decoder_buffer_set(&dec, payload, sizeof(payload));
+    for (uint32_t i = 0u; i < frame_length; i++)
+    {
+        uint32_t used = 0u;
+
+        FUZZ_CHECK(UART_FRAME_STATUS_MORE == status);
+        status = uart_frame_decode(&dec, &frame[i], 1u, &used);
+        FUZZ_CHECK(1u == used);
+    }
+
+    FUZZ_CHECK(UART_FRAME_STATUS_FRAME == status);
+    FUZZ_CHECK((UART_FRAME_TYPE_DATA == dec.type) && ((uint8_t) length == dec.seq) && (length == dec.length));
+    FUZZ_CHECK((0u == length) || (0 == memcmp(payload, p_data, length)));
+}
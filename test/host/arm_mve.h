@@ -0,0 +1,252 @@
+/***********************************************************************************************************************
+ * File Name    : arm_mve.h
+ * Description  : Contains plain C models of the Helium intrinsics src/macl_mve.c and src/uart_text.c use, so their
+ *                vector paths also run in the host tests. Lane by lane as the Armv8.1-M architecture describes each instruction.
+ **********************************************************************************************************************/
+
+#ifndef ARM_MVE_H_
+#define ARM_MVE_H_
+
+#include <stdint.h>
+
+/* Macro definition */
+#define MVE_LANES_8               (16)      /* 8-bit lanes per vector */
+#define MVE_LANES_32              (4)       /* 32-bit lanes per vector */
+#define MVE_PRED_BITS_32          (4)       /* Predicate bits per 32-bit lane, one per byte */
+
+typedef uint16_t mve_pred16_t;
+
+typedef struct
+{
+    uint8_t lane[MVE_LANES_8];
+} uint8x16_t;
+
+typedef struct
+{
+    int32_t lane[MVE_LANES_32];
+} int32x4_t;
+
+typedef struct
+{
+    uint32_t lane[MVE_LANES_32];
+} uint32x4_t;
+
+static inline mve_pred16_t vctp8q(uint32_t n)
+{
+    return (mve_pred16_t) ((n >= MVE_LANES_8) ? 0xFFFFu : ((1u << n) - 1u));
+}
+
+/* Inactive lanes are not read and load as zero */
+static inline uint8x16_t vldrbq_z_u8(uint8_t const * base, mve_pred16_t p)
+{
+    uint8x16_t v;
+
+    for (int j = 0; j < MVE_LANES_8; j++)
+    {
+        v.lane[j] = ((p >> j) & 1) ? base[j] : 0;
+    }
+    return v;
+}
+
+/* Wrapping */
+static inline uint8x16_t vsubq_n_u8(uint8x16_t a, uint8_t b)
+{
+    for (int j = 0; j < MVE_LANES_8; j++)
+    {
+        a.lane[j] = (uint8_t) (a.lane[j] - b);
+    }
+    return a;
+}
+
+static inline mve_pred16_t vcmpeqq_n_u8(uint8x16_t a, uint8_t b)
+{
+    mve_pred16_t p = 0;
+
+    for (int j = 0; j < MVE_LANES_8; j++)
+    {
+        p = (mve_pred16_t) (p | ((a.lane[j] == b) << j));
+    }
+    return p;
+}
+
+/* Unsigned higher */
+static inline mve_pred16_t vcmphiq_n_u8(uint8x16_t a, uint8_t b)
+{
+    mve_pred16_t p = 0;
+
+    for (int j = 0; j < MVE_LANES_8; j++)
+    {
+        p = (mve_pred16_t) (p | ((a.lane[j] > b) << j));
+    }
+    return p;
+}
+
+/* Unsigned higher or same */
+static inline mve_pred16_t vcmpcsq_n_u8(uint8x16_t a, uint8_t b)
+{
+    mve_pred16_t p = 0;
+
+    for (int j = 0; j < MVE_LANES_8; j++)
+    {
+        p = (mve_pred16_t) (p | ((a.lane[j] >= b) << j));
+    }
+    return p;
+}
+
+/* Lane j of a 32-bit vector is active when its lowest predicate bit is set */
+static inline int mve_active_32(mve_pred16_t p, int j)
+{
+    return (p >> (j * MVE_PRED_BITS_32)) & 1;
+}
+
+static inline mve_pred16_t vctp32q(uint32_t n)
+{
+    mve_pred16_t p = 0;
+
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        if ((uint32_t) j < n)
+        {
+            p = (mve_pred16_t) (p | (0xFu << (j * MVE_PRED_BITS_32)));
+        }
+    }
+    return p;
+}
+
+/* Inactive lanes are not read and load as zero */
+static inline int32x4_t vldrwq_z_s32(int32_t const * base, mve_pred16_t p)
+{
+    int32x4_t v;
+
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        v.lane[j] = mve_active_32(p, j) ? base[j] : 0;
+    }
+    return v;
+}
+
+/* Byte offsets from base, inactive lanes are not read */
+static inline int32x4_t vldrwq_gather_offset_z_s32(int32_t const * base, uint32x4_t offset, mve_pred16_t p)
+{
+    int32x4_t v;
+
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        v.lane[j] = mve_active_32(p, j) ? *(int32_t const *) ((char const *) base + offset.lane[j]) : 0;
+    }
+    return v;
+}
+
+static inline void vstrwq_p_s32(int32_t * base, int32x4_t value, mve_pred16_t p)
+{
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        if (mve_active_32(p, j))
+        {
+            base[j] = value.lane[j];
+        }
+    }
+}
+
+static inline int32x4_t vdupq_n_s32(int32_t a)
+{
+    int32x4_t v;
+
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        v.lane[j] = a;
+    }
+    return v;
+}
+
+/* a, a - imm, a - 2 * imm, a - 3 * imm, wrapping */
+static inline uint32x4_t vddupq_n_u32(uint32_t a, int imm)
+{
+    uint32x4_t v;
+
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        v.lane[j] = a - ((uint32_t) j * (uint32_t) imm);
+    }
+    return v;
+}
+
+/* Sum of the active products added to a, in 64 bits that wrap */
+static inline int64_t vmlaldavaq_p_s32(int64_t a, int32x4_t b, int32x4_t c, mve_pred16_t p)
+{
+    uint64_t sum = (uint64_t) a;
+
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        if (mve_active_32(p, j))
+        {
+            sum += (uint64_t) ((int64_t) b.lane[j] * c.lane[j]);
+        }
+    }
+    return (int64_t) sum;
+}
+
+static inline int32_t mve_saturate_32(int64_t value)
+{
+    return (value > INT32_MAX) ? INT32_MAX : ((value < INT32_MIN) ? INT32_MIN : (int32_t) value);
+}
+
+/* (2 * a * b) >> 32, saturated */
+static inline int32x4_t vqdmulhq_s32(int32x4_t a, int32x4_t b)
+{
+    int32x4_t v;
+
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        v.lane[j] = mve_saturate_32(((int64_t) a.lane[j] * b.lane[j]) >> 31);
+    }
+    return v;
+}
+
+/* (a * b) >> 32 */
+static inline int32x4_t vmulhq_s32(int32x4_t a, int32x4_t b)
+{
+    int32x4_t v;
+
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        v.lane[j] = (int32_t) (((int64_t) a.lane[j] * b.lane[j]) >> 32);
+    }
+    return v;
+}
+
+/* Shift by the signed bottom byte of b: left with saturation, or right truncating for a negative amount */
+static inline int32x4_t vqshlq_s32(int32x4_t a, int32x4_t b)
+{
+    int32x4_t v;
+
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        int32_t shift = (int8_t) (b.lane[j] & 0xFF);
+
+        if (shift >= 0)
+        {
+            int64_t value = (shift >= 32) ? ((0 == a.lane[j]) ? 0 : ((a.lane[j] > 0) ? INT64_MAX : INT64_MIN))
+                                          : ((int64_t) a.lane[j] * ((int64_t) 1 << shift));
+            v.lane[j] = mve_saturate_32(value);
+        }
+        else
+        {
+            v.lane[j] = (shift <= -32) ? ((a.lane[j] < 0) ? -1 : 0) : (a.lane[j] >> -shift);
+        }
+    }
+    return v;
+}
+
+static inline int32x4_t vqaddq_s32(int32x4_t a, int32x4_t b)
+{
+    int32x4_t v;
+
+    for (int j = 0; j < MVE_LANES_32; j++)
+    {
+        v.lane[j] = mve_saturate_32((int64_t) a.lane[j] + b.lane[j]);
+    }
+    return v;
+}
+
+#endif /* ARM_MVE_H_ */
@@ -0,0 +1,22 @@
+/***********************************************************************************************************************
+ * File Name    : bsp_api.h
+ * Description  : Contains the part of the FSP error codes and macros the host tests need, in place of the BSP.
+ **********************************************************************************************************************/
+
+#ifndef BSP_API_H_
+#define BSP_API_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Values as in ra/fsp/inc/api/fsp_common_api.h */
+typedef enum e_fsp_err
+{
+    FSP_SUCCESS          = 0,
+    FSP_ERR_OVERFLOW     = 12,
+    FSP_ERR_BUFFER_EMPTY = 36,
+} fsp_err_t;
+
+#define FSP_PARAMETER_NOT_USED(p)    (void) ((p))
+
+#endif /* BSP_API_H_ */
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""Write the seed corpus of the frame decoder harness (test/fuzz_uart_frame.c).
+
+    python3 test/make_corpus.py test/corpus/uart_frame
+
+Every seed starts with the two control bytes of the harness: the payload buffer size and the chunk size, bit 7 of the
+chunk size adding a receive gap after every chunk. The rest is the byte stream the PC would send: valid frames, frames
+with a bad CRC, truncated frames and frames whose length exceeds the buffer. Only the Python standard library is used.
+"""
+
+import os
+import sys
+
+SYNC = 0xA5
+TYPE_DATA = 0x01
+TYPE_RESET = 0x02
+BUFFER_SIZE = 254   # Payload limit of a line slot, UART_PC_FRAME_MAX_PHRASE
+IDLE_GAPS = 0x80
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, as uart_frame_crc()"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def frame(frame_type, seq, payload):
+    body = bytes([frame_type, seq, len(payload)]) + payload
+    crc = crc16(body)
+    return bytes([SYNC]) + body + bytes([crc & 0xFF, crc >> 8])
+
+
+def seed(buffer_size, chunk, stream):
+    return bytes([buffer_size, chunk - 1]) + stream
+
+
+def seeds():
+    hello = frame(TYPE_DATA, 0, b'hello')
+    window = b''.join(frame(TYPE_DATA, seq, b'phrase %d' % seq) for seq in range(8))
+    bad_crc = bytearray(hello)
+    bad_crc[-1] ^= 0x01
+    bad_payload = bytearray(hello)
+    bad_payload[5] ^= 0x20
+    longest = frame(TYPE_DATA, 1, bytes(range(32, 127)) * 2 + bytes(range(32, 96)))
+    return {
+        'valid_one': seed(BUFFER_SIZE, 128, hello),
+        'valid_bytewise': seed(BUFFER_SIZE, 1, hello),
+        'valid_window': seed(BUFFER_SIZE, 16, window),
+        'valid_reset': seed(BUFFER_SIZE, 128, frame(TYPE_RESET, 200, b'') + frame(TYPE_DATA, 201, b'x')),
+        'valid_empty': seed(0, 128, frame(TYPE_DATA, 0, b'')),
+        'valid_longest': seed(BUFFER_SIZE, 128, longest),
+        'noise_then_valid': seed(BUFFER_SIZE, 7, b'\x00\xff\r\nAT\r' + hello),
+        'bad_crc': seed(BUFFER_SIZE, 128, bytes(bad_crc) + hello),
+        'bad_payload': seed(BUFFER_SIZE, 3, bytes(bad_payload) + hello),
+        'truncated_header': seed(BUFFER_SIZE, 128, hello[:3]),
+        'truncated_payload': seed(BUFFER_SIZE, 4, hello[:7]),
+        'truncated_then_valid': seed(BUFFER_SIZE, 4 | IDLE_GAPS, hello[:7] + hello),
+        'truncated_crc': seed(BUFFER_SIZE, 128, hello[:-1]),
+        'oversize_length': seed(16, 128, frame(TYPE_DATA, 0, bytes(range(48, 48 + 17))) + hello),
+        'oversize_max': seed(BUFFER_SIZE, 128, bytes([SYNC, TYPE_DATA, 0, 255]) + bytes(255) + hello),
+        'false_sync': seed(BUFFER_SIZE, 128, bytes([SYNC, SYNC, SYNC]) + hello),
+    }
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__.strip().split('\n\n')[1].strip())
+    os.makedirs(sys.argv[1], exist_ok=True)
+    for name, data in seeds().items():
+        with open(os.path.join(sys.argv[1], name), 'wb') as out:
+            out.write(data)
+
+
+if __name__ == '__main__':
+    main()
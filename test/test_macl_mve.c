@@ -0,0 +1,544 @@
+/***********************************************************************************************************************
+ * File Name    : test_macl_mve.c
+ * Description  : Contains the host test of the R_BSP_Macl Q31 functions, src/macl_mve.c. The dispatching functions
+ *                and the scalar references are both checked against direct evaluations of their definitions. Built
+ *                with MACL_MVE_USE_MVE=1 the dispatching functions run the Helium path on the models of
+ *                host/arm_mve.h.
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "macl_mve.h"
+
+/*
+ * Private macro definitions
+ */
+#define TEST_LANES                (4u)      /* Q31 values per Helium vector */
+#define TEST_MAX_LENGTH           (3u * TEST_LANES + 3u)    /* Whole vectors and every tail length */
+#define TEST_MAX_TAPS             (9u)
+#define TEST_SIGNAL_LENGTH        (40u)     /* Samples filtered per case, in blocks of varying size */
+#define TEST_MAX_STAGES           (3u)
+#define TEST_ROUNDS               (40u)     /* Random inputs per size */
+
+/*
+ * Private function declarations
+ */
+static void test_mul(void);
+static void test_scale(void);
+static void test_fir(void);
+static void test_conv(void);
+static void test_correlate(void);
+static void test_biquad(void);
+static void test_lms(void);
+static q31_t test_value(void);
+static q31_t test_small(void);
+static void test_fill(q31_t * p_data, uint32_t length);
+static q31_t test_clip(int64_t value);
+static q31_t test_sum_shifted(uint64_t sum, uint32_t shift);
+static void test_expect(q31_t const * p_got, q31_t const * p_expected, uint32_t length, char const * p_what,
+                        uint32_t size);
+
+/* Values at the ends of the Q31 range, mixed into the random ones */
+static const q31_t g_test_edges[] = {INT32_MIN, INT32_MIN + 1, -1, 0, 1, INT32_MAX - 1, INT32_MAX};
+
+/* Block sizes a filtered signal is cut into, so the state is carried over at every offset */
+static const uint32_t g_test_blocks[] = {1u, 3u, 4u, 5u, 7u, 8u, 12u};
+
+static uint32_t g_test_random = 0x12345678u;
+static uint32_t g_test_checks = 0u;
+static uint32_t g_test_failures = 0u;
+
+/*****************************************************************************************************************
+ *  @brief       Run every function on all sizes from empty to three vectors and a tail
+ *  @param[in]   None
+ *  @retval      0 when every check passed, 1 otherwise
+ ****************************************************************************************************************/
+int main(void)
+{
+    test_mul();
+    test_scale();
+    test_fir();
+    test_conv();
+    test_correlate();
+    test_biquad();
+    test_lms();
+
+    printf("macl_mve (%s): %u checks, %u failures\n", MACL_MVE_USE_MVE ? "Helium model" : "scalar",
+           (unsigned) g_test_checks, (unsigned) g_test_failures);
+
+    return (0u == g_test_failures) ? 0 : 1;
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclMulQ31: (a * b) >> 31, saturated
+ ****************************************************************************************************************/
+static void test_mul(void)
+{
+    for (uint32_t length = 0u; length <= TEST_MAX_LENGTH; length++)
+    {
+        for (uint32_t round = 0u; round < TEST_ROUNDS; round++)
+        {
+            q31_t a[TEST_MAX_LENGTH];
+            q31_t b[TEST_MAX_LENGTH];
+            q31_t expected[TEST_MAX_LENGTH + 1u];
+            q31_t got[TEST_MAX_LENGTH + 1u];
+
+            test_fill(a, length);
+            test_fill(b, length);
+            for (uint32_t i = 0u; i < length; i++)
+            {
+                expected[i] = test_clip(((int64_t) a[i] * b[i]) >> 31);
+            }
+
+            /* The word after the block must stay as it is */
+            expected[length] = 0x5A5A5A5A;
+            got[length]      = 0x5A5A5A5A;
+            R_BSP_MaclMulQ31(a, b, got, length);
+            test_expect(got, expected, length + 1u, "R_BSP_MaclMulQ31", length);
+            macl_mve_mul_q31_scalar(a, b, got, length);
+            test_expect(got, expected, length + 1u, "macl_mve_mul_q31_scalar", length);
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclScaleQ31: (x * scale) >> 32, then shifted by shift + 1 with saturation
+ ****************************************************************************************************************/
+static void test_scale(void)
+{
+    static const int8_t shifts[] = {-128, -40, -33, -32, -31, -17, -2, -1, 0, 1, 5, 30, 31, 32, 50, 127};
+
+    for (uint32_t length = 0u; length <= TEST_MAX_LENGTH; length++)
+    {
+        for (uint32_t s = 0u; s < (sizeof(shifts) / sizeof(shifts[0])); s++)
+        {
+            q31_t x[TEST_MAX_LENGTH];
+            q31_t expected[TEST_MAX_LENGTH + 1u];
+            q31_t got[TEST_MAX_LENGTH + 1u];
+            q31_t scale = test_value();
+
+            test_fill(x, length);
+            for (uint32_t i = 0u; i < length; i++)
+            {
+                int64_t value = ((int64_t) x[i] * scale) >> 32;
+                int32_t shift = shifts[s] + 1;
+
+                /* One bit at a time, a value that leaves the range stays at its limit */
+                for (int32_t bit = 0; bit < shift; bit++)
+                {
+                    value = (value > INT32_MAX) ? value : ((value < INT32_MIN) ? value : value * 2);
+                }
+                for (int32_t bit = 0; bit < -shift; bit++)
+                {
+                    value >>= 1;
+                }
+                expected[i] = test_clip(value);
+            }
+
+            expected[length] = 0x5A5A5A5A;
+            got[length]      = 0x5A5A5A5A;
+            R_BSP_MaclScaleQ31(x, scale, shifts[s], got, length);
+            test_expect(got, expected, length + 1u, "R_BSP_MaclScaleQ31", length);
+            macl_mve_scale_q31_scalar(x, scale, shifts[s], got, length);
+            test_expect(got, expected, length + 1u, "macl_mve_scale_q31_scalar", length);
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclFirQ31: y[n] = sum of h[k] * x[n - k], 64-bit sum >> 31. The signal goes through in blocks
+ *               and the result must be the same as over the whole signal at once.
+ ****************************************************************************************************************/
+static void test_fir(void)
+{
+    for (uint32_t taps = 1u; taps <= TEST_MAX_TAPS; taps++)
+    {
+        for (uint32_t b = 0u; b < (sizeof(g_test_blocks) / sizeof(g_test_blocks[0])); b++)
+        {
+            q31_t x[TEST_SIGNAL_LENGTH];
+            q31_t coeffs[TEST_MAX_TAPS];
+            q31_t expected[TEST_SIGNAL_LENGTH];
+
+            test_fill(x, TEST_SIGNAL_LENGTH);
+            test_fill(coeffs, taps);
+
+            /* The coefficients are stored time reversed, h[k] is coeffs[taps - 1 - k] */
+            for (uint32_t n = 0u; n < TEST_SIGNAL_LENGTH; n++)
+            {
+                uint64_t sum = 0u;
+
+                for (uint32_t k = 0u; (k < taps) && (k <= n); k++)
+                {
+                    sum += (uint64_t) ((int64_t) coeffs[taps - 1u - k] * x[n - k]);
+                }
+                expected[n] = test_sum_shifted(sum, 31u);
+            }
+
+            for (uint32_t path = 0u; path < 2u; path++)
+            {
+                q31_t                state[TEST_MAX_TAPS + TEST_SIGNAL_LENGTH] = {0};
+                q31_t                got[TEST_SIGNAL_LENGTH];
+                arm_fir_instance_q31 fir = {(uint16_t) taps, state, coeffs};
+
+                for (uint32_t n = 0u; n < TEST_SIGNAL_LENGTH; n += g_test_blocks[b])
+                {
+                    uint32_t block = (TEST_SIGNAL_LENGTH - n < g_test_blocks[b]) ? (TEST_SIGNAL_LENGTH - n) :
+                                     g_test_blocks[b];
+
+                    /* In place, as the callers may filter */
+                    memcpy(&got[n], &x[n], block * sizeof(q31_t));
+                    if (0u == path)
+                    {
+                        R_BSP_MaclFirQ31(&fir, &got[n], &got[n], block);
+                    }
+                    else
+                    {
+                        macl_mve_fir_q31_scalar(&fir, &got[n], &got[n], block);
+                    }
+                }
+                test_expect(got, expected, TEST_SIGNAL_LENGTH, (0u == path) ? "R_BSP_MaclFirQ31" :
+                            "macl_mve_fir_q31_scalar", taps);
+            }
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclConvQ31: y[n] = sum of a[k] * b[n - k], 64-bit sum >> 31
+ ****************************************************************************************************************/
+static void test_conv(void)
+{
+    for (uint32_t a_len = 1u; a_len <= TEST_MAX_LENGTH; a_len++)
+    {
+        for (uint32_t b_len = 1u; b_len <= TEST_MAX_LENGTH; b_len++)
+        {
+            q31_t a[TEST_MAX_LENGTH];
+            q31_t b[TEST_MAX_LENGTH];
+            q31_t expected[2u * TEST_MAX_LENGTH];
+            q31_t got[2u * TEST_MAX_LENGTH];
+            uint32_t out_len = a_len + b_len - 1u;
+
+            test_fill(a, a_len);
+            test_fill(b, b_len);
+            for (uint32_t n = 0u; n < out_len; n++)
+            {
+                uint64_t sum = 0u;
+
+                for (uint32_t k = 0u; k < a_len; k++)
+                {
+                    if ((n >= k) && ((n - k) < b_len))
+                    {
+                        sum += (uint64_t) ((int64_t) a[k] * b[n - k]);
+                    }
+                }
+                expected[n] = test_sum_shifted(sum, 31u);
+            }
+            expected[out_len] = 0x5A5A5A5A;
+
+            got[out_len] = 0x5A5A5A5A;
+            R_BSP_MaclConvQ31(a, a_len, b, b_len, got);
+            test_expect(got, expected, out_len + 1u, "R_BSP_MaclConvQ31", (a_len * 100u) + b_len);
+            got[out_len] = 0x5A5A5A5A;
+            macl_mve_conv_q31_scalar(a, a_len, b, b_len, got);
+            test_expect(got, expected, out_len + 1u, "macl_mve_conv_q31_scalar", (a_len * 100u) + b_len);
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclCorrelateQ31: output max(a_len, b_len) - 1 + l is the sum of a[l + k] * b[k], the other
+ *               outputs are zero
+ ****************************************************************************************************************/
+static void test_correlate(void)
+{
+    for (uint32_t a_len = 1u; a_len <= TEST_MAX_LENGTH; a_len++)
+    {
+        for (uint32_t b_len = 1u; b_len <= TEST_MAX_LENGTH; b_len++)
+        {
+            q31_t    a[TEST_MAX_LENGTH];
+            q31_t    b[TEST_MAX_LENGTH];
+            q31_t    expected[2u * TEST_MAX_LENGTH];
+            q31_t    got[2u * TEST_MAX_LENGTH];
+            uint32_t longer  = (a_len > b_len) ? a_len : b_len;
+            uint32_t out_len = (2u * longer) - 1u;
+
+            test_fill(a, a_len);
+            test_fill(b, b_len);
+            memset(expected, 0, sizeof(expected));
+            for (int32_t lag = 1 - (int32_t) b_len; lag < (int32_t) a_len; lag++)
+            {
+                uint64_t sum = 0u;
+
+                for (int32_t k = 0; k < (int32_t) b_len; k++)
+                {
+                    if (((lag + k) >= 0) && ((lag + k) < (int32_t) a_len))
+                    {
+                        sum += (uint64_t) ((int64_t) a[lag + k] * b[k]);
+                    }
+                }
+                expected[(int32_t) longer - 1 + lag] = test_sum_shifted(sum, 31u);
+            }
+            expected[out_len] = 0x5A5A5A5A;
+
+            /* Outputs the lags do not reach must be written too */
+            memset(got, 0xA5, sizeof(got));
+            got[out_len] = 0x5A5A5A5A;
+            R_BSP_MaclCorrelateQ31(a, a_len, b, b_len, got);
+            test_expect(got, expected, out_len + 1u, "R_BSP_MaclCorrelateQ31", (a_len * 100u) + b_len);
+            memset(got, 0xA5, sizeof(got));
+            got[out_len] = 0x5A5A5A5A;
+            macl_mve_correlate_q31_scalar(a, a_len, b, b_len, got);
+            test_expect(got, expected, out_len + 1u, "macl_mve_correlate_q31_scalar", (a_len * 100u) + b_len);
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclBiquadCsdDf1Q31: per stage y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2],
+ *               64-bit sum >> (31 - postShift), through the stages and over blocks
+ ****************************************************************************************************************/
+static void test_biquad(void)
+{
+    for (uint32_t stages = 1u; stages <= TEST_MAX_STAGES; stages++)
+    {
+        for (uint8_t post_shift = 0u; post_shift < 3u; post_shift++)
+        {
+            for (uint32_t b = 0u; b < (sizeof(g_test_blocks) / sizeof(g_test_blocks[0])); b++)
+            {
+                q31_t signal[TEST_SIGNAL_LENGTH];
+                q31_t coeffs[5u * TEST_MAX_STAGES];
+                q31_t expected[TEST_SIGNAL_LENGTH];
+
+                test_fill(signal, TEST_SIGNAL_LENGTH);
+                test_fill(coeffs, 5u * stages);
+                memcpy(expected, signal, sizeof(signal));
+
+                for (uint32_t s = 0u; s < stages; s++)
+                {
+                    q31_t const * c = &coeffs[5u * s];
+                    q31_t         x[TEST_SIGNAL_LENGTH];
+
+                    memcpy(x, expected, sizeof(x));
+                    for (uint32_t n = 0u; n < TEST_SIGNAL_LENGTH; n++)
+                    {
+                        uint64_t sum = (uint64_t) ((int64_t) c[0] * x[n]);
+
+                        if (n >= 1u)
+                        {
+                            sum += (uint64_t) ((int64_t) c[1] * x[n - 1u]) +
+                                   (uint64_t) ((int64_t) c[3] * expected[n - 1u]);
+                        }
+                        if (n >= 2u)
+                        {
+                            sum += (uint64_t) ((int64_t) c[2] * x[n - 2u]) +
+                                   (uint64_t) ((int64_t) c[4] * expected[n - 2u]);
+                        }
+                        expected[n] = test_sum_shifted(sum, 31u - post_shift);
+                    }
+                }
+
+                for (uint32_t path = 0u; path < 2u; path++)
+                {
+                    q31_t                        state[4u * TEST_MAX_STAGES] = {0};
+                    q31_t                        got[TEST_SIGNAL_LENGTH];
+                    arm_biquad_casd_df1_inst_q31 biquad = {stages, state, coeffs, post_shift};
+
+                    for (uint32_t n = 0u; n < TEST_SIGNAL_LENGTH; n += g_test_blocks[b])
+                    {
+                        uint32_t block = (TEST_SIGNAL_LENGTH - n < g_test_blocks[b]) ? (TEST_SIGNAL_LENGTH - n) :
+                                         g_test_blocks[b];
+
+                        if (0u == path)
+                        {
+                            R_BSP_MaclBiquadCsdDf1Q31(&biquad, &signal[n], &got[n], block);
+                        }
+                        else
+                        {
+                            macl_mve_biquad_df1_q31_scalar(&biquad, &signal[n], &got[n], block);
+                        }
+                    }
+                    test_expect(got, expected, TEST_SIGNAL_LENGTH, (0u == path) ? "R_BSP_MaclBiquadCsdDf1Q31" :
+                                "macl_mve_biquad_df1_q31_scalar", stages);
+                }
+            }
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       R_BSP_MaclLmsQ31: output and error as for the FIR with postShift, then every coefficient moves by
+ *               2 * ((alpha * x) >> 32) with saturation, alpha = (error * mu) >> 31
+ ****************************************************************************************************************/
+static void test_lms(void)
+{
+    for (uint32_t taps = 1u; taps <= TEST_MAX_TAPS; taps++)
+    {
+        for (uint32_t post_shift = 0u; post_shift < 2u; post_shift++)
+        {
+            for (uint32_t b = 0u; b < (sizeof(g_test_blocks) / sizeof(g_test_blocks[0])); b++)
+            {
+                q31_t x[TEST_SIGNAL_LENGTH];
+                q31_t ref[TEST_SIGNAL_LENGTH];
+                q31_t start[TEST_MAX_TAPS];
+                q31_t coeffs[TEST_MAX_TAPS];
+                q31_t expected_out[TEST_SIGNAL_LENGTH];
+                q31_t expected_err[TEST_SIGNAL_LENGTH];
+                q31_t mu = (0u == (b & 1u)) ? test_small() : test_value();
+
+                test_fill(x, TEST_SIGNAL_LENGTH);
+                test_fill(ref, TEST_SIGNAL_LENGTH);
+                test_fill(start, taps);
+                memcpy(coeffs, start, sizeof(start));
+
+                /* coeffs[i] multiplies x[n - (taps - 1) + i] */
+                for (uint32_t n = 0u; n < TEST_SIGNAL_LENGTH; n++)
+                {
+                    uint64_t sum = 0u;
+
+                    for (uint32_t i = 0u; i < taps; i++)
+                    {
+                        int32_t at = (int32_t) n - (int32_t) (taps - 1u) + (int32_t) i;
+                        sum += (at >= 0) ? (uint64_t) ((int64_t) coeffs[i] * x[at]) : 0u;
+                    }
+                    expected_out[n] = test_sum_shifted(sum, 31u - post_shift);
+                    expected_err[n] = test_clip((int64_t) ref[n] - expected_out[n]);
+
+                    q31_t alpha = (q31_t) (((int64_t) expected_err[n] * mu) >> 31);
+                    for (uint32_t i = 0u; i < taps; i++)
+                    {
+                        int32_t at = (int32_t) n - (int32_t) (taps - 1u) + (int32_t) i;
+                        int64_t step = (at >= 0) ? (((int64_t) alpha * x[at]) >> 32) : 0;
+                        coeffs[i] = test_clip((int64_t) coeffs[i] + step + step);
+                    }
+                }
+
+                for (uint32_t path = 0u; path < 2u; path++)
+                {
+                    q31_t                state[TEST_MAX_TAPS + TEST_SIGNAL_LENGTH] = {0};
+                    q31_t                adapted[TEST_MAX_TAPS];
+                    q31_t                out[TEST_SIGNAL_LENGTH];
+                    q31_t                err[TEST_SIGNAL_LENGTH];
+                    arm_lms_instance_q31 lms = {(uint16_t) taps, state, adapted, mu, post_shift};
+
+                    memcpy(adapted, start, sizeof(start));
+                    for (uint32_t n = 0u; n < TEST_SIGNAL_LENGTH; n += g_test_blocks[b])
+                    {
+                        uint32_t block = (TEST_SIGNAL_LENGTH - n < g_test_blocks[b]) ? (TEST_SIGNAL_LENGTH - n) :
+                                         g_test_blocks[b];
+
+                        if (0u == path)
+                        {
+                            R_BSP_MaclLmsQ31(&lms, &x[n], &ref[n], &out[n], &err[n], block);
+                        }
+                        else
+                        {
+                            macl_mve_lms_q31_scalar(&lms, &x[n], &ref[n], &out[n], &err[n], block);
+                        }
+                    }
+
+                    char const * p_name = (0u == path) ? "R_BSP_MaclLmsQ31" : "macl_mve_lms_q31_scalar";
+                    test_expect(out, expected_out, TEST_SIGNAL_LENGTH, p_name, taps);
+                    test_expect(err, expected_err, TEST_SIGNAL_LENGTH, p_name, taps);
+                    test_expect(adapted, coeffs, taps, p_name, taps);
+                }
+            }
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Next test value: an edge value one time in four, any Q31 value otherwise
+ *  @param[in]   None
+ *  @retval      Value
+ ****************************************************************************************************************/
+static q31_t test_value(void)
+{
+    /* xorshift32, the same sequence on every run */
+    g_test_random ^= g_test_random << 13;
+    g_test_random ^= g_test_random >> 17;
+    g_test_random ^= g_test_random << 5;
+
+    if (0u == (g_test_random & 3u))
+    {
+        return g_test_edges[(g_test_random >> 8) % (sizeof(g_test_edges) / sizeof(g_test_edges[0]))];
+    }
+    return (q31_t) g_test_random;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Value below 1/256, a step size that keeps an LMS filter from saturating at once
+ *  @param[in]   None
+ *  @retval      Value
+ ****************************************************************************************************************/
+static q31_t test_small(void)
+{
+    return test_value() >> 8;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Fill a buffer with test values
+ *  @param[out]  p_data    Buffer
+ *  @param[in]   length    Number of values
+ *  @retval      None
+ ****************************************************************************************************************/
+static void test_fill(q31_t * p_data, uint32_t length)
+{
+    for (uint32_t i = 0u; i < length; i++)
+    {
+        p_data[i] = test_value();
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       Saturate to Q31
+ *  @param[in]   value    64-bit value
+ *  @retval      Limited value
+ ****************************************************************************************************************/
+static q31_t test_clip(int64_t value)
+{
+    return (value > INT32_MAX) ? INT32_MAX : ((value < INT32_MIN) ? INT32_MIN : (q31_t) value);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Low 32 bits of a wrapped 64-bit sum shifted right, as the functions write their outputs
+ *  @param[in]   sum      Sum, two's complement
+ *  @param[in]   shift    Right shift
+ *  @retval      Output value
+ ****************************************************************************************************************/
+static q31_t test_sum_shifted(uint64_t sum, uint32_t shift)
+{
+    /* Arithmetic shift written out: the sign bits come in from the top */
+    uint64_t shifted = sum >> shift;
+
+    if (0u != (sum >> 63))
+    {
+        shifted |= ~(UINT64_MAX >> shift);
+    }
+    return (q31_t) (uint32_t) shifted;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Count one check and print it when it failed
+ *  @param[in]   p_got         Function result
+ *  @param[in]   p_expected    Result of the definition
+ *  @param[in]   length        Number of values
+ *  @param[in]   p_what        Function name
+ *  @param[in]   size          Case size, printed with a failure
+ *  @retval      None
+ ****************************************************************************************************************/
+static void test_expect(q31_t const * p_got, q31_t const * p_expected, uint32_t length, char const * p_what,
+                        uint32_t size)
+{
+    g_test_checks++;
+    for (uint32_t i = 0u; i < length; i++)
+    {
+        if (p_got[i] != p_expected[i])
+        {
+            g_test_failures++;
+            printf("FAIL %s (size %u): value %u is 0x%08X, expected 0x%08X\n", p_what, (unsigned) size, (unsigned) i,
+                   (unsigned) (uint32_t) p_got[i], (unsigned) (uint32_t) p_expected[i]);
+            return;
+        }
+    }
+}
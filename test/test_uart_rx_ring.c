@@ -0,0 +1,230 @@
+/***********************************************************************************************************************
+ * File Name    : test_uart_rx_ring.c
+ * Description  : Contains the host test of the receive ring, src/uart_rx_ring.c: lines through both producer paths,
+ *                the wrap point, lines longer than the destination and a full ring.
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "uart_rx_ring.h"
+#include "bridge_event.h"
+
+/*
+ * Private macro definitions
+ */
+#define TEST_CR                   (0x0Du)
+#define TEST_SLOT_SIZE            (256u)    /* As uart_line_slot_t.data */
+
+/*
+ * Private function declarations
+ */
+static void test_lines(void);
+static void test_wrap(void);
+static void test_long_line(void);
+static void test_full_ring(void);
+static void test_fill(uint8_t * p_line, uint32_t length, uint8_t seed);
+static void test_expect(uint32_t got, uint32_t expected, char const * p_what);
+
+static uart_rx_ring_t g_test_ring;
+static uint32_t g_test_cycles = 0u;
+static uint32_t g_test_checks = 0u;
+static uint32_t g_test_failures = 0u;
+
+/*****************************************************************************************************************
+ *  @brief       Time base of the ring time stamps, stepped by the tests
+ *  @param[in]   None
+ *  @retval      Current test time
+ ****************************************************************************************************************/
+uint32_t bridge_event_cycles(void)
+{
+    return g_test_cycles;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Run every case
+ *  @param[in]   None
+ *  @retval      0 when every check passed, 1 otherwise
+ ****************************************************************************************************************/
+int main(void)
+{
+    test_lines();
+    test_wrap();
+    test_long_line();
+    test_full_ring();
+
+    printf("uart_rx_ring: %u checks, %u failures\n", (unsigned) g_test_checks, (unsigned) g_test_failures);
+
+    return (0u == g_test_failures) ? 0 : 1;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Lines stored byte by byte and as a block come out whole, in order, with their time stamps
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+static void test_lines(void)
+{
+    static const uint8_t block[] = "two\rthree\rfour";
+    uint8_t              dest[TEST_SLOT_SIZE];
+    uint32_t             length = 0u;
+
+    uart_rx_ring_init(&g_test_ring, TEST_CR);
+
+    g_test_cycles = 10u;
+    for (char const * p = "one\r"; '\0' != *p; p++)
+    {
+        uart_rx_ring_put(&g_test_ring, (uint8_t) *p);
+    }
+    uart_rx_ring_write_at(&g_test_ring, block, sizeof(block) - 1u, 20u);
+    test_expect(uart_rx_ring_lines_available(&g_test_ring), 3u, "lines available");
+
+    test_expect(uart_rx_ring_line_cycles(&g_test_ring), 10u, "put stamp");
+    test_expect(uart_rx_ring_line_get(&g_test_ring, dest, sizeof(dest), &length), FSP_SUCCESS, "get one");
+    test_expect((4u == length) && (0 == memcmp(dest, "one\r", 5u)), 1u, "line one");
+
+    test_expect(uart_rx_ring_line_cycles(&g_test_ring), 20u, "block stamp");
+    test_expect(uart_rx_ring_line_get(&g_test_ring, dest, sizeof(dest), &length), FSP_SUCCESS, "get two");
+    test_expect((4u == length) && (0 == memcmp(dest, "two\r", 5u)), 1u, "line two");
+
+    test_expect(uart_rx_ring_line_get(&g_test_ring, dest, sizeof(dest), &length), FSP_SUCCESS, "get three");
+    test_expect((6u == length) && (0 == memcmp(dest, "three\r", 7u)), 1u, "line three");
+    test_expect(uart_rx_ring_line_overflow(&g_test_ring), 0u, "no overflow");
+
+    /* "four" has no carriage return yet */
+    test_expect(uart_rx_ring_line_get(&g_test_ring, dest, sizeof(dest), &length), FSP_ERR_BUFFER_EMPTY, "partial");
+}
+
+/*****************************************************************************************************************
+ *  @brief       A block written across the end of the buffer, and a line read across it, stay intact
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+static void test_wrap(void)
+{
+    uint8_t  line[200];
+    uint8_t  dest[TEST_SLOT_SIZE];
+    uint32_t length = 0u;
+
+    uart_rx_ring_init(&g_test_ring, TEST_CR);
+    for (uint32_t lap = 0u; lap < ((3u * UART_RX_RING_SIZE) / sizeof(line)); lap++)
+    {
+        test_fill(line, sizeof(line), (uint8_t) lap);
+        uart_rx_ring_write(&g_test_ring, line, sizeof(line));
+        test_expect(uart_rx_ring_line_get(&g_test_ring, dest, sizeof(dest), &length), FSP_SUCCESS, "wrap get");
+        test_expect((sizeof(line) == length) && (0 == memcmp(dest, line, sizeof(line))), 1u, "wrap line");
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       A line longer than the destination comes out cut, with its carriage return, and says so. A line
+ *               that just fits does not.
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+static void test_long_line(void)
+{
+    uint8_t  line[300];
+    uint8_t  dest[TEST_SLOT_SIZE];
+    uint32_t length = 0u;
+
+    for (uint32_t size = TEST_SLOT_SIZE - 2u; size <= sizeof(line); size++)
+    {
+        fsp_err_t expected = (size <= (TEST_SLOT_SIZE - 1u)) ? FSP_SUCCESS : FSP_ERR_OVERFLOW;
+        uint32_t  copied   = (FSP_SUCCESS == expected) ? size : (TEST_SLOT_SIZE - 1u);
+
+        /* Byte by byte and as a block, the block once across the wrap point */
+        for (uint32_t path = 0u; path < 3u; path++)
+        {
+            uart_rx_ring_init(&g_test_ring, TEST_CR);
+            test_fill(line, size, (uint8_t) size);
+            if (2u == path)
+            {
+                g_test_ring.head = UART_RX_RING_SIZE - 100u;
+                g_test_ring.tail = UART_RX_RING_SIZE - 100u;
+            }
+            if (0u == path)
+            {
+                for (uint32_t i = 0u; i < size; i++)
+                {
+                    uart_rx_ring_put(&g_test_ring, line[i]);
+                }
+            }
+            else
+            {
+                uart_rx_ring_write(&g_test_ring, line, size);
+            }
+
+            memset(dest, 0xFF, sizeof(dest));
+            test_expect(uart_rx_ring_line_get(&g_test_ring, dest, sizeof(dest), &length), expected, "long get");
+            test_expect(length, copied, "long length");
+            test_expect(0 == memcmp(dest, line, copied - 1u), 1u, "long start");
+            test_expect(dest[copied - 1u], TEST_CR, "long carriage return");
+            test_expect(dest[copied], 0u, "long terminator");
+            test_expect(uart_rx_ring_lines_available(&g_test_ring), 0u, "long released");
+            test_expect(g_test_ring.tail, g_test_ring.head, "long bytes released");
+        }
+    }
+}
+
+/*****************************************************************************************************************
+ *  @brief       A ring that fills up without a complete line closes what it holds as an overflowed piece, and the
+ *               rest of the line is marked too
+ *  @param[in]   None
+ *  @retval      None
+ ****************************************************************************************************************/
+static void test_full_ring(void)
+{
+    uint8_t  dest[UART_RX_RING_SIZE + 1u];
+    uint32_t length = 0u;
+
+    uart_rx_ring_init(&g_test_ring, TEST_CR);
+    for (uint32_t i = 0u; i < (UART_RX_RING_SIZE + 10u); i++)
+    {
+        uart_rx_ring_put(&g_test_ring, 'a');
+    }
+    test_expect(g_test_ring.overflow_count, 10u, "full count");
+    test_expect(uart_rx_ring_lines_available(&g_test_ring), 1u, "full piece");
+    test_expect(uart_rx_ring_line_overflow(&g_test_ring), 1u, "full piece overflow");
+    test_expect(uart_rx_ring_line_get(&g_test_ring, dest, sizeof(dest), &length), FSP_SUCCESS, "full get");
+    test_expect(length, UART_RX_RING_SIZE, "full length");
+
+    uart_rx_ring_put(&g_test_ring, 'b');
+    uart_rx_ring_put(&g_test_ring, TEST_CR);
+    test_expect(uart_rx_ring_line_overflow(&g_test_ring), 1u, "full rest overflow");
+    test_expect(uart_rx_ring_line_get(&g_test_ring, dest, sizeof(dest), &length), FSP_SUCCESS, "full rest get");
+    test_expect(length, 2u, "full rest length");
+}
+
+/*****************************************************************************************************************
+ *  @brief       Fill a line with printable bytes and end it with a carriage return
+ *  @param[out]  p_line    Line
+ *  @param[in]   length    Number of bytes, carriage return included
+ *  @param[in]   seed      First byte offset
+ *  @retval      None
+ ****************************************************************************************************************/
+static void test_fill(uint8_t * p_line, uint32_t length, uint8_t seed)
+{
+    for (uint32_t i = 0u; i < (length - 1u); i++)
+    {
+        p_line[i] = (uint8_t) ('!' + ((seed + i) % 90u));
+    }
+    p_line[length - 1u] = TEST_CR;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Count one check and print it when it failed
+ *  @param[in]   got         Result
+ *  @param[in]   expected    Expected result
+ *  @param[in]   p_what      Check name
+ *  @retval      None
+ ****************************************************************************************************************/
+static void test_expect(uint32_t got, uint32_t expected, char const * p_what)
+{
+    g_test_checks++;
+    if (got != expected)
+    {
+        g_test_failures++;
+        printf("FAIL %s: got %u, expected %u\n", p_what, (unsigned) got, (unsigned) expected);
+    }
+}
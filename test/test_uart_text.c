@@ -0,0 +1,185 @@
+/***********************************************************************************************************************
+ * File Name    : test_uart_text.c
+ * Description  : Contains the host test of the text kernels, src/uart_text.c, against a byte table.
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "uart_text.h"
+
+/*
+ * Private macro definitions
+ */
+#define TEST_LANES                (16u)     /* Bytes per Helium vector */
+#define TEST_MAX_LENGTH           (3u * TEST_LANES)  /* Whole vectors and every tail length 0 to 15 */
+#define TEST_FILL                 ('a')
+
+/*
+ * Private function declarations
+ */
+static uint32_t test_class_of(uint8_t data);
+static void test_text(uint8_t const * p_text, uint32_t length, char const * p_what);
+static void test_expect(uint32_t got, uint32_t expected, char const * p_kernel, uint8_t const * p_text,
+                        uint32_t length, char const * p_what);
+
+/* Bytes at the class boundaries, the ends of the printable range and the first byte that is not ASCII included */
+static const uint8_t g_test_bytes[] =
+{
+    0x00u, 0x09u, 0x0Au, 0x0Bu, 0x0Cu, 0x0Du, 0x1Fu, 0x20u, 0x21u, 0x2Fu, 0x30u, 0x39u, 0x3Au, 0x40u, 0x41u,
+    0x5Au, 0x5Bu, 0x60u, 0x61u, 0x7Au, 0x7Bu, 0x7Eu, 0x7Fu, 0x80u, 0x81u, 0xA0u, 0xC3u, 0xE3u, 0xFEu, 0xFFu
+};
+
+/* Bytes placed right after the text: a kernel reading past its length would see a line end or a bad byte */
+static const uint8_t g_test_guards[] = {0x0Du, 0x0Au, 0x7Fu, 0x80u, 0x00u};
+
+static uint32_t g_test_checks = 0u;
+static uint32_t g_test_failures = 0u;
+
+/*****************************************************************************************************************
+ *  @brief       Run the kernels, the dispatching ones and the scalar references, on every text length from 0 to
+ *               three vectors, with each boundary byte at each position and every guard byte after the end
+ *  @param[in]   None
+ *  @retval      0 when every check passed, 1 otherwise
+ ****************************************************************************************************************/
+int main(void)
+{
+    /* The text sits at the end of an exactly sized allocation, then in a buffer with a guard byte behind it */
+    for (uint32_t length = 0u; length <= TEST_MAX_LENGTH; length++)
+    {
+        uint8_t * p_text = malloc((0u == length) ? 1u : length);
+
+        memset(p_text, TEST_FILL, length);
+        test_text(p_text, length, "fill");
+
+        for (uint32_t position = 0u; position < length; position++)
+        {
+            for (uint32_t b = 0u; b < sizeof(g_test_bytes); b++)
+            {
+                memset(p_text, TEST_FILL, length);
+                p_text[position] = g_test_bytes[b];
+                test_text(p_text, length, "byte");
+
+                /* Two different bytes, the first one must decide the line end */
+                if ((position + 1u) < length)
+                {
+                    p_text[length - 1u] = 0x0Du;
+                    test_text(p_text, length, "byte and CR");
+                }
+            }
+        }
+        free(p_text);
+
+        for (uint32_t g = 0u; g < sizeof(g_test_guards); g++)
+        {
+            uint8_t guarded[TEST_MAX_LENGTH + 1u];
+
+            memset(guarded, TEST_FILL, length);
+            guarded[length] = g_test_guards[g];
+            test_text(guarded, length, "guard");
+        }
+    }
+
+    printf("uart_text (%s): %u checks, %u failures\n", UART_TEXT_USE_MVE ? "Helium model" : "scalar",
+           (unsigned) g_test_checks, (unsigned) g_test_failures);
+
+    return (0u == g_test_failures) ? 0 : 1;
+}
+
+/*****************************************************************************************************************
+ *  @brief       Compare every kernel on one text with the results worked out from the byte table
+ *  @param[in]   p_text    Text
+ *  @param[in]   length    Number of bytes
+ *  @param[in]   p_what    Case name for failure messages
+ *  @retval      None
+ ****************************************************************************************************************/
+static void test_text(uint8_t const * p_text, uint32_t length, char const * p_what)
+{
+    uint32_t eol       = length;
+    uint32_t printable = 1u;
+    uint32_t classes   = 0u;
+
+    for (uint32_t i = 0u; i < length; i++)
+    {
+        if ((eol == length) && ((0x0Du == p_text[i]) || (0x0Au == p_text[i])))
+        {
+            eol = i;
+        }
+        if ((p_text[i] < 0x20u) || (p_text[i] > 0x7Eu))
+        {
+            printable = 0u;
+        }
+        classes |= test_class_of(p_text[i]);
+    }
+
+    test_expect(uart_text_find_eol(p_text, length), eol, "find_eol", p_text, length, p_what);
+    test_expect(uart_text_find_eol_scalar(p_text, length), eol, "find_eol_scalar", p_text, length, p_what);
+    test_expect(uart_text_printable(p_text, length), printable, "printable", p_text, length, p_what);
+    test_expect(uart_text_printable_scalar(p_text, length), printable, "printable_scalar", p_text, length, p_what);
+    test_expect(uart_text_classify(p_text, length), classes, "classify", p_text, length, p_what);
+    test_expect(uart_text_classify_scalar(p_text, length), classes, "classify_scalar", p_text, length, p_what);
+}
+
+/*****************************************************************************************************************
+ *  @brief       Count one check and print it when it failed
+ *  @param[in]   got         Kernel result
+ *  @param[in]   expected    Result from the byte table
+ *  @param[in]   p_kernel    Kernel name
+ *  @param[in]   p_text      Text
+ *  @param[in]   length      Number of bytes
+ *  @param[in]   p_what      Case name
+ *  @retval      None
+ ****************************************************************************************************************/
+static void test_expect(uint32_t got, uint32_t expected, char const * p_kernel, uint8_t const * p_text,
+                        uint32_t length, char const * p_what)
+{
+    g_test_checks++;
+    if (got == expected)
+    {
+        return;
+    }
+
+    g_test_failures++;
+    printf("FAIL %s (%s, length %u): got 0x%X, expected 0x%X, text", p_kernel, p_what, (unsigned) length,
+           (unsigned) got, (unsigned) expected);
+    for (uint32_t i = 0u; i < length; i++)
+    {
+        printf(" %02X", p_text[i]);
+    }
+    printf("\n");
+}
+
+/*****************************************************************************************************************
+ *  @brief       Class of one byte, written from the UART_TEXT_CLASS_ definitions independently of uart_text.c
+ *  @param[in]   data    Byte
+ *  @retval      One UART_TEXT_CLASS_ bit
+ ****************************************************************************************************************/
+static uint32_t test_class_of(uint8_t data)
+{
+    static const struct
+    {
+        uint8_t  first;
+        uint8_t  last;
+        uint32_t class_bit;
+    } ranges[] =
+    {
+        {0x00u, 0x09u, UART_TEXT_CLASS_CONTROL}, {0x0Au, 0x0Au, UART_TEXT_CLASS_EOL},
+        {0x0Bu, 0x0Cu, UART_TEXT_CLASS_CONTROL}, {0x0Du, 0x0Du, UART_TEXT_CLASS_EOL},
+        {0x0Eu, 0x1Fu, UART_TEXT_CLASS_CONTROL}, {0x20u, 0x20u, UART_TEXT_CLASS_SPACE},
+        {0x21u, 0x2Fu, UART_TEXT_CLASS_SYMBOL},  {0x30u, 0x39u, UART_TEXT_CLASS_DIGIT},
+        {0x3Au, 0x40u, UART_TEXT_CLASS_SYMBOL},  {0x41u, 0x5Au, UART_TEXT_CLASS_UPPER},
+        {0x5Bu, 0x60u, UART_TEXT_CLASS_SYMBOL},  {0x61u, 0x7Au, UART_TEXT_CLASS_LOWER},
+        {0x7Bu, 0x7Eu, UART_TEXT_CLASS_SYMBOL},  {0x7Fu, 0x7Fu, UART_TEXT_CLASS_CONTROL},
+        {0x80u, 0xFFu, UART_TEXT_CLASS_HIGH},
+    };
+
+    for (uint32_t i = 0u; i < (sizeof(ranges) / sizeof(ranges[0])); i++)
+    {
+        if ((data >= ranges[i].first) && (data <= ranges[i].last))
+        {
+            return ranges[i].class_bit;
+        }
+    }
+    return 0u;
+}
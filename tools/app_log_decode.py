@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""Decode the deferred log of the bridge (src/app_log.h).
+
+The target writes binary records to RTT up-buffer 1 ("AppLog"). Capture that channel into a file, for example with
+    JLinkRTTLogger -Device R7FA8M1AH -If SWD -Speed 4000 -RTTChannel 1 applog.bin
+and render it with the ELF file of the same build:
+    python3 tools/app_log_decode.py Debug/sci_uart_ek_ra8m1_ep.elf applog.bin
+
+Each record is little-endian 32-bit words: (format offset << 4) | argument count, the DWT cycle count, then the
+arguments. Format strings come from the .app_log_fmt section of the ELF file, %s arguments from its loaded sections.
+Only the Python standard library is used.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+COUNT_BITS = 4
+HEADER_WORDS = 2
+FORMAT_SECTION = '.app_log_fmt'
+SPEC = re.compile(r'%([-+ #0]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z|t|j)?([diouxXcsp%])')
+
+
+class Elf:
+    """Sections of a 32-bit little-endian ELF file"""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        if self.data[:4] != b'\x7fELF' or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError('%s is not a 32-bit little-endian ELF file' % path)
+        shoff, = struct.unpack_from('<I', self.data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', self.data, 0x2E)
+        headers = [struct.unpack_from('<IIIIIIIIII', self.data, shoff + i * shentsize) for i in range(shnum)]
+        names = headers[shstrndx][4]
+        self.sections = []
+        for name, kind, flags, addr, offset, size, _, _, _, _ in headers:
+            end = self.data.index(b'\0', names + name)
+            self.sections.append((self.data[names + name:end].decode(), kind, flags, addr, offset, size))
+
+    def section(self, name):
+        for sec_name, _, _, addr, offset, size in self.sections:
+            if sec_name == name:
+                return addr, self.data[offset:offset + size]
+        raise KeyError('no %s section, was the build linked with script/fsp.ld?' % name)
+
+    def string(self, address):
+        """NUL terminated string at a target address in a loaded section with file contents"""
+        for _, kind, flags, addr, offset, size in self.sections:
+            if (flags & 0x2) and kind != 8 and addr <= address < addr + size:
+                start = offset + address - addr
+                return self.data[start:self.data.index(b'\0', start)].decode('latin-1')
+        return None
+
+
+def render(fmt, args, elf):
+    """printf with the argument words of one record"""
+    out = []
+    pos = 0
+    words = iter(args)
+    for m in SPEC.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, precision, _, conv = m.groups()
+        if conv == '%':
+            out.append('%')
+            continue
+        value = next(words, None)
+        if value is None:
+            out.append('<missing>')
+            continue
+        spec = '%' + flags + width + ('.' + precision if precision else '')
+        if conv in 'di':
+            out.append((spec + 'd') % (value - (1 << 32) if value & 0x80000000 else value))
+        elif conv == 'c':
+            out.append((spec + 'c') % chr(value & 0xFF))
+        elif conv == 's':
+            text = elf.string(value)
+            out.append((spec + 's') % (text if text is not None else '<0x%08x>' % value))
+        elif conv == 'p':
+            out.append('0x%08x' % value)
+        else:
+            out.append((spec + conv.replace('u', 'd')) % value)
+    out.append(fmt[pos:])
+    return ''.join(out)
+
+
+def decode(stream, elf, clock_hz, out):
+    """Print the records of a capture, returns the number of records"""
+    base, formats = elf.section(FORMAT_SECTION)
+    count = 0
+    pos = 0
+    while pos + HEADER_WORDS * 4 <= len(stream):
+        header, cycles = struct.unpack_from('<II', stream, pos)
+        nargs = header & ((1 << COUNT_BITS) - 1)
+        offset = (header >> COUNT_BITS) - base
+        end = pos + (HEADER_WORDS + nargs) * 4
+        if end > len(stream) or not 0 <= offset < len(formats):
+            raise ValueError('record at byte %d does not match %s, wrong ELF file?' % (pos, FORMAT_SECTION))
+        args = struct.unpack_from('<%dI' % nargs, stream, pos + HEADER_WORDS * 4)
+        fmt = formats[offset:formats.index(b'\0', offset)].decode('latin-1')
+        text = render(fmt, args, elf).replace('\r\n', '\n').replace('\r', '\n')
+        if clock_hz:
+            # One record per line behind its time stamp
+            text = '[%10u] %s\n' % (cycles // (clock_hz // 1000000), text.strip('\n'))
+        out.write(text)
+        pos = end
+        count += 1
+    return count
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('elf', help='ELF file of the running build')
+    parser.add_argument('capture', nargs='?', help='RTT channel 1 capture, standard input when omitted')
+    parser.add_argument('--clock', type=int, default=0,
+                        help='CPU clock in Hz, prefixes every record with its DWT time stamp in microseconds')
+    options = parser.parse_args()
+
+    try:
+        elf = Elf(options.elf)
+        if options.capture:
+            with open(options.capture, 'rb') as f:
+                stream = f.read()
+        else:
+            stream = sys.stdin.buffer.read()
+        decode(stream, elf, options.clock, sys.stdout)
+    except (KeyError, ValueError) as error:
+        sys.exit('app_log_decode: %s' % error.args[0])
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Measure the PC line latency of the bridge under a synthetic load (src/line_latency.h).
+
+Sends phrases on the PC serial port, then asks the bridge for its histograms with "@L":
+    python3 tools/latency_load.py /dev/ttyUSB0 --lines 1000
+By default the next phrase goes out once the bridge reports the previous one finished ("F<job>"), as a speaking
+application would. --interval sends at a fixed rate instead, which also loads the utterance queue. The histograms are
+cleared with "@L0" first. Times are microseconds from the carriage return of each line; TX start and TX complete
+need the bridge only, the reply stage needs the talk board on SCI0. Only the Python standard library is used, on a
+POSIX host.
+"""
+
+import argparse
+import os
+import select
+import sys
+import termios
+import time
+
+STAGES = {'S': 'TX start', 'C': 'TX complete', 'R': 'Reply'}
+BAUD_RATES = {9600: termios.B9600, 19200: termios.B19200, 38400: termios.B38400, 57600: termios.B57600,
+              115200: termios.B115200, 230400: termios.B230400}
+
+
+class Port:
+    """Raw serial port exchanging carriage return terminated lines"""
+
+    def __init__(self, path, baud):
+        if baud not in BAUD_RATES:
+            raise ValueError('unsupported rate %d' % baud)
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        attrs = termios.tcgetattr(self.fd)
+        attrs[0] = termios.IGNPAR
+        attrs[1] = 0
+        attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        attrs[3] = 0
+        attrs[4] = attrs[5] = BAUD_RATES[baud]
+        termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+        termios.tcflush(self.fd, termios.TCIOFLUSH)
+        self.pending = b''
+
+    def send(self, text):
+        os.write(self.fd, text.encode('ascii') + b'\r')
+
+    def line(self, timeout):
+        """Next line without its carriage return, None on a timeout"""
+        deadline = time.monotonic() + timeout
+        while b'\r' not in self.pending:
+            left = deadline - time.monotonic()
+            if left <= 0 or not select.select([self.fd], [], [], left)[0]:
+                return None
+            self.pending += os.read(self.fd, 256)
+        text, self.pending = self.pending.split(b'\r', 1)
+        return text.decode('latin-1').lstrip('\n')
+
+
+def query(port, command, timeout):
+    """Send "@L" or "@L0" and collect the answer of every stage"""
+    port.send(command)
+    stages = {}
+    while len(stages) < len(STAGES):
+        text = port.line(timeout)
+        if text is None:
+            raise ValueError('no answer to %s, is UART_PC_LATENCY_ENABLED set?' % command)
+        if text.startswith('@L') and len(text) > 2 and text[2] in STAGES:
+            stages[text[2]] = [int(value) for value in text[3:].split(',')]
+    return stages
+
+
+def load(port, lines, text, interval, timeout):
+    """Send the phrases, returns the number the bridge rejected: queue full ('R') or bad text ('T')"""
+    rejected = 0
+    for i in range(lines):
+        port.send('%s %d' % (text, i))
+        if interval:
+            time.sleep(interval)
+            continue
+        # Closed loop: wait for the end of this job, or its rejection
+        while True:
+            answer = port.line(timeout)
+            if answer is None:
+                raise ValueError('line %d not finished within %g s' % (i, timeout))
+            if answer[:1] in ('R', 'T'):
+                rejected += 1
+                break
+            if answer.startswith('F'):
+                break
+    return rejected
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('port', help='PC serial port of the bridge')
+    parser.add_argument('--baud', type=int, default=115200, help='PC link rate (default 115200)')
+    parser.add_argument('--lines', type=int, default=200, help='phrases to send (default 200)')
+    parser.add_argument('--text', default='test', help='phrase text, the line number is appended')
+    parser.add_argument('--interval', type=float, default=0,
+                        help='seconds between phrases, 0 waits for each to finish (default)')
+    parser.add_argument('--timeout', type=float, default=30, help='seconds to wait for an answer (default 30)')
+    options = parser.parse_args()
+
+    try:
+        port = Port(options.port, options.baud)
+        query(port, '@L0', options.timeout)
+        rejected = load(port, options.lines, options.text, options.interval, options.timeout)
+        if options.interval:
+            # Let the queue drain before reading the histograms
+            time.sleep(options.timeout)
+        stages = query(port, '@L', options.timeout)
+    except (OSError, ValueError) as error:
+        sys.exit('latency_load: %s' % error)
+
+    print('%d lines sent, %d rejected' % (options.lines, rejected))
+    print('%-12s %7s %10s %10s %10s %10s' % ('CR to', 'lines', 'p50 us', 'p99 us', 'p99.9 us', 'max us'))
+    for tag, name in STAGES.items():
+        print('%-12s %7d %10d %10d %10d %10d' % ((name,) + tuple(stages[tag])))
+
+
+if __name__ == '__main__':
+    main()
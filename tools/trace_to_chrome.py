@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""Convert the event trace of the bridge (src/trace.h) to a Chrome trace timeline.
+
+The target writes begin and end events to RTT up-buffer 2 ("Trace"). Capture that channel into a file, for example with
+    JLinkRTTLogger -Device R7FA8M1AH -If SWD -Speed 4000 -RTTChannel 2 trace.bin
+and convert it:
+    python3 tools/trace_to_chrome.py trace.bin -o trace.json
+Open the JSON file in https://ui.perfetto.dev or chrome://tracing. Interrupts and the bridge loop get a track each.
+
+Each record is little-endian 32-bit words: (type << 28) | (name length << 16) | event ID, then the DWT cycle count.
+Name records are followed by the name, padded with NULs to a whole word. Events still open when the capture stops
+are ended at its last time stamp, ends whose begin came before the capture are dropped. Only the Python standard
+library is used.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+TYPE_SHIFT = 28
+LENGTH_SHIFT = 16
+LENGTH_MASK = 0xFFF
+ID_MASK = 0xFFFF
+TYPE_BEGIN, TYPE_END, TYPE_NAME = 0, 1, 2
+ID_IRQ_BASE = 0x100
+TRACK_LOOP, TRACK_IRQ = 1, 2
+
+
+def parse(stream):
+    """Names by event ID and (cycles, phase, ID) events in capture order, cycle counts unwrapped to 64 bits"""
+    names = {}
+    events = []
+    last = None
+    high = 0
+    pos = 0
+    while pos + 8 <= len(stream):
+        header, cycles = struct.unpack_from('<II', stream, pos)
+        kind = header >> TYPE_SHIFT
+        event_id = header & ID_MASK
+        pos += 8
+        if kind == TYPE_NAME:
+            length = (header >> LENGTH_SHIFT) & LENGTH_MASK
+            end = pos + (length + 3) // 4 * 4
+            if end > len(stream):
+                break
+            names[event_id] = stream[pos:pos + length].decode('latin-1')
+            pos = end
+        elif kind in (TYPE_BEGIN, TYPE_END):
+            # Events written by a pre-empting interrupt may come before older ones, a small step back is no wrap
+            if last is not None:
+                step = (cycles - last) & 0xFFFFFFFF
+                if step < 0x80000000 and cycles < last:
+                    high += 1 << 32
+                elif step >= 0x80000000 and cycles > last:
+                    high -= 1 << 32
+            last = cycles
+            events.append((high + cycles, 'B' if kind == TYPE_BEGIN else 'E', event_id))
+        else:
+            raise ValueError('unknown record type %d at byte %d, not a trace capture?' % (kind, pos - 8))
+    return names, events
+
+
+def convert(stream, clock_hz):
+    """Chrome trace JSON object of a capture"""
+    names, events = parse(stream)
+    if not events:
+        raise ValueError('no events in the capture')
+    events.sort(key=lambda event: event[0])
+    start = events[0][0]
+    trace = [
+        {'ph': 'M', 'name': 'process_name', 'pid': 1, 'args': {'name': 'RA8M1 bridge'}},
+        {'ph': 'M', 'name': 'thread_name', 'pid': 1, 'tid': TRACK_LOOP, 'args': {'name': 'bridge'}},
+        {'ph': 'M', 'name': 'thread_name', 'pid': 1, 'tid': TRACK_IRQ, 'args': {'name': 'interrupts'}},
+    ]
+    # Begin events still open per track. The capture can start inside an event and stop inside another one.
+    open_ids = {TRACK_LOOP: [], TRACK_IRQ: []}
+
+    def emit(cycles, phase, event_id, tid):
+        trace.append({
+            'ph': phase,
+            'name': names.get(event_id, 'event 0x%x' % event_id),
+            'pid': 1,
+            'tid': tid,
+            'ts': (cycles - start) * 1e6 / clock_hz,
+        })
+
+    for cycles, phase, event_id in events:
+        tid = TRACK_IRQ if event_id >= ID_IRQ_BASE else TRACK_LOOP
+        stack = open_ids[tid]
+        if phase == 'B':
+            stack.append(event_id)
+        elif event_id in stack:
+            # Events begun inside this one and never ended are closed with it
+            while stack[-1] != event_id:
+                emit(cycles, 'E', stack.pop(), tid)
+            stack.pop()
+        else:
+            # Its begin came before the capture started
+            continue
+        emit(cycles, phase, event_id, tid)
+
+    # Close what was still running when the capture stopped, innermost first
+    end = events[-1][0]
+    for tid, stack in open_ids.items():
+        while stack:
+            emit(end, 'E', stack.pop(), tid)
+    return {'traceEvents': trace, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('capture', nargs='?', help='RTT channel 2 capture, standard input when omitted')
+    parser.add_argument('-o', '--output', help='JSON file, standard output when omitted')
+    parser.add_argument('--clock', type=int, default=480000000, help='CPU clock in Hz (default 480 MHz)')
+    options = parser.parse_args()
+
+    try:
+        if options.capture:
+            with open(options.capture, 'rb') as f:
+                stream = f.read()
+        else:
+            stream = sys.stdin.buffer.read()
+        trace = convert(stream, options.clock)
+    except ValueError as error:
+        sys.exit('trace_to_chrome: %s' % error.args[0])
+
+    if options.output:
+        with open(options.output, 'w') as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()